@@ -30,6 +30,11 @@
 #include <string.h>
 
 #include "aes.h"
+#include "cpufeatures.h"
+
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+#include <immintrin.h>
+#endif
 
 static inline uint32_t br_dec32le(const unsigned char *src) {
     return (uint32_t)src[0]
@@ -522,7 +527,7 @@ static void aes_ctr4x(unsigned char out[64], uint32_t ivw[16], const uint64_t *s
 }
 
 
-static void aes_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *rkeys, unsigned int nrounds) {
+static void aes_ecb_ct64(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *rkeys, unsigned int nrounds) {
     uint32_t blocks[16];
     unsigned char t[64];
 
@@ -542,7 +547,7 @@ static void aes_ecb(unsigned char *out, const unsigned char *in, size_t nblocks,
 }
 
 
-static void aes_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const uint64_t *rkeys, unsigned int nrounds) {
+static void aes_ctr_ct64(unsigned char *out, size_t outlen, const unsigned char *iv, const uint64_t *rkeys, unsigned int nrounds) {
     uint32_t ivw[16];
     size_t i;
     uint32_t cc = 0;
@@ -571,19 +576,350 @@ static void aes_ctr(unsigned char *out, size_t outlen, const unsigned char *iv,
 }
 
 
+#define AES_BACKEND_CT64  1
+#define AES_BACKEND_AESNI 2
+#define AES_BACKEND_VAES  3
 
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+/* AES-NI and VAES backends.
+ *
+ * These store the standard round keys, (nrounds + 1) blocks of 16 bytes,
+ * at the start of sk_exp instead of the bitsliced key schedule. The
+ * backend that expanded a key is stored next to it in the context, and
+ * encryption dispatches on that tag rather than on aes_backend, so a
+ * context is only ever read in the layout it was written in. */
 
+#define AES_MAXROUNDS 14
 
-void aes128_ecb_keyexp(aes128ctx *r, const unsigned char *key) {
-    uint64_t skey[22];
+static unsigned int aes_backend;
+
+/*************************************************
+ * Name:        aes_backend_select
+ *
+ * Description: Picks the AES implementation for the running CPU.
+ *              Every thread arrives at the same answer, so a concurrent
+ *              first call at worst repeats the choice; the choice is
+ *              cached with a relaxed atomic store.
+ *
+ * Returns one of AES_BACKEND_*
+ **************************************************/
+static unsigned int aes_backend_select(void) {
+    unsigned int backend = AES_BACKEND_CT64;
+
+    if (pqclean_cpu_supports(PQC_CPU_AESNI | PQC_CPU_SSE41 | PQC_CPU_VAES |
+                             PQC_CPU_AVX512F | PQC_CPU_AVX512BW)) {
+        backend = AES_BACKEND_VAES;
+    } else if (pqclean_cpu_supports(PQC_CPU_AESNI | PQC_CPU_SSE41)) {
+        backend = AES_BACKEND_AESNI;
+    }
+    PQCLEAN_DISPATCH_STORE(&aes_backend, backend);
+    return backend;
+}
+
+static unsigned int aes_get_backend(void) {
+    unsigned int backend = PQCLEAN_DISPATCH_LOAD(&aes_backend);
+
+    if (backend == 0) {
+        backend = aes_backend_select();
+    }
+    return backend;
+}
+
+/* SubWord() through aeskeygenassist, which substitutes dword 1 into dword 0 */
+__attribute__((target("aes,sse4.1")))
+static uint32_t sub_word_aesni(uint32_t x) {
+    return (uint32_t)_mm_cvtsi128_si32(_mm_aeskeygenassist_si128(_mm_set_epi32(0, 0, (int)x, 0), 0));
+}
+
+__attribute__((target("aes,sse4.1")))
+static void aes_keysched_aesni(uint64_t *sk_exp, const unsigned char *key, unsigned int key_len) {
+    unsigned int i, j, k, nk, nkf;
+    uint32_t tmp;
+    uint32_t skey[60];
+    unsigned nrounds = 10 + ((key_len - 16) >> 2);
+
+    nk = (key_len >> 2);
+    nkf = ((nrounds + 1) << 2);
+    br_range_dec32le(skey, (key_len >> 2), key);
+    tmp = skey[(key_len >> 2) - 1];
+    for (i = nk, j = 0, k = 0; i < nkf; i ++) {
+        if (j == 0) {
+            tmp = (tmp << 24) | (tmp >> 8);
+            tmp = sub_word_aesni(tmp) ^ Rcon[k];
+        } else if (nk > 6 && j == 4) {
+            tmp = sub_word_aesni(tmp);
+        }
+        tmp ^= skey[i - nk];
+        skey[i] = tmp;
+        if (++ j == nk) {
+            j = 0;
+            k ++;
+        }
+    }
+    br_range_enc32le((unsigned char *)sk_exp, skey, nkf);
+}
+
+__attribute__((target("aes,sse4.1")))
+static inline void aes_load_rkeys_aesni(__m128i *rk, const uint64_t *rkeys, unsigned int nrounds) {
+    unsigned int i;
+
+    for (i = 0; i <= nrounds; i++) {
+        rk[i] = _mm_loadu_si128((const __m128i *)(rkeys + 2 * i));
+    }
+}
+
+__attribute__((target("aes,sse4.1")))
+static inline __m128i aes_enc1_aesni(__m128i b, const __m128i *rk, unsigned int nrounds) {
+    unsigned int r;
+
+    b = _mm_xor_si128(b, rk[0]);
+    for (r = 1; r < nrounds; r++) {
+        b = _mm_aesenc_si128(b, rk[r]);
+    }
+    return _mm_aesenclast_si128(b, rk[nrounds]);
+}
+
+/* Encrypts eight independent blocks with their rounds interleaved,
+ * so that the aesenc latency is hidden behind the other blocks. */
+__attribute__((target("aes,sse4.1")))
+static inline void aes_enc8_aesni(__m128i b[8], const __m128i *rk, unsigned int nrounds) {
+    unsigned int i, r;
+
+    for (i = 0; i < 8; i++) {
+        b[i] = _mm_xor_si128(b[i], rk[0]);
+    }
+    for (r = 1; r < nrounds; r++) {
+        for (i = 0; i < 8; i++) {
+            b[i] = _mm_aesenc_si128(b[i], rk[r]);
+        }
+    }
+    for (i = 0; i < 8; i++) {
+        b[i] = _mm_aesenclast_si128(b[i], rk[nrounds]);
+    }
+}
+
+__attribute__((target("aes,sse4.1")))
+static void aes_ecb_aesni(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *rkeys, unsigned int nrounds) {
+    __m128i rk[AES_MAXROUNDS + 1];
+    __m128i b[8];
+    unsigned int i;
+
+    aes_load_rkeys_aesni(rk, rkeys, nrounds);
+    while (nblocks >= 8) {
+        for (i = 0; i < 8; i++) {
+            b[i] = _mm_loadu_si128((const __m128i *)(in + 16 * i));
+        }
+        aes_enc8_aesni(b, rk, nrounds);
+        for (i = 0; i < 8; i++) {
+            _mm_storeu_si128((__m128i *)(out + 16 * i), b[i]);
+        }
+        nblocks -= 8;
+        in += 128;
+        out += 128;
+    }
+    while (nblocks > 0) {
+        b[0] = aes_enc1_aesni(_mm_loadu_si128((const __m128i *)in), rk, nrounds);
+        _mm_storeu_si128((__m128i *)out, b[0]);
+        nblocks--;
+        in += 16;
+        out += 16;
+    }
+}
+
+/* CTR mode starting at block counter ctr; the nonce block has its
+ * counter word zeroed. */
+__attribute__((target("aes,sse4.1")))
+static void aes_ctr_aesni(unsigned char *out, size_t outlen, __m128i nonce, uint32_t ctr, const uint64_t *rkeys, unsigned int nrounds) {
+    __m128i rk[AES_MAXROUNDS + 1];
+    __m128i b[8];
+    unsigned char t[16];
+    unsigned int i;
+
+    aes_load_rkeys_aesni(rk, rkeys, nrounds);
+    while (outlen >= 128) {
+        for (i = 0; i < 8; i++) {
+            b[i] = _mm_insert_epi32(nonce, (int)br_swap32(ctr + i), 3);
+        }
+        aes_enc8_aesni(b, rk, nrounds);
+        for (i = 0; i < 8; i++) {
+            _mm_storeu_si128((__m128i *)(out + 16 * i), b[i]);
+        }
+        ctr += 8;
+        out += 128;
+        outlen -= 128;
+    }
+    while (outlen > 0) {
+        b[0] = aes_enc1_aesni(_mm_insert_epi32(nonce, (int)br_swap32(ctr), 3), rk, nrounds);
+        ctr++;
+        if (outlen < 16) {
+            _mm_storeu_si128((__m128i *)t, b[0]);
+            memcpy(out, t, outlen);
+            break;
+        }
+        _mm_storeu_si128((__m128i *)out, b[0]);
+        out += 16;
+        outlen -= 16;
+    }
+}
 
+__attribute__((target("aes,sse4.1")))
+static __m128i aes_load_nonce_aesni(const unsigned char *iv) {
+    unsigned char t[16];
+
+    memcpy(t, iv, AESCTR_NONCEBYTES);
+    memset(t + AESCTR_NONCEBYTES, 0, 16 - AESCTR_NONCEBYTES);
+    return _mm_loadu_si128((const __m128i *)t);
+}
+
+__attribute__((target("aes,sse4.1,avx512f,avx512bw,vaes")))
+static inline void aes_load_rkeys_vaes(__m512i *rk, const uint64_t *rkeys, unsigned int nrounds) {
+    unsigned int i;
+
+    for (i = 0; i <= nrounds; i++) {
+        rk[i] = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(rkeys + 2 * i)));
+    }
+}
+
+/* Encrypts sixteen independent blocks, four per 512-bit register */
+__attribute__((target("aes,sse4.1,avx512f,avx512bw,vaes")))
+static inline void aes_enc16_vaes(__m512i b[4], const __m512i *rk, unsigned int nrounds) {
+    unsigned int i, r;
+
+    for (i = 0; i < 4; i++) {
+        b[i] = _mm512_xor_si512(b[i], rk[0]);
+    }
+    for (r = 1; r < nrounds; r++) {
+        for (i = 0; i < 4; i++) {
+            b[i] = _mm512_aesenc_epi128(b[i], rk[r]);
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        b[i] = _mm512_aesenclast_epi128(b[i], rk[nrounds]);
+    }
+}
+
+__attribute__((target("aes,sse4.1,avx512f,avx512bw,vaes")))
+static void aes_ecb_vaes(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *rkeys, unsigned int nrounds) {
+    __m512i rk[AES_MAXROUNDS + 1];
+    __m512i b[4];
+    unsigned int i;
+
+    aes_load_rkeys_vaes(rk, rkeys, nrounds);
+    while (nblocks >= 16) {
+        for (i = 0; i < 4; i++) {
+            b[i] = _mm512_loadu_si512((const void *)(in + 64 * i));
+        }
+        aes_enc16_vaes(b, rk, nrounds);
+        for (i = 0; i < 4; i++) {
+            _mm512_storeu_si512((void *)(out + 64 * i), b[i]);
+        }
+        nblocks -= 16;
+        in += 256;
+        out += 256;
+    }
+    aes_ecb_aesni(out, in, nblocks, rkeys, nrounds);
+}
+
+__attribute__((target("aes,sse4.1,avx512f,avx512bw,vaes")))
+static void aes_ctr_vaes(unsigned char *out, size_t outlen, const unsigned char *iv, const uint64_t *rkeys, unsigned int nrounds) {
+    /* Moves the little-endian counter in dword 3 of each block to
+     * big-endian and clears the other twelve bytes. */
+    const __m512i ctr_bswap = _mm512_set4_epi32(0x0c0d0e0f, (int)0x80808080, (int)0x80808080, (int)0x80808080);
+    const __m512i inc16 = _mm512_set4_epi32(16, 0, 0, 0);
+    __m512i rk[AES_MAXROUNDS + 1];
+    __m512i b[4], c[4], nonce;
+    __m128i nonce128;
+    uint32_t ctr = 0;
+    unsigned int i;
+
+    nonce128 = aes_load_nonce_aesni(iv);
+    if (outlen >= 256) {
+        aes_load_rkeys_vaes(rk, rkeys, nrounds);
+        nonce = _mm512_broadcast_i32x4(nonce128);
+        c[0] = _mm512_set_epi32(3, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0);
+        for (i = 1; i < 4; i++) {
+            c[i] = _mm512_add_epi32(c[i - 1], _mm512_set4_epi32(4, 0, 0, 0));
+        }
+        while (outlen >= 256) {
+            for (i = 0; i < 4; i++) {
+                b[i] = _mm512_or_si512(_mm512_shuffle_epi8(c[i], ctr_bswap), nonce);
+                c[i] = _mm512_add_epi32(c[i], inc16);
+            }
+            aes_enc16_vaes(b, rk, nrounds);
+            for (i = 0; i < 4; i++) {
+                _mm512_storeu_si512((void *)(out + 64 * i), b[i]);
+            }
+            ctr += 16;
+            out += 256;
+            outlen -= 256;
+        }
+    }
+    aes_ctr_aesni(out, outlen, nonce128, ctr, rkeys, nrounds);
+}
+#endif
+
+/* Expands key into sk_exp and returns the AES_BACKEND_* whose layout it used */
+static unsigned int aes_keyexp(uint64_t *sk_exp, const unsigned char *key, unsigned int key_len) {
+    uint64_t skey[30];
+    unsigned int nrounds = 10 + ((key_len - 16) >> 2);
+
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+    unsigned int backend = aes_get_backend();
+
+    if (backend != AES_BACKEND_CT64) {
+        aes_keysched_aesni(sk_exp, key, key_len);
+        return backend;
+    }
+#endif
+    br_aes_ct64_keysched(skey, key, key_len);
+    br_aes_ct64_skey_expand(sk_exp, skey, nrounds);
+    return AES_BACKEND_CT64;
+}
+
+static void aes_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const uint64_t *rkeys, unsigned int nrounds, unsigned int backend) {
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+    switch (backend) {
+        case AES_BACKEND_VAES:
+            aes_ecb_vaes(out, in, nblocks, rkeys, nrounds);
+            return;
+        case AES_BACKEND_AESNI:
+            aes_ecb_aesni(out, in, nblocks, rkeys, nrounds);
+            return;
+        default:
+            break;
+    }
+#else
+    (void)backend;
+#endif
+    aes_ecb_ct64(out, in, nblocks, rkeys, nrounds);
+}
+
+static void aes_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const uint64_t *rkeys, unsigned int nrounds, unsigned int backend) {
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+    switch (backend) {
+        case AES_BACKEND_VAES:
+            aes_ctr_vaes(out, outlen, iv, rkeys, nrounds);
+            return;
+        case AES_BACKEND_AESNI:
+            aes_ctr_aesni(out, outlen, aes_load_nonce_aesni(iv), 0, rkeys, nrounds);
+            return;
+        default:
+            break;
+    }
+#else
+    (void)backend;
+#endif
+    aes_ctr_ct64(out, outlen, iv, rkeys, nrounds);
+}
+
+
+void aes128_ecb_keyexp(aes128ctx *r, const unsigned char *key) {
     r->sk_exp = malloc(sizeof(uint64_t) * PQC_AES128_STATESIZE);
     if (r->sk_exp == NULL) {
         exit(111);
     }
 
-    br_aes_ct64_keysched(skey, key, 16);
-    br_aes_ct64_skey_expand(r->sk_exp, skey, 10);
+    r->backend = aes_keyexp(r->sk_exp, key, 16);
 }
 
 void aes128_ctr_keyexp(aes128ctx *r, const unsigned char *key) {
@@ -592,14 +928,12 @@ void aes128_ctr_keyexp(aes128ctx *r, const unsigned char *key) {
 
 
 void aes192_ecb_keyexp(aes192ctx *r, const unsigned char *key) {
-    uint64_t skey[26];
     r->sk_exp = malloc(sizeof(uint64_t) * PQC_AES192_STATESIZE);
     if (r->sk_exp == NULL) {
         exit(111);
     }
 
-    br_aes_ct64_keysched(skey, key, 24);
-    br_aes_ct64_skey_expand(r->sk_exp, skey, 12);
+    r->backend = aes_keyexp(r->sk_exp, key, 24);
 }
 
 
@@ -609,14 +943,12 @@ void aes192_ctr_keyexp(aes192ctx *r, const unsigned char *key) {
 
 
 void aes256_ecb_keyexp(aes256ctx *r, const unsigned char *key) {
-    uint64_t skey[30];
     r->sk_exp = malloc(sizeof(uint64_t) * PQC_AES256_STATESIZE);
     if (r->sk_exp == NULL) {
         exit(111);
     }
 
-    br_aes_ct64_keysched(skey, key, 32);
-    br_aes_ct64_skey_expand(r->sk_exp, skey, 14);
+    r->backend = aes_keyexp(r->sk_exp, key, 32);
 }
 
 
@@ -626,27 +958,27 @@ void aes256_ctr_keyexp(aes256ctx *r, const unsigned char *key) {
 
 
 void aes128_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const aes128ctx *ctx) {
-    aes_ecb(out, in, nblocks, ctx->sk_exp, 10);
+    aes_ecb(out, in, nblocks, ctx->sk_exp, 10, ctx->backend);
 }
 
 void aes128_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes128ctx *ctx) {
-    aes_ctr(out, outlen, iv, ctx->sk_exp, 10);
+    aes_ctr(out, outlen, iv, ctx->sk_exp, 10, ctx->backend);
 }
 
 void aes192_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const aes192ctx *ctx) {
-    aes_ecb(out, in, nblocks, ctx->sk_exp, 12);
+    aes_ecb(out, in, nblocks, ctx->sk_exp, 12, ctx->backend);
 }
 
 void aes192_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes192ctx *ctx) {
-    aes_ctr(out, outlen, iv, ctx->sk_exp, 12);
+    aes_ctr(out, outlen, iv, ctx->sk_exp, 12, ctx->backend);
 }
 
 void aes256_ecb(unsigned char *out, const unsigned char *in, size_t nblocks, const aes256ctx *ctx) {
-    aes_ecb(out, in, nblocks, ctx->sk_exp, 14);
+    aes_ecb(out, in, nblocks, ctx->sk_exp, 14, ctx->backend);
 }
 
 void aes256_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, const aes256ctx *ctx) {
-    aes_ctr(out, outlen, iv, ctx->sk_exp, 14);
+    aes_ctr(out, outlen, iv, ctx->sk_exp, 14, ctx->backend);
 }
 
 void aes128_ctx_release(aes128ctx *r) {
@@ -661,3 +993,51 @@ void aes256_ctx_release(aes256ctx *r) {
     free(r->sk_exp);
 }
 
+
+void aes128_ecb_keyexp_inline(aes128ctx_inline *r, const unsigned char *key) {
+    r->backend = aes_keyexp(r->sk_exp, key, 16);
+}
+
+void aes128_ctr_keyexp_inline(aes128ctx_inline *r, const unsigned char *key) {
+    aes128_ecb_keyexp_inline(r, key);
+}
+
+void aes128_ecb_inline(unsigned char *out, const unsigned char *in, size_t nblocks, const aes128ctx_inline *ctx) {
+    aes_ecb(out, in, nblocks, ctx->sk_exp, 10, ctx->backend);
+}
+
+void aes128_ctr_inline(unsigned char *out, size_t outlen, const unsigned char *iv, const aes128ctx_inline *ctx) {
+    aes_ctr(out, outlen, iv, ctx->sk_exp, 10, ctx->backend);
+}
+
+void aes192_ecb_keyexp_inline(aes192ctx_inline *r, const unsigned char *key) {
+    r->backend = aes_keyexp(r->sk_exp, key, 24);
+}
+
+void aes192_ctr_keyexp_inline(aes192ctx_inline *r, const unsigned char *key) {
+    aes192_ecb_keyexp_inline(r, key);
+}
+
+void aes192_ecb_inline(unsigned char *out, const unsigned char *in, size_t nblocks, const aes192ctx_inline *ctx) {
+    aes_ecb(out, in, nblocks, ctx->sk_exp, 12, ctx->backend);
+}
+
+void aes192_ctr_inline(unsigned char *out, size_t outlen, const unsigned char *iv, const aes192ctx_inline *ctx) {
+    aes_ctr(out, outlen, iv, ctx->sk_exp, 12, ctx->backend);
+}
+
+void aes256_ecb_keyexp_inline(aes256ctx_inline *r, const unsigned char *key) {
+    r->backend = aes_keyexp(r->sk_exp, key, 32);
+}
+
+void aes256_ctr_keyexp_inline(aes256ctx_inline *r, const unsigned char *key) {
+    aes256_ecb_keyexp_inline(r, key);
+}
+
+void aes256_ecb_inline(unsigned char *out, const unsigned char *in, size_t nblocks, const aes256ctx_inline *ctx) {
+    aes_ecb(out, in, nblocks, ctx->sk_exp, 14, ctx->backend);
+}
+
+void aes256_ctr_inline(unsigned char *out, size_t outlen, const unsigned char *iv, const aes256ctx_inline *ctx) {
+    aes_ctr(out, outlen, iv, ctx->sk_exp, 14, ctx->backend);
+}
@@ -11,21 +11,43 @@
 #define AES_BLOCKBYTES 16
 
 // We've put these states on the heap to make sure ctx_release is used.
+// backend records which implementation expanded the key, and with it the
+// layout of sk_exp; it is set by the keyexp functions.
 #define PQC_AES128_STATESIZE 88
 typedef struct {
     uint64_t* sk_exp;
+    unsigned int backend;
 } aes128ctx;
 
 #define PQC_AES192_STATESIZE 104
 typedef struct {
     uint64_t*  sk_exp;
+    unsigned int backend;
 } aes192ctx;
 
 #define PQC_AES256_STATESIZE 120
 typedef struct {
     uint64_t* sk_exp;
+    unsigned int backend;
 } aes256ctx;
 
+// Inline (caller-owned) variants of the above, holding the expanded key by
+// value. Use them with the *_inline functions; no release is needed.
+typedef struct {
+    uint64_t sk_exp[PQC_AES128_STATESIZE];
+    unsigned int backend;
+} aes128ctx_inline;
+
+typedef struct {
+    uint64_t sk_exp[PQC_AES192_STATESIZE];
+    unsigned int backend;
+} aes192ctx_inline;
+
+typedef struct {
+    uint64_t sk_exp[PQC_AES256_STATESIZE];
+    unsigned int backend;
+} aes256ctx_inline;
+
 
 
 /** Initializes the context **/
@@ -66,4 +88,30 @@ void aes256_ctr(unsigned char *out, size_t outlen, const unsigned char *iv, cons
 void aes256_ctx_release(aes256ctx *r);
 
 
+/** Allocation-free variants on caller-owned contexts **/
+void aes128_ecb_keyexp_inline(aes128ctx_inline *r, const unsigned char *key);
+
+void aes128_ctr_keyexp_inline(aes128ctx_inline *r, const unsigned char *key);
+
+void aes128_ecb_inline(unsigned char *out, const unsigned char *in, size_t nblocks, const aes128ctx_inline *ctx);
+
+void aes128_ctr_inline(unsigned char *out, size_t outlen, const unsigned char *iv, const aes128ctx_inline *ctx);
+
+void aes192_ecb_keyexp_inline(aes192ctx_inline *r, const unsigned char *key);
+
+void aes192_ctr_keyexp_inline(aes192ctx_inline *r, const unsigned char *key);
+
+void aes192_ecb_inline(unsigned char *out, const unsigned char *in, size_t nblocks, const aes192ctx_inline *ctx);
+
+void aes192_ctr_inline(unsigned char *out, size_t outlen, const unsigned char *iv, const aes192ctx_inline *ctx);
+
+void aes256_ecb_keyexp_inline(aes256ctx_inline *r, const unsigned char *key);
+
+void aes256_ctr_keyexp_inline(aes256ctx_inline *r, const unsigned char *key);
+
+void aes256_ecb_inline(unsigned char *out, const unsigned char *in, size_t nblocks, const aes256ctx_inline *ctx);
+
+void aes256_ctr_inline(unsigned char *out, size_t outlen, const unsigned char *iv, const aes256ctx_inline *ctx);
+
+
 #endif
@@ -0,0 +1,129 @@
+#ifndef PQCLEAN_COMMON_CPUFEATURES_H
+#define PQCLEAN_COMMON_CPUFEATURES_H
+
+/* Runtime CPU feature detection for the accelerated code paths in common/.
+ *
+ * The common files are compiled without any -m flags, so SIMD code in them
+ * is annotated with __attribute__((target(...))) and only called after
+ * pqclean_cpu_supports() has confirmed that both the CPU and the OS (XCR0)
+ * support the corresponding instructions.
+ *
+ * On compilers or architectures where detection is not available, or when
+ * PQCLEAN_NO_CPU_DISPATCH is defined, every feature is reported as absent
+ * and callers use their portable code.
+ *
+ * Like compat.h, this file is allowed to use #ifdefs.
+ */
+
+#include <stdint.h>
+
+#define PQC_CPU_AVX2        0x001u
+#define PQC_CPU_AVX512F     0x002u
+#define PQC_CPU_AVX512BW    0x004u
+#define PQC_CPU_AVX512VL    0x008u
+#define PQC_CPU_AESNI       0x010u
+#define PQC_CPU_PCLMUL      0x020u
+#define PQC_CPU_VAES        0x040u
+#define PQC_CPU_VPCLMULQDQ  0x080u
+#define PQC_CPU_SHA         0x100u
+#define PQC_CPU_BMI2        0x200u
+#define PQC_CPU_SSE41       0x400u
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(PQCLEAN_NO_CPU_DISPATCH)
+#define PQCLEAN_HAVE_X86_DISPATCH 1
+
+#include <cpuid.h>
+
+static inline uint64_t pqclean_xgetbv(uint32_t index) {
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(index));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static inline uint32_t pqclean_cpu_features(void) {
+    uint32_t eax, ebx, ecx, edx;
+    uint32_t features = 0;
+    uint32_t max_leaf;
+    uint64_t xcr0 = 0;
+    int os_avx, os_avx512;
+
+    max_leaf = (uint32_t)__get_cpuid_max(0, 0);
+    if (max_leaf < 1) {
+        return 0;
+    }
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (ecx & (1u << 25)) {
+        features |= PQC_CPU_AESNI;
+    }
+    if (ecx & (1u << 1)) {
+        features |= PQC_CPU_PCLMUL;
+    }
+    if (ecx & (1u << 19)) {
+        features |= PQC_CPU_SSE41;
+    }
+    if (ecx & (1u << 27)) { // OSXSAVE
+        xcr0 = pqclean_xgetbv(0);
+    }
+    os_avx = (ecx & (1u << 28)) && (xcr0 & 0x06) == 0x06;
+    os_avx512 = os_avx && (xcr0 & 0xE0) == 0xE0;
+
+    if (max_leaf < 7) {
+        return features;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if (ebx & (1u << 8)) {
+        features |= PQC_CPU_BMI2;
+    }
+    if (ebx & (1u << 29)) {
+        features |= PQC_CPU_SHA;
+    }
+    if (os_avx) {
+        if (ebx & (1u << 5)) {
+            features |= PQC_CPU_AVX2;
+        }
+        if (ecx & (1u << 9)) {
+            features |= PQC_CPU_VAES;
+        }
+        if (ecx & (1u << 10)) {
+            features |= PQC_CPU_VPCLMULQDQ;
+        }
+    }
+    if (os_avx512 && (ebx & (1u << 16))) {
+        features |= PQC_CPU_AVX512F;
+        if (ebx & (1u << 30)) {
+            features |= PQC_CPU_AVX512BW;
+        }
+        if (ebx & (1u << 31)) {
+            features |= PQC_CPU_AVX512VL;
+        }
+    }
+    return features;
+}
+
+#else
+
+static inline uint32_t pqclean_cpu_features(void) {
+    return 0;
+}
+
+#endif
+
+/* Returns nonzero if all features in mask are available. */
+static inline int pqclean_cpu_supports(uint32_t mask) {
+    return (pqclean_cpu_features() & mask) == mask;
+}
+
+/* Access to the choices that common/ caches on first use. Threads may make
+ * their first call concurrently, so the cache is read and written with
+ * relaxed atomics; every thread computes the same choice, so no ordering
+ * is needed. Without dispatch the choice is a constant and is not cached:
+ * the store is dropped, so no compiler builtins are required. */
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+#define PQCLEAN_DISPATCH_LOAD(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define PQCLEAN_DISPATCH_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#else
+#define PQCLEAN_DISPATCH_LOAD(p) (*(p))
+#define PQCLEAN_DISPATCH_STORE(p, v) ((void)(p), (void)(v))
+#endif
+
+#endif // PQCLEAN_COMMON_CPUFEATURES_H
@@ -10,8 +10,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "cpufeatures.h"
 #include "fips202.h"
 
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
 #define NROUNDS 24
 #define ROL(a, offset) (((a) << (offset)) ^ ((a) >> (64 - (offset))))
 
@@ -64,13 +69,13 @@ static const uint64_t KeccakF_RoundConstants[NROUNDS] = {
 };
 
 /*************************************************
- * Name:        KeccakF1600_StatePermute
+ * Name:        KeccakF1600_StatePermute_scalar
  *
- * Description: The Keccak F1600 Permutation
+ * Description: The Keccak F1600 Permutation, portable implementation
  *
  * Arguments:   - uint64_t *state: pointer to input/output Keccak state
  **************************************************/
-static void KeccakF1600_StatePermute(uint64_t *state) {
+static void KeccakF1600_StatePermute_scalar(uint64_t *state) {
     int round;
 
     uint64_t Aba, Abe, Abi, Abo, Abu;
@@ -333,6 +338,138 @@ static void KeccakF1600_StatePermute(uint64_t *state) {
     state[24] = Asu;
 }
 
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+/*************************************************
+ * Name:        KeccakF1600_StatePermute_avx512
+ *
+ * Description: The Keccak F1600 Permutation using AVX-512F.
+ *              Each plane (row of 5 lanes) lives in the low lanes of one
+ *              zmm register; theta and chi use vpternlogq, rho uses
+ *              vprolvq and pi is done with cross-register permutes.
+ *
+ * Arguments:   - uint64_t *state: pointer to input/output Keccak state
+ **************************************************/
+__attribute__((target("avx512f")))
+static void KeccakF1600_StatePermute_avx512(uint64_t *state) {
+    int round;
+    __m512i a0, a1, a2, a3, a4, c, d, b0, b1, b2, b3, b4, t0, t1;
+    const __m512i xm1 = _mm512_setr_epi64(4, 0, 1, 2, 3, 5, 6, 7);
+    const __m512i xp1 = _mm512_setr_epi64(1, 2, 3, 4, 0, 5, 6, 7);
+    const __m512i xp2 = _mm512_setr_epi64(2, 3, 4, 0, 1, 5, 6, 7);
+    /* rho offsets, row by row */
+    const __m512i r0 = _mm512_setr_epi64(0, 1, 62, 28, 27, 0, 0, 0);
+    const __m512i r1 = _mm512_setr_epi64(36, 44, 6, 55, 20, 0, 0, 0);
+    const __m512i r2 = _mm512_setr_epi64(3, 10, 43, 25, 39, 0, 0, 0);
+    const __m512i r3 = _mm512_setr_epi64(41, 45, 15, 21, 8, 0, 0, 0);
+    const __m512i r4 = _mm512_setr_epi64(18, 2, 61, 56, 14, 0, 0, 0);
+    /* pi: output row y, lane x takes lane (x + 3y) mod 5 of input row x.
+       Lanes 0-4 of the index vectors address the first source, 8-12 the second. */
+    const __m512i p0_01 = _mm512_setr_epi64(0, 9, 0, 0, 0, 0, 0, 0);
+    const __m512i p0_23 = _mm512_setr_epi64(0, 0, 2, 11, 0, 0, 0, 0);
+    const __m512i p0_4 = _mm512_setr_epi64(0, 0, 0, 0, 4, 0, 0, 0);
+    const __m512i p1_01 = _mm512_setr_epi64(3, 12, 0, 0, 0, 0, 0, 0);
+    const __m512i p1_23 = _mm512_setr_epi64(0, 0, 0, 9, 0, 0, 0, 0);
+    const __m512i p1_4 = _mm512_setr_epi64(0, 0, 0, 0, 2, 0, 0, 0);
+    const __m512i p2_01 = _mm512_setr_epi64(1, 10, 0, 0, 0, 0, 0, 0);
+    const __m512i p2_23 = _mm512_setr_epi64(0, 0, 3, 12, 0, 0, 0, 0);
+    const __m512i p2_4 = _mm512_setr_epi64(0, 0, 0, 0, 0, 0, 0, 0);
+    const __m512i p3_01 = _mm512_setr_epi64(4, 8, 0, 0, 0, 0, 0, 0);
+    const __m512i p3_23 = _mm512_setr_epi64(0, 0, 1, 10, 0, 0, 0, 0);
+    const __m512i p3_4 = _mm512_setr_epi64(0, 0, 0, 0, 3, 0, 0, 0);
+    const __m512i p4_01 = _mm512_setr_epi64(2, 11, 0, 0, 0, 0, 0, 0);
+    const __m512i p4_23 = _mm512_setr_epi64(0, 0, 4, 8, 0, 0, 0, 0);
+    const __m512i p4_4 = _mm512_setr_epi64(0, 0, 0, 0, 1, 0, 0, 0);
+
+    a0 = _mm512_maskz_loadu_epi64(0x1F, state);
+    a1 = _mm512_maskz_loadu_epi64(0x1F, state + 5);
+    a2 = _mm512_maskz_loadu_epi64(0x1F, state + 10);
+    a3 = _mm512_maskz_loadu_epi64(0x1F, state + 15);
+    a4 = _mm512_maskz_loadu_epi64(0x1F, state + 20);
+
+    for (round = 0; round < NROUNDS; round++) {
+        /* theta */
+        c = _mm512_ternarylogic_epi64(a0, a1, a2, 0x96);
+        c = _mm512_ternarylogic_epi64(c, a3, a4, 0x96);
+        d = _mm512_rol_epi64(_mm512_permutexvar_epi64(xp1, c), 1);
+        c = _mm512_permutexvar_epi64(xm1, c);
+        /* theta (cont.) and rho */
+        a0 = _mm512_rolv_epi64(_mm512_ternarylogic_epi64(a0, c, d, 0x96), r0);
+        a1 = _mm512_rolv_epi64(_mm512_ternarylogic_epi64(a1, c, d, 0x96), r1);
+        a2 = _mm512_rolv_epi64(_mm512_ternarylogic_epi64(a2, c, d, 0x96), r2);
+        a3 = _mm512_rolv_epi64(_mm512_ternarylogic_epi64(a3, c, d, 0x96), r3);
+        a4 = _mm512_rolv_epi64(_mm512_ternarylogic_epi64(a4, c, d, 0x96), r4);
+        /* pi */
+        t0 = _mm512_permutex2var_epi64(a0, p0_01, a1);
+        t1 = _mm512_permutex2var_epi64(a2, p0_23, a3);
+        b0 = _mm512_mask_permutexvar_epi64(_mm512_mask_blend_epi64(0x0C, t0, t1), 0x10, p0_4, a4);
+        t0 = _mm512_permutex2var_epi64(a0, p1_01, a1);
+        t1 = _mm512_permutex2var_epi64(a2, p1_23, a3);
+        b1 = _mm512_mask_permutexvar_epi64(_mm512_mask_blend_epi64(0x0C, t0, t1), 0x10, p1_4, a4);
+        t0 = _mm512_permutex2var_epi64(a0, p2_01, a1);
+        t1 = _mm512_permutex2var_epi64(a2, p2_23, a3);
+        b2 = _mm512_mask_permutexvar_epi64(_mm512_mask_blend_epi64(0x0C, t0, t1), 0x10, p2_4, a4);
+        t0 = _mm512_permutex2var_epi64(a0, p3_01, a1);
+        t1 = _mm512_permutex2var_epi64(a2, p3_23, a3);
+        b3 = _mm512_mask_permutexvar_epi64(_mm512_mask_blend_epi64(0x0C, t0, t1), 0x10, p3_4, a4);
+        t0 = _mm512_permutex2var_epi64(a0, p4_01, a1);
+        t1 = _mm512_permutex2var_epi64(a2, p4_23, a3);
+        b4 = _mm512_mask_permutexvar_epi64(_mm512_mask_blend_epi64(0x0C, t0, t1), 0x10, p4_4, a4);
+        /* chi */
+        a0 = _mm512_ternarylogic_epi64(b0, _mm512_permutexvar_epi64(xp1, b0), _mm512_permutexvar_epi64(xp2, b0), 0xD2);
+        a1 = _mm512_ternarylogic_epi64(b1, _mm512_permutexvar_epi64(xp1, b1), _mm512_permutexvar_epi64(xp2, b1), 0xD2);
+        a2 = _mm512_ternarylogic_epi64(b2, _mm512_permutexvar_epi64(xp1, b2), _mm512_permutexvar_epi64(xp2, b2), 0xD2);
+        a3 = _mm512_ternarylogic_epi64(b3, _mm512_permutexvar_epi64(xp1, b3), _mm512_permutexvar_epi64(xp2, b3), 0xD2);
+        a4 = _mm512_ternarylogic_epi64(b4, _mm512_permutexvar_epi64(xp1, b4), _mm512_permutexvar_epi64(xp2, b4), 0xD2);
+        /* iota */
+        a0 = _mm512_mask_xor_epi64(a0, 0x01, a0, _mm512_set1_epi64((long long)KeccakF_RoundConstants[round]));
+    }
+
+    _mm512_mask_storeu_epi64(state, 0x1F, a0);
+    _mm512_mask_storeu_epi64(state + 5, 0x1F, a1);
+    _mm512_mask_storeu_epi64(state + 10, 0x1F, a2);
+    _mm512_mask_storeu_epi64(state + 15, 0x1F, a3);
+    _mm512_mask_storeu_epi64(state + 20, 0x1F, a4);
+}
+#endif
+
+static void KeccakF1600_StatePermute_select(uint64_t *state);
+
+static void (*KeccakF1600_StatePermute_impl)(uint64_t *state) = KeccakF1600_StatePermute_select;
+
+/*************************************************
+ * Name:        KeccakF1600_StatePermute_select
+ *
+ * Description: Picks the fastest permutation supported by the running CPU
+ *              on first use, then forwards the call to it.
+ *              Every candidate computes the same function, so a concurrent
+ *              first call from another thread at worst repeats the choice;
+ *              the pointer itself is published with a relaxed atomic store.
+ *
+ * Arguments:   - uint64_t *state: pointer to input/output Keccak state
+ **************************************************/
+static void KeccakF1600_StatePermute_select(uint64_t *state) {
+    void (*impl)(uint64_t *) = KeccakF1600_StatePermute_scalar;
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+    if (pqclean_cpu_supports(PQC_CPU_AVX512F)) {
+        impl = KeccakF1600_StatePermute_avx512;
+    }
+#endif
+    PQCLEAN_DISPATCH_STORE(&KeccakF1600_StatePermute_impl, impl);
+    impl(state);
+}
+
+/*************************************************
+ * Name:        KeccakF1600_StatePermute
+ *
+ * Description: The Keccak F1600 Permutation
+ *
+ * Arguments:   - uint64_t *state: pointer to input/output Keccak state
+ **************************************************/
+static void KeccakF1600_StatePermute(uint64_t *state) {
+    void (*impl)(uint64_t *) = PQCLEAN_DISPATCH_LOAD(&KeccakF1600_StatePermute_impl);
+    impl(state);
+}
+
 /*************************************************
  * Name:        keccak_absorb
  *
@@ -697,21 +834,20 @@ void shake128(uint8_t *output, size_t outlen,
               const uint8_t *input, size_t inlen) {
     size_t nblocks = outlen / SHAKE128_RATE;
     uint8_t t[SHAKE128_RATE];
-    shake128ctx s;
+    shake128ctx_inline s;
 
-    shake128_absorb(&s, input, inlen);
-    shake128_squeezeblocks(output, nblocks, &s);
+    shake128_absorb_inline(&s, input, inlen);
+    shake128_squeezeblocks_inline(output, nblocks, &s);
 
     output += nblocks * SHAKE128_RATE;
     outlen -= nblocks * SHAKE128_RATE;
 
     if (outlen) {
-        shake128_squeezeblocks(t, 1, &s);
+        shake128_squeezeblocks_inline(t, 1, &s);
         for (size_t i = 0; i < outlen; ++i) {
             output[i] = t[i];
         }
     }
-    shake128_ctx_release(&s);
 }
 
 /*************************************************
@@ -728,21 +864,20 @@ void shake256(uint8_t *output, size_t outlen,
               const uint8_t *input, size_t inlen) {
     size_t nblocks = outlen / SHAKE256_RATE;
     uint8_t t[SHAKE256_RATE];
-    shake256ctx s;
+    shake256ctx_inline s;
 
-    shake256_absorb(&s, input, inlen);
-    shake256_squeezeblocks(output, nblocks, &s);
+    shake256_absorb_inline(&s, input, inlen);
+    shake256_squeezeblocks_inline(output, nblocks, &s);
 
     output += nblocks * SHAKE256_RATE;
     outlen -= nblocks * SHAKE256_RATE;
 
     if (outlen) {
-        shake256_squeezeblocks(t, 1, &s);
+        shake256_squeezeblocks_inline(t, 1, &s);
         for (size_t i = 0; i < outlen; ++i) {
             output[i] = t[i];
         }
     }
-    shake256_ctx_release(&s);
 }
 
 void sha3_256_inc_init(sha3_256incctx *state) {
@@ -927,3 +1062,493 @@ void sha3_512(uint8_t *output, const uint8_t *input, size_t inlen) {
         output[i] = t[i];
     }
 }
+
+void shake128_absorb_inline(shake128ctx_inline *state, const uint8_t *input, size_t inlen) {
+    keccak_absorb(state->ctx, SHAKE128_RATE, input, inlen, 0x1F);
+}
+
+void shake128_squeezeblocks_inline(uint8_t *output, size_t nblocks, shake128ctx_inline *state) {
+    keccak_squeezeblocks(output, nblocks, state->ctx, SHAKE128_RATE);
+}
+
+void shake128_ctx_clone_inline(shake128ctx_inline *dest, const shake128ctx_inline *src) {
+    memcpy(dest->ctx, src->ctx, PQC_SHAKECTX_BYTES);
+}
+
+void shake128_inc_init_inline(shake128incctx_inline *state) {
+    keccak_inc_init(state->ctx);
+}
+
+void shake128_inc_absorb_inline(shake128incctx_inline *state, const uint8_t *input, size_t inlen) {
+    keccak_inc_absorb(state->ctx, SHAKE128_RATE, input, inlen);
+}
+
+void shake128_inc_finalize_inline(shake128incctx_inline *state) {
+    keccak_inc_finalize(state->ctx, SHAKE128_RATE, 0x1F);
+}
+
+void shake128_inc_squeeze_inline(uint8_t *output, size_t outlen, shake128incctx_inline *state) {
+    keccak_inc_squeeze(output, outlen, state->ctx, SHAKE128_RATE);
+}
+
+void shake128_inc_ctx_clone_inline(shake128incctx_inline *dest, const shake128incctx_inline *src) {
+    memcpy(dest->ctx, src->ctx, PQC_SHAKEINCCTX_BYTES);
+}
+
+void shake256_absorb_inline(shake256ctx_inline *state, const uint8_t *input, size_t inlen) {
+    keccak_absorb(state->ctx, SHAKE256_RATE, input, inlen, 0x1F);
+}
+
+void shake256_squeezeblocks_inline(uint8_t *output, size_t nblocks, shake256ctx_inline *state) {
+    keccak_squeezeblocks(output, nblocks, state->ctx, SHAKE256_RATE);
+}
+
+void shake256_ctx_clone_inline(shake256ctx_inline *dest, const shake256ctx_inline *src) {
+    memcpy(dest->ctx, src->ctx, PQC_SHAKECTX_BYTES);
+}
+
+void shake256_inc_init_inline(shake256incctx_inline *state) {
+    keccak_inc_init(state->ctx);
+}
+
+void shake256_inc_absorb_inline(shake256incctx_inline *state, const uint8_t *input, size_t inlen) {
+    keccak_inc_absorb(state->ctx, SHAKE256_RATE, input, inlen);
+}
+
+void shake256_inc_finalize_inline(shake256incctx_inline *state) {
+    keccak_inc_finalize(state->ctx, SHAKE256_RATE, 0x1F);
+}
+
+void shake256_inc_squeeze_inline(uint8_t *output, size_t outlen, shake256incctx_inline *state) {
+    keccak_inc_squeeze(output, outlen, state->ctx, SHAKE256_RATE);
+}
+
+void shake256_inc_ctx_clone_inline(shake256incctx_inline *dest, const shake256incctx_inline *src) {
+    memcpy(dest->ctx, src->ctx, PQC_SHAKEINCCTX_BYTES);
+}
+
+void sha3_256_inc_init_inline(sha3_256incctx_inline *state) {
+    keccak_inc_init(state->ctx);
+}
+
+void sha3_256_inc_absorb_inline(sha3_256incctx_inline *state, const uint8_t *input, size_t inlen) {
+    keccak_inc_absorb(state->ctx, SHA3_256_RATE, input, inlen);
+}
+
+void sha3_256_inc_finalize_inline(uint8_t *output, sha3_256incctx_inline *state) {
+    uint8_t t[SHA3_256_RATE];
+    keccak_inc_finalize(state->ctx, SHA3_256_RATE, 0x06);
+
+    keccak_squeezeblocks(t, 1, state->ctx, SHA3_256_RATE);
+
+    for (size_t i = 0; i < 32; i++) {
+        output[i] = t[i];
+    }
+}
+
+void sha3_256_inc_ctx_clone_inline(sha3_256incctx_inline *dest, const sha3_256incctx_inline *src) {
+    memcpy(dest->ctx, src->ctx, PQC_SHAKEINCCTX_BYTES);
+}
+
+void sha3_384_inc_init_inline(sha3_384incctx_inline *state) {
+    keccak_inc_init(state->ctx);
+}
+
+void sha3_384_inc_absorb_inline(sha3_384incctx_inline *state, const uint8_t *input, size_t inlen) {
+    keccak_inc_absorb(state->ctx, SHA3_384_RATE, input, inlen);
+}
+
+void sha3_384_inc_finalize_inline(uint8_t *output, sha3_384incctx_inline *state) {
+    uint8_t t[SHA3_384_RATE];
+    keccak_inc_finalize(state->ctx, SHA3_384_RATE, 0x06);
+
+    keccak_squeezeblocks(t, 1, state->ctx, SHA3_384_RATE);
+
+    for (size_t i = 0; i < 48; i++) {
+        output[i] = t[i];
+    }
+}
+
+void sha3_384_inc_ctx_clone_inline(sha3_384incctx_inline *dest, const sha3_384incctx_inline *src) {
+    memcpy(dest->ctx, src->ctx, PQC_SHAKEINCCTX_BYTES);
+}
+
+void sha3_512_inc_init_inline(sha3_512incctx_inline *state) {
+    keccak_inc_init(state->ctx);
+}
+
+void sha3_512_inc_absorb_inline(sha3_512incctx_inline *state, const uint8_t *input, size_t inlen) {
+    keccak_inc_absorb(state->ctx, SHA3_512_RATE, input, inlen);
+}
+
+void sha3_512_inc_finalize_inline(uint8_t *output, sha3_512incctx_inline *state) {
+    uint8_t t[SHA3_512_RATE];
+    keccak_inc_finalize(state->ctx, SHA3_512_RATE, 0x06);
+
+    keccak_squeezeblocks(t, 1, state->ctx, SHA3_512_RATE);
+
+    for (size_t i = 0; i < 64; i++) {
+        output[i] = t[i];
+    }
+}
+
+void sha3_512_inc_ctx_clone_inline(sha3_512incctx_inline *dest, const sha3_512incctx_inline *src) {
+    memcpy(dest->ctx, src->ctx, PQC_SHAKEINCCTX_BYTES);
+}
+
+/* ====== Batched API over independent messages ====== */
+
+#define KECCAK_BATCH_MAXWAYS 8
+
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+#define ROL64x4(a, offset) _mm256_or_si256(_mm256_slli_epi64(a, offset), _mm256_srli_epi64(a, 64 - (offset)))
+
+/*************************************************
+ * Name:        KeccakF1600_StatePermutex4_avx2
+ *
+ * Description: Four Keccak F1600 Permutations on interleaved states
+ *              using AVX2
+ *
+ * Arguments:   - uint64_t *state: pointer to input/output states;
+ *                lane i of instance j is state[4*i + j]
+ **************************************************/
+__attribute__((target("avx2")))
+static void KeccakF1600_StatePermutex4_avx2(uint64_t *state) {
+    __m256i A[25], B[25], C[5], D[5];
+    int round, i;
+
+    for (i = 0; i < 25; i++) {
+        A[i] = _mm256_loadu_si256((const __m256i *)(state + 4 * i));
+    }
+    for (round = 0; round < NROUNDS; round++) {
+        C[0] = _mm256_xor_si256(_mm256_xor_si256(A[0], A[5]), _mm256_xor_si256(_mm256_xor_si256(A[10], A[15]), A[20]));
+        C[1] = _mm256_xor_si256(_mm256_xor_si256(A[1], A[6]), _mm256_xor_si256(_mm256_xor_si256(A[11], A[16]), A[21]));
+        C[2] = _mm256_xor_si256(_mm256_xor_si256(A[2], A[7]), _mm256_xor_si256(_mm256_xor_si256(A[12], A[17]), A[22]));
+        C[3] = _mm256_xor_si256(_mm256_xor_si256(A[3], A[8]), _mm256_xor_si256(_mm256_xor_si256(A[13], A[18]), A[23]));
+        C[4] = _mm256_xor_si256(_mm256_xor_si256(A[4], A[9]), _mm256_xor_si256(_mm256_xor_si256(A[14], A[19]), A[24]));
+        D[0] = _mm256_xor_si256(C[4], ROL64x4(C[1], 1));
+        D[1] = _mm256_xor_si256(C[0], ROL64x4(C[2], 1));
+        D[2] = _mm256_xor_si256(C[1], ROL64x4(C[3], 1));
+        D[3] = _mm256_xor_si256(C[2], ROL64x4(C[4], 1));
+        D[4] = _mm256_xor_si256(C[3], ROL64x4(C[0], 1));
+        B[0] = _mm256_xor_si256(A[0], D[0]);
+        B[10] = ROL64x4(_mm256_xor_si256(A[1], D[1]), 1);
+        B[20] = ROL64x4(_mm256_xor_si256(A[2], D[2]), 62);
+        B[5] = ROL64x4(_mm256_xor_si256(A[3], D[3]), 28);
+        B[15] = ROL64x4(_mm256_xor_si256(A[4], D[4]), 27);
+        B[16] = ROL64x4(_mm256_xor_si256(A[5], D[0]), 36);
+        B[1] = ROL64x4(_mm256_xor_si256(A[6], D[1]), 44);
+        B[11] = ROL64x4(_mm256_xor_si256(A[7], D[2]), 6);
+        B[21] = ROL64x4(_mm256_xor_si256(A[8], D[3]), 55);
+        B[6] = ROL64x4(_mm256_xor_si256(A[9], D[4]), 20);
+        B[7] = ROL64x4(_mm256_xor_si256(A[10], D[0]), 3);
+        B[17] = ROL64x4(_mm256_xor_si256(A[11], D[1]), 10);
+        B[2] = ROL64x4(_mm256_xor_si256(A[12], D[2]), 43);
+        B[12] = ROL64x4(_mm256_xor_si256(A[13], D[3]), 25);
+        B[22] = ROL64x4(_mm256_xor_si256(A[14], D[4]), 39);
+        B[23] = ROL64x4(_mm256_xor_si256(A[15], D[0]), 41);
+        B[8] = ROL64x4(_mm256_xor_si256(A[16], D[1]), 45);
+        B[18] = ROL64x4(_mm256_xor_si256(A[17], D[2]), 15);
+        B[3] = ROL64x4(_mm256_xor_si256(A[18], D[3]), 21);
+        B[13] = ROL64x4(_mm256_xor_si256(A[19], D[4]), 8);
+        B[14] = ROL64x4(_mm256_xor_si256(A[20], D[0]), 18);
+        B[24] = ROL64x4(_mm256_xor_si256(A[21], D[1]), 2);
+        B[9] = ROL64x4(_mm256_xor_si256(A[22], D[2]), 61);
+        B[19] = ROL64x4(_mm256_xor_si256(A[23], D[3]), 56);
+        B[4] = ROL64x4(_mm256_xor_si256(A[24], D[4]), 14);
+        A[0] = _mm256_xor_si256(B[0], _mm256_andnot_si256(B[1], B[2]));
+        A[1] = _mm256_xor_si256(B[1], _mm256_andnot_si256(B[2], B[3]));
+        A[2] = _mm256_xor_si256(B[2], _mm256_andnot_si256(B[3], B[4]));
+        A[3] = _mm256_xor_si256(B[3], _mm256_andnot_si256(B[4], B[0]));
+        A[4] = _mm256_xor_si256(B[4], _mm256_andnot_si256(B[0], B[1]));
+        A[5] = _mm256_xor_si256(B[5], _mm256_andnot_si256(B[6], B[7]));
+        A[6] = _mm256_xor_si256(B[6], _mm256_andnot_si256(B[7], B[8]));
+        A[7] = _mm256_xor_si256(B[7], _mm256_andnot_si256(B[8], B[9]));
+        A[8] = _mm256_xor_si256(B[8], _mm256_andnot_si256(B[9], B[5]));
+        A[9] = _mm256_xor_si256(B[9], _mm256_andnot_si256(B[5], B[6]));
+        A[10] = _mm256_xor_si256(B[10], _mm256_andnot_si256(B[11], B[12]));
+        A[11] = _mm256_xor_si256(B[11], _mm256_andnot_si256(B[12], B[13]));
+        A[12] = _mm256_xor_si256(B[12], _mm256_andnot_si256(B[13], B[14]));
+        A[13] = _mm256_xor_si256(B[13], _mm256_andnot_si256(B[14], B[10]));
+        A[14] = _mm256_xor_si256(B[14], _mm256_andnot_si256(B[10], B[11]));
+        A[15] = _mm256_xor_si256(B[15], _mm256_andnot_si256(B[16], B[17]));
+        A[16] = _mm256_xor_si256(B[16], _mm256_andnot_si256(B[17], B[18]));
+        A[17] = _mm256_xor_si256(B[17], _mm256_andnot_si256(B[18], B[19]));
+        A[18] = _mm256_xor_si256(B[18], _mm256_andnot_si256(B[19], B[15]));
+        A[19] = _mm256_xor_si256(B[19], _mm256_andnot_si256(B[15], B[16]));
+        A[20] = _mm256_xor_si256(B[20], _mm256_andnot_si256(B[21], B[22]));
+        A[21] = _mm256_xor_si256(B[21], _mm256_andnot_si256(B[22], B[23]));
+        A[22] = _mm256_xor_si256(B[22], _mm256_andnot_si256(B[23], B[24]));
+        A[23] = _mm256_xor_si256(B[23], _mm256_andnot_si256(B[24], B[20]));
+        A[24] = _mm256_xor_si256(B[24], _mm256_andnot_si256(B[20], B[21]));
+        A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x((long long)KeccakF_RoundConstants[round]));
+    }
+    for (i = 0; i < 25; i++) {
+        _mm256_storeu_si256((__m256i *)(state + 4 * i), A[i]);
+    }
+}
+
+/*************************************************
+ * Name:        KeccakF1600_StatePermutex8_avx512
+ *
+ * Description: Eight Keccak F1600 Permutations on interleaved states
+ *              using AVX-512F
+ *
+ * Arguments:   - uint64_t *state: pointer to input/output states;
+ *                lane i of instance j is state[8*i + j]
+ **************************************************/
+__attribute__((target("avx512f")))
+static void KeccakF1600_StatePermutex8_avx512(uint64_t *state) {
+    __m512i A[25], B[25], C[5], D[5];
+    int round, i;
+
+    for (i = 0; i < 25; i++) {
+        A[i] = _mm512_loadu_si512((const void *)(state + 8 * i));
+    }
+    for (round = 0; round < NROUNDS; round++) {
+        C[0] = _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(A[0], A[5], A[10], 0x96), A[15], A[20], 0x96);
+        C[1] = _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(A[1], A[6], A[11], 0x96), A[16], A[21], 0x96);
+        C[2] = _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(A[2], A[7], A[12], 0x96), A[17], A[22], 0x96);
+        C[3] = _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(A[3], A[8], A[13], 0x96), A[18], A[23], 0x96);
+        C[4] = _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(A[4], A[9], A[14], 0x96), A[19], A[24], 0x96);
+        D[0] = _mm512_xor_si512(C[4], _mm512_rol_epi64(C[1], 1));
+        D[1] = _mm512_xor_si512(C[0], _mm512_rol_epi64(C[2], 1));
+        D[2] = _mm512_xor_si512(C[1], _mm512_rol_epi64(C[3], 1));
+        D[3] = _mm512_xor_si512(C[2], _mm512_rol_epi64(C[4], 1));
+        D[4] = _mm512_xor_si512(C[3], _mm512_rol_epi64(C[0], 1));
+        B[0] = _mm512_xor_si512(A[0], D[0]);
+        B[10] = _mm512_rol_epi64(_mm512_xor_si512(A[1], D[1]), 1);
+        B[20] = _mm512_rol_epi64(_mm512_xor_si512(A[2], D[2]), 62);
+        B[5] = _mm512_rol_epi64(_mm512_xor_si512(A[3], D[3]), 28);
+        B[15] = _mm512_rol_epi64(_mm512_xor_si512(A[4], D[4]), 27);
+        B[16] = _mm512_rol_epi64(_mm512_xor_si512(A[5], D[0]), 36);
+        B[1] = _mm512_rol_epi64(_mm512_xor_si512(A[6], D[1]), 44);
+        B[11] = _mm512_rol_epi64(_mm512_xor_si512(A[7], D[2]), 6);
+        B[21] = _mm512_rol_epi64(_mm512_xor_si512(A[8], D[3]), 55);
+        B[6] = _mm512_rol_epi64(_mm512_xor_si512(A[9], D[4]), 20);
+        B[7] = _mm512_rol_epi64(_mm512_xor_si512(A[10], D[0]), 3);
+        B[17] = _mm512_rol_epi64(_mm512_xor_si512(A[11], D[1]), 10);
+        B[2] = _mm512_rol_epi64(_mm512_xor_si512(A[12], D[2]), 43);
+        B[12] = _mm512_rol_epi64(_mm512_xor_si512(A[13], D[3]), 25);
+        B[22] = _mm512_rol_epi64(_mm512_xor_si512(A[14], D[4]), 39);
+        B[23] = _mm512_rol_epi64(_mm512_xor_si512(A[15], D[0]), 41);
+        B[8] = _mm512_rol_epi64(_mm512_xor_si512(A[16], D[1]), 45);
+        B[18] = _mm512_rol_epi64(_mm512_xor_si512(A[17], D[2]), 15);
+        B[3] = _mm512_rol_epi64(_mm512_xor_si512(A[18], D[3]), 21);
+        B[13] = _mm512_rol_epi64(_mm512_xor_si512(A[19], D[4]), 8);
+        B[14] = _mm512_rol_epi64(_mm512_xor_si512(A[20], D[0]), 18);
+        B[24] = _mm512_rol_epi64(_mm512_xor_si512(A[21], D[1]), 2);
+        B[9] = _mm512_rol_epi64(_mm512_xor_si512(A[22], D[2]), 61);
+        B[19] = _mm512_rol_epi64(_mm512_xor_si512(A[23], D[3]), 56);
+        B[4] = _mm512_rol_epi64(_mm512_xor_si512(A[24], D[4]), 14);
+        A[0] = _mm512_ternarylogic_epi64(B[0], B[1], B[2], 0xD2);
+        A[1] = _mm512_ternarylogic_epi64(B[1], B[2], B[3], 0xD2);
+        A[2] = _mm512_ternarylogic_epi64(B[2], B[3], B[4], 0xD2);
+        A[3] = _mm512_ternarylogic_epi64(B[3], B[4], B[0], 0xD2);
+        A[4] = _mm512_ternarylogic_epi64(B[4], B[0], B[1], 0xD2);
+        A[5] = _mm512_ternarylogic_epi64(B[5], B[6], B[7], 0xD2);
+        A[6] = _mm512_ternarylogic_epi64(B[6], B[7], B[8], 0xD2);
+        A[7] = _mm512_ternarylogic_epi64(B[7], B[8], B[9], 0xD2);
+        A[8] = _mm512_ternarylogic_epi64(B[8], B[9], B[5], 0xD2);
+        A[9] = _mm512_ternarylogic_epi64(B[9], B[5], B[6], 0xD2);
+        A[10] = _mm512_ternarylogic_epi64(B[10], B[11], B[12], 0xD2);
+        A[11] = _mm512_ternarylogic_epi64(B[11], B[12], B[13], 0xD2);
+        A[12] = _mm512_ternarylogic_epi64(B[12], B[13], B[14], 0xD2);
+        A[13] = _mm512_ternarylogic_epi64(B[13], B[14], B[10], 0xD2);
+        A[14] = _mm512_ternarylogic_epi64(B[14], B[10], B[11], 0xD2);
+        A[15] = _mm512_ternarylogic_epi64(B[15], B[16], B[17], 0xD2);
+        A[16] = _mm512_ternarylogic_epi64(B[16], B[17], B[18], 0xD2);
+        A[17] = _mm512_ternarylogic_epi64(B[17], B[18], B[19], 0xD2);
+        A[18] = _mm512_ternarylogic_epi64(B[18], B[19], B[15], 0xD2);
+        A[19] = _mm512_ternarylogic_epi64(B[19], B[15], B[16], 0xD2);
+        A[20] = _mm512_ternarylogic_epi64(B[20], B[21], B[22], 0xD2);
+        A[21] = _mm512_ternarylogic_epi64(B[21], B[22], B[23], 0xD2);
+        A[22] = _mm512_ternarylogic_epi64(B[22], B[23], B[24], 0xD2);
+        A[23] = _mm512_ternarylogic_epi64(B[23], B[24], B[20], 0xD2);
+        A[24] = _mm512_ternarylogic_epi64(B[24], B[20], B[21], 0xD2);
+        A[0] = _mm512_xor_si512(A[0], _mm512_set1_epi64((long long)KeccakF_RoundConstants[round]));
+    }
+    for (i = 0; i < 25; i++) {
+        _mm512_storeu_si512((void *)(state + 8 * i), A[i]);
+    }
+}
+#endif
+
+static unsigned int keccak_batch_ways;
+
+/*************************************************
+ * Name:        keccak_batch_select
+ *
+ * Description: Picks the widest interleaved permutation supported by the
+ *              running CPU; falls back to one state at a time. The choice
+ *              is cached with a relaxed atomic store.
+ *
+ * Returns the number of interleaved states (1, 4 or 8)
+ **************************************************/
+static unsigned int keccak_batch_select(void) {
+    unsigned int ways = 1;
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+    if (pqclean_cpu_supports(PQC_CPU_AVX512F)) {
+        ways = 8;
+    } else if (pqclean_cpu_supports(PQC_CPU_AVX2)) {
+        ways = 4;
+    }
+#endif
+    PQCLEAN_DISPATCH_STORE(&keccak_batch_ways, ways);
+    return ways;
+}
+
+/*************************************************
+ * Name:        keccak_batch
+ *
+ * Description: Absorbs n independent messages and squeezes outlen bytes
+ *              from each, running up to KECCAK_BATCH_MAXWAYS instances
+ *              through one interleaved permutation. Each lane works through
+ *              its message one block per permutation and is handed the
+ *              next message once its output is complete. Message i is
+ *              pre[i] || in[i].
+ *
+ * Arguments:   - uint8_t *const *out: pointers to the n output buffers
+ *              - size_t outlen: number of bytes to write to each output
+ *              - const uint8_t *const *pre: pointers to the n prefixes,
+ *                                           or NULL for no prefixes
+ *              - size_t prelen: length of each prefix in bytes
+ *              - const uint8_t *const *in: pointers to the n inputs
+ *              - const size_t *inlen: lengths of the n inputs in bytes
+ *              - size_t n: number of messages
+ *              - uint32_t r: rate in bytes (e.g., 168 for SHAKE128)
+ *              - uint8_t p: domain-separation byte for different
+ *                           Keccak-derived functions
+ **************************************************/
+static void keccak_batch(uint8_t *const *out, size_t outlen,
+                         const uint8_t *const *pre, size_t prelen,
+                         const uint8_t *const *in, const size_t *inlen,
+                         size_t n, uint32_t r, uint8_t p) {
+    uint64_t s[25 * KECCAK_BATCH_MAXWAYS];
+    const uint8_t *lane_pre[KECCAK_BATCH_MAXWAYS];
+    size_t lane_prelen[KECCAK_BATCH_MAXWAYS];
+    const uint8_t *lane_in[KECCAK_BATCH_MAXWAYS];
+    size_t lane_inlen[KECCAK_BATCH_MAXWAYS];
+    uint8_t *lane_out[KECCAK_BATCH_MAXWAYS];
+    size_t lane_outlen[KECCAK_BATCH_MAXWAYS];
+    int lane_state[KECCAK_BATCH_MAXWAYS]; // 0: idle, 1: absorbing, 2: squeezing
+    uint8_t t[200];
+    size_t next = 0, i, k;
+    unsigned int ways, j, busy;
+
+    void (*permute)(uint64_t *) = KeccakF1600_StatePermute;
+
+    ways = PQCLEAN_DISPATCH_LOAD(&keccak_batch_ways);
+    if (ways == 0) {
+        ways = keccak_batch_select();
+    }
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+    if (ways == 8) {
+        permute = KeccakF1600_StatePermutex8_avx512;
+    } else if (ways == 4) {
+        permute = KeccakF1600_StatePermutex4_avx2;
+    }
+#endif
+
+    for (j = 0; j < ways; j++) {
+        lane_state[j] = 0;
+    }
+
+    for (;;) {
+        busy = 0;
+        for (j = 0; j < ways; j++) {
+            if (lane_state[j] == 0 && next < n) {
+                lane_pre[j] = pre != NULL ? pre[next] : NULL;
+                lane_prelen[j] = pre != NULL ? prelen : 0;
+                lane_in[j] = in[next];
+                lane_inlen[j] = inlen[next];
+                lane_out[j] = out[next];
+                lane_outlen[j] = outlen;
+                lane_state[j] = 1;
+                next++;
+                for (i = 0; i < 25; i++) {
+                    s[ways * i + j] = 0;
+                }
+            }
+            if (lane_state[j] == 1) {
+                const uint8_t *block = lane_in[j];
+                if (lane_prelen[j] == 0 && lane_inlen[j] >= r) {
+                    lane_in[j] += r;
+                    lane_inlen[j] -= r;
+                } else if (lane_prelen[j] + lane_inlen[j] >= r) {
+                    // the block straddles the end of the prefix
+                    k = lane_prelen[j] < r ? lane_prelen[j] : r;
+                    memcpy(t, lane_pre[j], k);
+                    lane_pre[j] += k;
+                    lane_prelen[j] -= k;
+                    memcpy(t + k, lane_in[j], r - k);
+                    lane_in[j] += r - k;
+                    lane_inlen[j] -= r - k;
+                    block = t;
+                } else {
+                    memset(t, 0, r);
+                    if (lane_prelen[j] > 0) {
+                        memcpy(t, lane_pre[j], lane_prelen[j]);
+                    }
+                    memcpy(t + lane_prelen[j], lane_in[j], lane_inlen[j]);
+                    t[lane_prelen[j] + lane_inlen[j]] = p;
+                    t[r - 1] |= 128;
+                    block = t;
+                    lane_state[j] = 2;
+                }
+                for (i = 0; i < r / 8; i++) {
+                    s[ways * i + j] ^= load64(block + 8 * i);
+                }
+            }
+            if (lane_state[j] != 0) {
+                busy++;
+            }
+        }
+        if (busy == 0) {
+            break;
+        }
+
+        permute(s);
+
+        for (j = 0; j < ways; j++) {
+            if (lane_state[j] == 2) {
+                size_t len = lane_outlen[j] < r ? lane_outlen[j] : r;
+                for (i = 0; i < (len + 7) / 8; i++) {
+                    store64(t + 8 * i, s[ways * i + j]);
+                }
+                memcpy(lane_out[j], t, len);
+                lane_out[j] += len;
+                lane_outlen[j] -= len;
+                if (lane_outlen[j] == 0) {
+                    lane_state[j] = 0;
+                }
+            }
+        }
+    }
+}
+
+void shake128_batch(uint8_t *const *out, size_t outlen,
+                    const uint8_t *const *in, const size_t *inlen, size_t n) {
+    keccak_batch(out, outlen, NULL, 0, in, inlen, n, SHAKE128_RATE, 0x1F);
+}
+
+void shake256_batch(uint8_t *const *out, size_t outlen,
+                    const uint8_t *const *in, const size_t *inlen, size_t n) {
+    keccak_batch(out, outlen, NULL, 0, in, inlen, n, SHAKE256_RATE, 0x1F);
+}
+
+void shake256_batch_prefixed(uint8_t *const *out, size_t outlen,
+                             const uint8_t *const *pre, size_t prelen,
+                             const uint8_t *const *in, const size_t *inlen, size_t n) {
+    keccak_batch(out, outlen, pre, prelen, in, inlen, n, SHAKE256_RATE, 0x1F);
+}
+
+void sha3_256_batch(uint8_t *const *out,
+                    const uint8_t *const *in, const size_t *inlen, size_t n) {
+    keccak_batch(out, 32, NULL, 0, in, inlen, n, SHA3_256_RATE, 0x06);
+}
+
+void sha3_512_batch(uint8_t *const *out,
+                    const uint8_t *const *in, const size_t *inlen, size_t n) {
+    keccak_batch(out, 64, NULL, 0, in, inlen, n, SHA3_512_RATE, 0x06);
+}
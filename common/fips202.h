@@ -49,6 +49,40 @@ typedef struct {
     uint64_t* ctx;
 } sha3_512incctx;
 
+/* Inline (caller-owned) contexts.
+ *
+ * These hold the Keccak state by value instead of behind a heap pointer,
+ * so they can be placed on the stack or in an arena. They are used with
+ * the *_inline functions below and never need to be released.
+ */
+typedef struct {
+    uint64_t ctx[PQC_SHAKEINCCTX_BYTES / sizeof(uint64_t)];
+} shake128incctx_inline;
+
+typedef struct {
+    uint64_t ctx[PQC_SHAKECTX_BYTES / sizeof(uint64_t)];
+} shake128ctx_inline;
+
+typedef struct {
+    uint64_t ctx[PQC_SHAKEINCCTX_BYTES / sizeof(uint64_t)];
+} shake256incctx_inline;
+
+typedef struct {
+    uint64_t ctx[PQC_SHAKECTX_BYTES / sizeof(uint64_t)];
+} shake256ctx_inline;
+
+typedef struct {
+    uint64_t ctx[PQC_SHAKEINCCTX_BYTES / sizeof(uint64_t)];
+} sha3_256incctx_inline;
+
+typedef struct {
+    uint64_t ctx[PQC_SHAKEINCCTX_BYTES / sizeof(uint64_t)];
+} sha3_384incctx_inline;
+
+typedef struct {
+    uint64_t ctx[PQC_SHAKEINCCTX_BYTES / sizeof(uint64_t)];
+} sha3_512incctx_inline;
+
 /* Initialize the state and absorb the provided input.
  *
  * This function does not support being called multiple times
@@ -164,4 +198,72 @@ void sha3_512_inc_ctx_release(sha3_512incctx *state);
 /* One-stop SHA3-512 shop */
 void sha3_512(uint8_t *output, const uint8_t *input, size_t inlen);
 
+/* ====== Allocation-free API on inline contexts ====== */
+
+/* Same semantics as the functions above without the _inline suffix, but
+ * operating on caller-owned contexts. None of these allocate memory, and
+ * there is no _release: the context can simply go out of scope.
+ */
+
+void shake128_absorb_inline(shake128ctx_inline *state, const uint8_t *input, size_t inlen);
+void shake128_squeezeblocks_inline(uint8_t *output, size_t nblocks, shake128ctx_inline *state);
+void shake128_ctx_clone_inline(shake128ctx_inline *dest, const shake128ctx_inline *src);
+
+void shake128_inc_init_inline(shake128incctx_inline *state);
+void shake128_inc_absorb_inline(shake128incctx_inline *state, const uint8_t *input, size_t inlen);
+void shake128_inc_finalize_inline(shake128incctx_inline *state);
+void shake128_inc_squeeze_inline(uint8_t *output, size_t outlen, shake128incctx_inline *state);
+void shake128_inc_ctx_clone_inline(shake128incctx_inline *dest, const shake128incctx_inline *src);
+
+void shake256_absorb_inline(shake256ctx_inline *state, const uint8_t *input, size_t inlen);
+void shake256_squeezeblocks_inline(uint8_t *output, size_t nblocks, shake256ctx_inline *state);
+void shake256_ctx_clone_inline(shake256ctx_inline *dest, const shake256ctx_inline *src);
+
+void shake256_inc_init_inline(shake256incctx_inline *state);
+void shake256_inc_absorb_inline(shake256incctx_inline *state, const uint8_t *input, size_t inlen);
+void shake256_inc_finalize_inline(shake256incctx_inline *state);
+void shake256_inc_squeeze_inline(uint8_t *output, size_t outlen, shake256incctx_inline *state);
+void shake256_inc_ctx_clone_inline(shake256incctx_inline *dest, const shake256incctx_inline *src);
+
+void sha3_256_inc_init_inline(sha3_256incctx_inline *state);
+void sha3_256_inc_absorb_inline(sha3_256incctx_inline *state, const uint8_t *input, size_t inlen);
+void sha3_256_inc_finalize_inline(uint8_t *output, sha3_256incctx_inline *state);
+void sha3_256_inc_ctx_clone_inline(sha3_256incctx_inline *dest, const sha3_256incctx_inline *src);
+
+void sha3_384_inc_init_inline(sha3_384incctx_inline *state);
+void sha3_384_inc_absorb_inline(sha3_384incctx_inline *state, const uint8_t *input, size_t inlen);
+void sha3_384_inc_finalize_inline(uint8_t *output, sha3_384incctx_inline *state);
+void sha3_384_inc_ctx_clone_inline(sha3_384incctx_inline *dest, const sha3_384incctx_inline *src);
+
+void sha3_512_inc_init_inline(sha3_512incctx_inline *state);
+void sha3_512_inc_absorb_inline(sha3_512incctx_inline *state, const uint8_t *input, size_t inlen);
+void sha3_512_inc_finalize_inline(uint8_t *output, sha3_512incctx_inline *state);
+void sha3_512_inc_ctx_clone_inline(sha3_512incctx_inline *dest, const sha3_512incctx_inline *src);
+
+
+/* ====== Batched API over independent messages ====== */
+
+/* Hash n independent messages in[i] of inlen[i] bytes each into out[i].
+ * The messages may have different lengths. They are interleaved onto an
+ * 8-way (AVX-512) or 4-way (AVX2) Keccak permutation when the CPU supports
+ * it; a lane is refilled with the next message as soon as its previous
+ * message is done. Results are identical to calling the one-shot function
+ * on each message. Does not allocate memory.
+ */
+void shake128_batch(uint8_t *const *out, size_t outlen,
+                    const uint8_t *const *in, const size_t *inlen, size_t n);
+void shake256_batch(uint8_t *const *out, size_t outlen,
+                    const uint8_t *const *in, const size_t *inlen, size_t n);
+/* As shake256_batch, but message i is pre[i] || in[i], with all prefixes
+ * prelen bytes long. Saves the caller from concatenating, e.g., a key hash
+ * and a message of arbitrary length.
+ */
+void shake256_batch_prefixed(uint8_t *const *out, size_t outlen,
+                             const uint8_t *const *pre, size_t prelen,
+                             const uint8_t *const *in, const size_t *inlen, size_t n);
+void sha3_256_batch(uint8_t *const *out,
+                    const uint8_t *const *in, const size_t *inlen, size_t n);
+void sha3_512_batch(uint8_t *const *out,
+                    const uint8_t *const *in, const size_t *inlen, size_t n);
+
 #endif
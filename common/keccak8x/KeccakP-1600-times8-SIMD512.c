@@ -0,0 +1,754 @@
+/*
+Implementation by Gilles Van Assche and Ronny Van Keer, hereby denoted as "the implementer".
+
+For more information, feedback or questions, please refer to our website:
+https://keccak.team/
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file implements Keccak-p[1600]×8 in a PlSnP-compatible way.
+Please refer to PlSnP-documentation.h for more details.
+
+This implementation comes with KeccakP-1600-times8-SnP.h in the same folder.
+It mirrors KeccakP-1600-times4-SIMD256.c, with the eight instances
+interleaved lane by lane in 512-bit registers, vpternlogq for theta and
+chi, vprolq for rho and gathers/scatters for the lane-parallel I/O.
+*/
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "align.h"
+#include "KeccakP-1600-times8-SnP.h"
+#include "SIMD512-config.h"
+
+#include "brg_endian.h"
+#if (PLATFORM_BYTE_ORDER != IS_LITTLE_ENDIAN)
+#error Expecting a little-endian platform
+#endif
+
+typedef unsigned char UINT8;
+typedef unsigned long long int UINT64;
+typedef __m256i V256;
+typedef __m512i V512;
+
+#define laneIndex(instanceIndex, lanePosition) ((lanePosition)*8 + instanceIndex)
+
+#if defined(KeccakP1600times8_useAVX512)
+    #define CHI512(a, b, c)         _mm512_ternarylogic_epi64(a, b, c, 0xD2)
+    #define CONST512_64(a)          _mm512_set1_epi64(a)
+    #define LOAD512(a)              _mm512_load_si512((const V512 *)&(a))
+    #define LOAD_GATHER8_64(idx, p) _mm512_i32gather_epi64(idx, (const void *)(p), 8)
+    #define ROL64in512(d, a, o)     d = _mm512_rol_epi64(a, o)
+    #define STORE512(a, b)          _mm512_store_si512((V512 *)&(a), b)
+    #define STORE_SCATTER8_64(p, idx, v) _mm512_i32scatter_epi64((void *)(p), idx, v, 8)
+    #define XOR512(a, b)            _mm512_xor_si512(a, b)
+    #define XOReq512(a, b)          a = _mm512_xor_si512(a, b)
+    #define XOR5_512(a, b, c, d, e) _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(a, b, c, 0x96), d, e, 0x96)
+    #define LANEOFFSETS(o)          _mm256_setr_epi32(0, (int)(o), (int)(2*(o)), (int)(3*(o)), (int)(4*(o)), (int)(5*(o)), (int)(6*(o)), (int)(7*(o)))
+#endif
+
+#define SnP_laneLengthInBytes 8
+
+void KeccakP1600times8_InitializeAll(void *states)
+{
+    memset(states, 0, KeccakP1600times8_statesSizeInBytes);
+}
+
+void KeccakP1600times8_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length)
+{
+    unsigned int sizeLeft = length;
+    unsigned int lanePosition = offset/SnP_laneLengthInBytes;
+    unsigned int offsetInLane = offset%SnP_laneLengthInBytes;
+    const unsigned char *curData = data;
+    UINT64 *statesAsLanes = (UINT64 *)states;
+
+    if ((sizeLeft > 0) && (offsetInLane != 0)) {
+        unsigned int bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+        UINT64 lane = 0;
+        if (bytesInLane > sizeLeft)
+            bytesInLane = sizeLeft;
+        memcpy((unsigned char*)&lane + offsetInLane, curData, bytesInLane);
+        statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+        sizeLeft -= bytesInLane;
+        lanePosition++;
+        curData += bytesInLane;
+    }
+
+    while(sizeLeft >= SnP_laneLengthInBytes) {
+        UINT64 lane = *((const UINT64*)curData);
+        statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+        sizeLeft -= SnP_laneLengthInBytes;
+        lanePosition++;
+        curData += SnP_laneLengthInBytes;
+    }
+
+    if (sizeLeft > 0) {
+        UINT64 lane = 0;
+        memcpy(&lane, curData, sizeLeft);
+        statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+    }
+}
+
+void KeccakP1600times8_AddLanesAll(void *states, const unsigned char *data, unsigned int laneCount, unsigned int laneOffset)
+{
+    V512 *stateAsLanes = (V512 *)states;
+    const UINT64 *curData = (const UINT64 *)data;
+    const V256 offsets = LANEOFFSETS(laneOffset);
+    unsigned int i;
+
+    for(i=0; i<laneCount; i++)
+        XOReq512(stateAsLanes[i], LOAD_GATHER8_64(offsets, curData + i));
+}
+
+void KeccakP1600times8_OverwriteBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length)
+{
+    unsigned int sizeLeft = length;
+    unsigned int lanePosition = offset/SnP_laneLengthInBytes;
+    unsigned int offsetInLane = offset%SnP_laneLengthInBytes;
+    const unsigned char *curData = data;
+    UINT64 *statesAsLanes = (UINT64 *)states;
+
+    if ((sizeLeft > 0) && (offsetInLane != 0)) {
+        unsigned int bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+        if (bytesInLane > sizeLeft)
+            bytesInLane = sizeLeft;
+        memcpy( ((unsigned char *)&statesAsLanes[laneIndex(instanceIndex, lanePosition)]) + offsetInLane, curData, bytesInLane);
+        sizeLeft -= bytesInLane;
+        lanePosition++;
+        curData += bytesInLane;
+    }
+
+    while(sizeLeft >= SnP_laneLengthInBytes) {
+        UINT64 lane = *((const UINT64*)curData);
+        statesAsLanes[laneIndex(instanceIndex, lanePosition)] = lane;
+        sizeLeft -= SnP_laneLengthInBytes;
+        lanePosition++;
+        curData += SnP_laneLengthInBytes;
+    }
+
+    if (sizeLeft > 0) {
+        memcpy(&statesAsLanes[laneIndex(instanceIndex, lanePosition)], curData, sizeLeft);
+    }
+}
+
+void KeccakP1600times8_OverwriteLanesAll(void *states, const unsigned char *data, unsigned int laneCount, unsigned int laneOffset)
+{
+    V512 *stateAsLanes = (V512 *)states;
+    const UINT64 *curData = (const UINT64 *)data;
+    const V256 offsets = LANEOFFSETS(laneOffset);
+    unsigned int i;
+
+    for(i=0; i<laneCount; i++)
+        STORE512(stateAsLanes[i], LOAD_GATHER8_64(offsets, curData + i));
+}
+
+void KeccakP1600times8_OverwriteWithZeroes(void *states, unsigned int instanceIndex, unsigned int byteCount)
+{
+    unsigned int sizeLeft = byteCount;
+    unsigned int lanePosition = 0;
+    UINT64 *statesAsLanes = (UINT64 *)states;
+
+    while(sizeLeft >= SnP_laneLengthInBytes) {
+        statesAsLanes[laneIndex(instanceIndex, lanePosition)] = 0;
+        sizeLeft -= SnP_laneLengthInBytes;
+        lanePosition++;
+    }
+
+    if (sizeLeft > 0) {
+        memset(&statesAsLanes[laneIndex(instanceIndex, lanePosition)], 0, sizeLeft);
+    }
+}
+
+void KeccakP1600times8_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length)
+{
+    unsigned int sizeLeft = length;
+    unsigned int lanePosition = offset/SnP_laneLengthInBytes;
+    unsigned int offsetInLane = offset%SnP_laneLengthInBytes;
+    unsigned char *curData = data;
+    const UINT64 *statesAsLanes = (const UINT64 *)states;
+
+    if ((sizeLeft > 0) && (offsetInLane != 0)) {
+        unsigned int bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+        if (bytesInLane > sizeLeft)
+            bytesInLane = sizeLeft;
+        memcpy( curData, ((unsigned char *)&statesAsLanes[laneIndex(instanceIndex, lanePosition)]) + offsetInLane, bytesInLane);
+        sizeLeft -= bytesInLane;
+        lanePosition++;
+        curData += bytesInLane;
+    }
+
+    while(sizeLeft >= SnP_laneLengthInBytes) {
+        *(UINT64*)curData = statesAsLanes[laneIndex(instanceIndex, lanePosition)];
+        sizeLeft -= SnP_laneLengthInBytes;
+        lanePosition++;
+        curData += SnP_laneLengthInBytes;
+    }
+
+    if (sizeLeft > 0) {
+        memcpy( curData, &statesAsLanes[laneIndex(instanceIndex, lanePosition)], sizeLeft);
+    }
+}
+
+void KeccakP1600times8_ExtractLanesAll(const void *states, unsigned char *data, unsigned int laneCount, unsigned int laneOffset)
+{
+    const V512 *stateAsLanes = (const V512 *)states;
+    UINT64 *curData = (UINT64 *)data;
+    const V256 offsets = LANEOFFSETS(laneOffset);
+    unsigned int i;
+
+    for(i=0; i<laneCount; i++)
+        STORE_SCATTER8_64(curData + i, offsets, LOAD512(stateAsLanes[i]));
+}
+
+void KeccakP1600times8_ExtractAndAddBytes(const void *states, unsigned int instanceIndex, const unsigned char *input, unsigned char *output, unsigned int offset, unsigned int length)
+{
+    unsigned int sizeLeft = length;
+    unsigned int lanePosition = offset/SnP_laneLengthInBytes;
+    unsigned int offsetInLane = offset%SnP_laneLengthInBytes;
+    const unsigned char *curInput = input;
+    unsigned char *curOutput = output;
+    const UINT64 *statesAsLanes = (const UINT64 *)states;
+
+    if ((sizeLeft > 0) && (offsetInLane != 0)) {
+        unsigned int bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+        UINT64 lane = statesAsLanes[laneIndex(instanceIndex, lanePosition)] >> (8 * offsetInLane);
+        if (bytesInLane > sizeLeft)
+            bytesInLane = sizeLeft;
+        sizeLeft -= bytesInLane;
+        do {
+            *(curOutput++) = *(curInput++) ^ (unsigned char)lane;
+            lane >>= 8;
+        } while ( --bytesInLane != 0);
+        lanePosition++;
+    }
+
+    while(sizeLeft >= SnP_laneLengthInBytes) {
+        *((UINT64*)curOutput) = *((UINT64*)curInput) ^ statesAsLanes[laneIndex(instanceIndex, lanePosition)];
+        sizeLeft -= SnP_laneLengthInBytes;
+        lanePosition++;
+        curInput += SnP_laneLengthInBytes;
+        curOutput += SnP_laneLengthInBytes;
+    }
+
+    if (sizeLeft != 0) {
+        UINT64 lane = statesAsLanes[laneIndex(instanceIndex, lanePosition)];
+        do {
+            *(curOutput++) = *(curInput++) ^ (unsigned char)lane;
+            lane >>= 8;
+        } while ( --sizeLeft != 0);
+    }
+}
+
+void KeccakP1600times8_ExtractAndAddLanesAll(const void *states, const unsigned char *input, unsigned char *output, unsigned int laneCount, unsigned int laneOffset)
+{
+    const V512 *stateAsLanes = (const V512 *)states;
+    const UINT64 *curInput = (const UINT64 *)input;
+    UINT64 *curOutput = (UINT64 *)output;
+    const V256 offsets = LANEOFFSETS(laneOffset);
+    unsigned int i;
+
+    for(i=0; i<laneCount; i++)
+        STORE_SCATTER8_64(curOutput + i, offsets, XOR512(LOAD512(stateAsLanes[i]), LOAD_GATHER8_64(offsets, curInput + i)));
+}
+
+#define declareABCDE \
+    V512 Aba, Abe, Abi, Abo, Abu; \
+    V512 Aga, Age, Agi, Ago, Agu; \
+    V512 Aka, Ake, Aki, Ako, Aku; \
+    V512 Ama, Ame, Ami, Amo, Amu; \
+    V512 Asa, Ase, Asi, Aso, Asu; \
+    V512 Bba, Bbe, Bbi, Bbo, Bbu; \
+    V512 Bga, Bge, Bgi, Bgo, Bgu; \
+    V512 Bka, Bke, Bki, Bko, Bku; \
+    V512 Bma, Bme, Bmi, Bmo, Bmu; \
+    V512 Bsa, Bse, Bsi, Bso, Bsu; \
+    V512 Ca, Ce, Ci, Co, Cu; \
+    V512 Ca1, Ce1, Ci1, Co1, Cu1; \
+    V512 Da, De, Di, Do, Du; \
+    V512 Eba, Ebe, Ebi, Ebo, Ebu; \
+    V512 Ega, Ege, Egi, Ego, Egu; \
+    V512 Eka, Eke, Eki, Eko, Eku; \
+    V512 Ema, Eme, Emi, Emo, Emu; \
+    V512 Esa, Ese, Esi, Eso, Esu; \
+
+#define prepareTheta \
+    Ca = XOR5_512(Aba, Aga, Aka, Ama, Asa); \
+    Ce = XOR5_512(Abe, Age, Ake, Ame, Ase); \
+    Ci = XOR5_512(Abi, Agi, Aki, Ami, Asi); \
+    Co = XOR5_512(Abo, Ago, Ako, Amo, Aso); \
+    Cu = XOR5_512(Abu, Agu, Aku, Amu, Asu); \
+
+/* --- Theta Rho Pi Chi Iota Prepare-theta */
+/* --- 64-bit lanes mapped to 64-bit words */
+#define thetaRhoPiChiIotaPrepareTheta(i, A, E) \
+    ROL64in512(Ce1, Ce, 1); \
+    Da = XOR512(Cu, Ce1); \
+    ROL64in512(Ci1, Ci, 1); \
+    De = XOR512(Ca, Ci1); \
+    ROL64in512(Co1, Co, 1); \
+    Di = XOR512(Ce, Co1); \
+    ROL64in512(Cu1, Cu, 1); \
+    Do = XOR512(Ci, Cu1); \
+    ROL64in512(Ca1, Ca, 1); \
+    Du = XOR512(Co, Ca1); \
+\
+    XOReq512(A##ba, Da); \
+    Bba = A##ba; \
+    XOReq512(A##ge, De); \
+    ROL64in512(Bbe, A##ge, 44); \
+    XOReq512(A##ki, Di); \
+    ROL64in512(Bbi, A##ki, 43); \
+    E##ba = CHI512(Bba, Bbe, Bbi); \
+    XOReq512(E##ba, CONST512_64(KeccakF1600RoundConstants[i])); \
+    Ca = E##ba; \
+    XOReq512(A##mo, Do); \
+    ROL64in512(Bbo, A##mo, 21); \
+    E##be = CHI512(Bbe, Bbi, Bbo); \
+    Ce = E##be; \
+    XOReq512(A##su, Du); \
+    ROL64in512(Bbu, A##su, 14); \
+    E##bi = CHI512(Bbi, Bbo, Bbu); \
+    Ci = E##bi; \
+    E##bo = CHI512(Bbo, Bbu, Bba); \
+    Co = E##bo; \
+    E##bu = CHI512(Bbu, Bba, Bbe); \
+    Cu = E##bu; \
+\
+    XOReq512(A##bo, Do); \
+    ROL64in512(Bga, A##bo, 28); \
+    XOReq512(A##gu, Du); \
+    ROL64in512(Bge, A##gu, 20); \
+    XOReq512(A##ka, Da); \
+    ROL64in512(Bgi, A##ka, 3); \
+    E##ga = CHI512(Bga, Bge, Bgi); \
+    XOReq512(Ca, E##ga); \
+    XOReq512(A##me, De); \
+    ROL64in512(Bgo, A##me, 45); \
+    E##ge = CHI512(Bge, Bgi, Bgo); \
+    XOReq512(Ce, E##ge); \
+    XOReq512(A##si, Di); \
+    ROL64in512(Bgu, A##si, 61); \
+    E##gi = CHI512(Bgi, Bgo, Bgu); \
+    XOReq512(Ci, E##gi); \
+    E##go = CHI512(Bgo, Bgu, Bga); \
+    XOReq512(Co, E##go); \
+    E##gu = CHI512(Bgu, Bga, Bge); \
+    XOReq512(Cu, E##gu); \
+\
+    XOReq512(A##be, De); \
+    ROL64in512(Bka, A##be, 1); \
+    XOReq512(A##gi, Di); \
+    ROL64in512(Bke, A##gi, 6); \
+    XOReq512(A##ko, Do); \
+    ROL64in512(Bki, A##ko, 25); \
+    E##ka = CHI512(Bka, Bke, Bki); \
+    XOReq512(Ca, E##ka); \
+    XOReq512(A##mu, Du); \
+    ROL64in512(Bko, A##mu, 8); \
+    E##ke = CHI512(Bke, Bki, Bko); \
+    XOReq512(Ce, E##ke); \
+    XOReq512(A##sa, Da); \
+    ROL64in512(Bku, A##sa, 18); \
+    E##ki = CHI512(Bki, Bko, Bku); \
+    XOReq512(Ci, E##ki); \
+    E##ko = CHI512(Bko, Bku, Bka); \
+    XOReq512(Co, E##ko); \
+    E##ku = CHI512(Bku, Bka, Bke); \
+    XOReq512(Cu, E##ku); \
+\
+    XOReq512(A##bu, Du); \
+    ROL64in512(Bma, A##bu, 27); \
+    XOReq512(A##ga, Da); \
+    ROL64in512(Bme, A##ga, 36); \
+    XOReq512(A##ke, De); \
+    ROL64in512(Bmi, A##ke, 10); \
+    E##ma = CHI512(Bma, Bme, Bmi); \
+    XOReq512(Ca, E##ma); \
+    XOReq512(A##mi, Di); \
+    ROL64in512(Bmo, A##mi, 15); \
+    E##me = CHI512(Bme, Bmi, Bmo); \
+    XOReq512(Ce, E##me); \
+    XOReq512(A##so, Do); \
+    ROL64in512(Bmu, A##so, 56); \
+    E##mi = CHI512(Bmi, Bmo, Bmu); \
+    XOReq512(Ci, E##mi); \
+    E##mo = CHI512(Bmo, Bmu, Bma); \
+    XOReq512(Co, E##mo); \
+    E##mu = CHI512(Bmu, Bma, Bme); \
+    XOReq512(Cu, E##mu); \
+\
+    XOReq512(A##bi, Di); \
+    ROL64in512(Bsa, A##bi, 62); \
+    XOReq512(A##go, Do); \
+    ROL64in512(Bse, A##go, 55); \
+    XOReq512(A##ku, Du); \
+    ROL64in512(Bsi, A##ku, 39); \
+    E##sa = CHI512(Bsa, Bse, Bsi); \
+    XOReq512(Ca, E##sa); \
+    XOReq512(A##ma, Da); \
+    ROL64in512(Bso, A##ma, 41); \
+    E##se = CHI512(Bse, Bsi, Bso); \
+    XOReq512(Ce, E##se); \
+    XOReq512(A##se, De); \
+    ROL64in512(Bsu, A##se, 2); \
+    E##si = CHI512(Bsi, Bso, Bsu); \
+    XOReq512(Ci, E##si); \
+    E##so = CHI512(Bso, Bsu, Bsa); \
+    XOReq512(Co, E##so); \
+    E##su = CHI512(Bsu, Bsa, Bse); \
+    XOReq512(Cu, E##su); \
+\
+
+/* --- Theta Rho Pi Chi Iota */
+/* --- 64-bit lanes mapped to 64-bit words */
+#define thetaRhoPiChiIota(i, A, E) \
+    ROL64in512(Ce1, Ce, 1); \
+    Da = XOR512(Cu, Ce1); \
+    ROL64in512(Ci1, Ci, 1); \
+    De = XOR512(Ca, Ci1); \
+    ROL64in512(Co1, Co, 1); \
+    Di = XOR512(Ce, Co1); \
+    ROL64in512(Cu1, Cu, 1); \
+    Do = XOR512(Ci, Cu1); \
+    ROL64in512(Ca1, Ca, 1); \
+    Du = XOR512(Co, Ca1); \
+\
+    XOReq512(A##ba, Da); \
+    Bba = A##ba; \
+    XOReq512(A##ge, De); \
+    ROL64in512(Bbe, A##ge, 44); \
+    XOReq512(A##ki, Di); \
+    ROL64in512(Bbi, A##ki, 43); \
+    E##ba = CHI512(Bba, Bbe, Bbi); \
+    XOReq512(E##ba, CONST512_64(KeccakF1600RoundConstants[i])); \
+    XOReq512(A##mo, Do); \
+    ROL64in512(Bbo, A##mo, 21); \
+    E##be = CHI512(Bbe, Bbi, Bbo); \
+    XOReq512(A##su, Du); \
+    ROL64in512(Bbu, A##su, 14); \
+    E##bi = CHI512(Bbi, Bbo, Bbu); \
+    E##bo = CHI512(Bbo, Bbu, Bba); \
+    E##bu = CHI512(Bbu, Bba, Bbe); \
+\
+    XOReq512(A##bo, Do); \
+    ROL64in512(Bga, A##bo, 28); \
+    XOReq512(A##gu, Du); \
+    ROL64in512(Bge, A##gu, 20); \
+    XOReq512(A##ka, Da); \
+    ROL64in512(Bgi, A##ka, 3); \
+    E##ga = CHI512(Bga, Bge, Bgi); \
+    XOReq512(A##me, De); \
+    ROL64in512(Bgo, A##me, 45); \
+    E##ge = CHI512(Bge, Bgi, Bgo); \
+    XOReq512(A##si, Di); \
+    ROL64in512(Bgu, A##si, 61); \
+    E##gi = CHI512(Bgi, Bgo, Bgu); \
+    E##go = CHI512(Bgo, Bgu, Bga); \
+    E##gu = CHI512(Bgu, Bga, Bge); \
+\
+    XOReq512(A##be, De); \
+    ROL64in512(Bka, A##be, 1); \
+    XOReq512(A##gi, Di); \
+    ROL64in512(Bke, A##gi, 6); \
+    XOReq512(A##ko, Do); \
+    ROL64in512(Bki, A##ko, 25); \
+    E##ka = CHI512(Bka, Bke, Bki); \
+    XOReq512(A##mu, Du); \
+    ROL64in512(Bko, A##mu, 8); \
+    E##ke = CHI512(Bke, Bki, Bko); \
+    XOReq512(A##sa, Da); \
+    ROL64in512(Bku, A##sa, 18); \
+    E##ki = CHI512(Bki, Bko, Bku); \
+    E##ko = CHI512(Bko, Bku, Bka); \
+    E##ku = CHI512(Bku, Bka, Bke); \
+\
+    XOReq512(A##bu, Du); \
+    ROL64in512(Bma, A##bu, 27); \
+    XOReq512(A##ga, Da); \
+    ROL64in512(Bme, A##ga, 36); \
+    XOReq512(A##ke, De); \
+    ROL64in512(Bmi, A##ke, 10); \
+    E##ma = CHI512(Bma, Bme, Bmi); \
+    XOReq512(A##mi, Di); \
+    ROL64in512(Bmo, A##mi, 15); \
+    E##me = CHI512(Bme, Bmi, Bmo); \
+    XOReq512(A##so, Do); \
+    ROL64in512(Bmu, A##so, 56); \
+    E##mi = CHI512(Bmi, Bmo, Bmu); \
+    E##mo = CHI512(Bmo, Bmu, Bma); \
+    E##mu = CHI512(Bmu, Bma, Bme); \
+\
+    XOReq512(A##bi, Di); \
+    ROL64in512(Bsa, A##bi, 62); \
+    XOReq512(A##go, Do); \
+    ROL64in512(Bse, A##go, 55); \
+    XOReq512(A##ku, Du); \
+    ROL64in512(Bsi, A##ku, 39); \
+    E##sa = CHI512(Bsa, Bse, Bsi); \
+    XOReq512(A##ma, Da); \
+    ROL64in512(Bso, A##ma, 41); \
+    E##se = CHI512(Bse, Bsi, Bso); \
+    XOReq512(A##se, De); \
+    ROL64in512(Bsu, A##se, 2); \
+    E##si = CHI512(Bsi, Bso, Bsu); \
+    E##so = CHI512(Bso, Bsu, Bsa); \
+    E##su = CHI512(Bsu, Bsa, Bse); \
+\
+
+static ALIGN(KeccakP1600times8_statesAlignment) const UINT64 KeccakF1600RoundConstants[24] = {
+    0x0000000000000001ULL,
+    0x0000000000008082ULL,
+    0x800000000000808aULL,
+    0x8000000080008000ULL,
+    0x000000000000808bULL,
+    0x0000000080000001ULL,
+    0x8000000080008081ULL,
+    0x8000000000008009ULL,
+    0x000000000000008aULL,
+    0x0000000000000088ULL,
+    0x0000000080008009ULL,
+    0x000000008000000aULL,
+    0x000000008000808bULL,
+    0x800000000000008bULL,
+    0x8000000000008089ULL,
+    0x8000000000008003ULL,
+    0x8000000000008002ULL,
+    0x8000000000000080ULL,
+    0x000000000000800aULL,
+    0x800000008000000aULL,
+    0x8000000080008081ULL,
+    0x8000000000008080ULL,
+    0x0000000080000001ULL,
+    0x8000000080008008ULL};
+
+#define copyFromState(X, state) \
+    X##ba = LOAD512(state[ 0]); \
+    X##be = LOAD512(state[ 1]); \
+    X##bi = LOAD512(state[ 2]); \
+    X##bo = LOAD512(state[ 3]); \
+    X##bu = LOAD512(state[ 4]); \
+    X##ga = LOAD512(state[ 5]); \
+    X##ge = LOAD512(state[ 6]); \
+    X##gi = LOAD512(state[ 7]); \
+    X##go = LOAD512(state[ 8]); \
+    X##gu = LOAD512(state[ 9]); \
+    X##ka = LOAD512(state[10]); \
+    X##ke = LOAD512(state[11]); \
+    X##ki = LOAD512(state[12]); \
+    X##ko = LOAD512(state[13]); \
+    X##ku = LOAD512(state[14]); \
+    X##ma = LOAD512(state[15]); \
+    X##me = LOAD512(state[16]); \
+    X##mi = LOAD512(state[17]); \
+    X##mo = LOAD512(state[18]); \
+    X##mu = LOAD512(state[19]); \
+    X##sa = LOAD512(state[20]); \
+    X##se = LOAD512(state[21]); \
+    X##si = LOAD512(state[22]); \
+    X##so = LOAD512(state[23]); \
+    X##su = LOAD512(state[24]); \
+
+#define copyToState(state, X) \
+    STORE512(state[ 0], X##ba); \
+    STORE512(state[ 1], X##be); \
+    STORE512(state[ 2], X##bi); \
+    STORE512(state[ 3], X##bo); \
+    STORE512(state[ 4], X##bu); \
+    STORE512(state[ 5], X##ga); \
+    STORE512(state[ 6], X##ge); \
+    STORE512(state[ 7], X##gi); \
+    STORE512(state[ 8], X##go); \
+    STORE512(state[ 9], X##gu); \
+    STORE512(state[10], X##ka); \
+    STORE512(state[11], X##ke); \
+    STORE512(state[12], X##ki); \
+    STORE512(state[13], X##ko); \
+    STORE512(state[14], X##ku); \
+    STORE512(state[15], X##ma); \
+    STORE512(state[16], X##me); \
+    STORE512(state[17], X##mi); \
+    STORE512(state[18], X##mo); \
+    STORE512(state[19], X##mu); \
+    STORE512(state[20], X##sa); \
+    STORE512(state[21], X##se); \
+    STORE512(state[22], X##si); \
+    STORE512(state[23], X##so); \
+    STORE512(state[24], X##su); \
+
+#define copyStateVariables(X, Y) \
+    X##ba = Y##ba; \
+    X##be = Y##be; \
+    X##bi = Y##bi; \
+    X##bo = Y##bo; \
+    X##bu = Y##bu; \
+    X##ga = Y##ga; \
+    X##ge = Y##ge; \
+    X##gi = Y##gi; \
+    X##go = Y##go; \
+    X##gu = Y##gu; \
+    X##ka = Y##ka; \
+    X##ke = Y##ke; \
+    X##ki = Y##ki; \
+    X##ko = Y##ko; \
+    X##ku = Y##ku; \
+    X##ma = Y##ma; \
+    X##me = Y##me; \
+    X##mi = Y##mi; \
+    X##mo = Y##mo; \
+    X##mu = Y##mu; \
+    X##sa = Y##sa; \
+    X##se = Y##se; \
+    X##si = Y##si; \
+    X##so = Y##so; \
+    X##su = Y##su; \
+
+ #ifdef KeccakP1600times8_fullUnrolling
+#define FullUnrolling
+#else
+#define Unrolling KeccakP1600times8_unrolling
+#endif
+#include "KeccakP-1600-unrolling.macros"
+
+void KeccakP1600times8_PermuteAll_24rounds(void *states)
+{
+    V512 *statesAsLanes = (V512 *)states;
+    declareABCDE
+    #ifndef KeccakP1600times8_fullUnrolling
+    unsigned int i;
+    #endif
+
+    copyFromState(A, statesAsLanes)
+    rounds24
+    copyToState(statesAsLanes, A)
+}
+
+void KeccakP1600times8_PermuteAll_12rounds(void *states)
+{
+    V512 *statesAsLanes = (V512 *)states;
+    declareABCDE
+    #ifndef KeccakP1600times8_fullUnrolling
+    unsigned int i;
+    #endif
+
+    copyFromState(A, statesAsLanes)
+    rounds12
+    copyToState(statesAsLanes, A)
+}
+
+size_t KeccakF1600times8_FastLoop_Absorb(void *states, unsigned int laneCount, unsigned int laneOffsetParallel, unsigned int laneOffsetSerial, const unsigned char *data, size_t dataByteLen)
+{
+    if (laneCount == 21) {
+        const unsigned char *dataStart = data;
+        const UINT64 *curData = (const UINT64 *)data;
+        const V256 offsets = LANEOFFSETS(laneOffsetParallel);
+        V512 *statesAsLanes = (V512 *)states;
+        declareABCDE
+
+        copyFromState(A, statesAsLanes)
+        while(dataByteLen >= (laneOffsetParallel*7 + laneCount)*8) {
+            #define XOR_In( Xxx, argIndex ) \
+                XOReq512(Xxx, LOAD_GATHER8_64(offsets, curData + (argIndex)))
+            XOR_In( Aba, 0 );
+            XOR_In( Abe, 1 );
+            XOR_In( Abi, 2 );
+            XOR_In( Abo, 3 );
+            XOR_In( Abu, 4 );
+            XOR_In( Aga, 5 );
+            XOR_In( Age, 6 );
+            XOR_In( Agi, 7 );
+            XOR_In( Ago, 8 );
+            XOR_In( Agu, 9 );
+            XOR_In( Aka, 10 );
+            XOR_In( Ake, 11 );
+            XOR_In( Aki, 12 );
+            XOR_In( Ako, 13 );
+            XOR_In( Aku, 14 );
+            XOR_In( Ama, 15 );
+            XOR_In( Ame, 16 );
+            XOR_In( Ami, 17 );
+            XOR_In( Amo, 18 );
+            XOR_In( Amu, 19 );
+            XOR_In( Asa, 20 );
+            #undef XOR_In
+            rounds24
+            curData += laneOffsetSerial;
+            dataByteLen -= laneOffsetSerial*8;
+        }
+        copyToState(statesAsLanes, A)
+        return (const unsigned char *)curData - dataStart;
+    }
+    else {
+        const unsigned char *dataStart = data;
+
+        while(dataByteLen >= (laneOffsetParallel*7 + laneCount)*8) {
+            KeccakP1600times8_AddLanesAll(states, data, laneCount, laneOffsetParallel);
+            KeccakP1600times8_PermuteAll_24rounds(states);
+            data += laneOffsetSerial*8;
+            dataByteLen -= laneOffsetSerial*8;
+        }
+        return data - dataStart;
+    }
+}
+
+size_t KeccakP1600times8_12rounds_FastLoop_Absorb(void *states, unsigned int laneCount, unsigned int laneOffsetParallel, unsigned int laneOffsetSerial, const unsigned char *data, size_t dataByteLen)
+{
+    if (laneCount == 21) {
+        const unsigned char *dataStart = data;
+        const UINT64 *curData = (const UINT64 *)data;
+        const V256 offsets = LANEOFFSETS(laneOffsetParallel);
+        V512 *statesAsLanes = (V512 *)states;
+        declareABCDE
+
+        copyFromState(A, statesAsLanes)
+        while(dataByteLen >= (laneOffsetParallel*7 + laneCount)*8) {
+            #define XOR_In( Xxx, argIndex ) \
+                XOReq512(Xxx, LOAD_GATHER8_64(offsets, curData + (argIndex)))
+            XOR_In( Aba, 0 );
+            XOR_In( Abe, 1 );
+            XOR_In( Abi, 2 );
+            XOR_In( Abo, 3 );
+            XOR_In( Abu, 4 );
+            XOR_In( Aga, 5 );
+            XOR_In( Age, 6 );
+            XOR_In( Agi, 7 );
+            XOR_In( Ago, 8 );
+            XOR_In( Agu, 9 );
+            XOR_In( Aka, 10 );
+            XOR_In( Ake, 11 );
+            XOR_In( Aki, 12 );
+            XOR_In( Ako, 13 );
+            XOR_In( Aku, 14 );
+            XOR_In( Ama, 15 );
+            XOR_In( Ame, 16 );
+            XOR_In( Ami, 17 );
+            XOR_In( Amo, 18 );
+            XOR_In( Amu, 19 );
+            XOR_In( Asa, 20 );
+            #undef XOR_In
+            rounds12
+            curData += laneOffsetSerial;
+            dataByteLen -= laneOffsetSerial*8;
+        }
+        copyToState(statesAsLanes, A)
+        return (const unsigned char *)curData - dataStart;
+    }
+    else {
+        const unsigned char *dataStart = data;
+
+        while(dataByteLen >= (laneOffsetParallel*7 + laneCount)*8) {
+            KeccakP1600times8_AddLanesAll(states, data, laneCount, laneOffsetParallel);
+            KeccakP1600times8_PermuteAll_12rounds(states);
+            data += laneOffsetSerial*8;
+            dataByteLen -= laneOffsetSerial*8;
+        }
+        return data - dataStart;
+    }
+}
@@ -0,0 +1,3 @@
+#define KeccakP1600times8_implementation_config "AVX-512, all rounds unrolled"
+#define KeccakP1600times8_fullUnrolling
+#define KeccakP1600times8_useAVX512
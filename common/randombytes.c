@@ -30,6 +30,15 @@ THE SOFTWARE.
 
 #include "randombytes.h"
 
+#if defined(PQCLEAN_RANDOMBYTES_BUFFERED)
+# if !defined(__unix__) && !(defined(__APPLE__) && defined(__MACH__))
+#  error "PQCLEAN_RANDOMBYTES_BUFFERED requires POSIX threads"
+# endif
+# include <pthread.h>
+# include <string.h>
+# include "aes.h"
+#endif /* defined(PQCLEAN_RANDOMBYTES_BUFFERED) */
+
 #if defined(_WIN32)
 /* Windows */
 # include <windows.h>
@@ -133,7 +142,9 @@ static ssize_t getrandom(void *buf, size_t buflen, unsigned int flags) {
 static int randombytes_linux_randombytes_getrandom(void *buf, size_t n) {
     /* I have thought about using a separate PRF, seeded by getrandom, but
      * it turns out that the performance of getrandom is good enough
-     * (250 MB/s on my laptop).
+     * (250 MB/s on my laptop). Callers that are bound by the number of
+     * syscalls rather than by throughput can build with
+     * PQCLEAN_RANDOMBYTES_BUFFERED (see below).
      */
     size_t offset = 0, chunk;
     int ret;
@@ -332,7 +343,7 @@ static int randombytes_js_randombytes_nodejs(void *buf, size_t n) {
 #endif /* defined(__EMSCRIPTEN__) */
 
 
-int randombytes(uint8_t *output, size_t n) {
+static int randombytes_system(uint8_t *output, size_t n) {
     void *buf = (void *)output;
     #if defined(__EMSCRIPTEN__)
     return randombytes_js_randombytes_nodejs(buf, n);
@@ -360,3 +371,121 @@ int randombytes(uint8_t *output, size_t n) {
 # error "randombytes(...) is not supported on this platform"
     #endif
 }
+
+
+#if defined(PQCLEAN_RANDOMBYTES_BUFFERED)
+/*
+ * Buffered mode: every thread runs its own fast-key-erasure generator
+ * (AES-256-CTR under a key that is replaced by the first 32 bytes of each
+ * refill) and serves requests from the rest of the output, so that the
+ * system RNG is only asked for a 32-byte seed once every
+ * RANDOMBYTES_RESEED_BYTES bytes. Bytes are wiped from the buffer as they
+ * are handed out.
+ *
+ * A child process must not continue its parent's stream; the pthread_atfork
+ * handler bumps a generation counter that makes every inherited state
+ * reseed before its next use.
+ */
+#define RANDOMBYTES_KEYBYTES 32
+#define RANDOMBYTES_BUFBYTES (768 - RANDOMBYTES_KEYBYTES)
+#define RANDOMBYTES_RESEED_BYTES (1 << 20)
+
+typedef struct {
+    uint8_t key[RANDOMBYTES_KEYBYTES];
+    uint8_t buf[RANDOMBYTES_BUFBYTES];
+    size_t avail; // unread bytes at the end of buf
+    size_t since_reseed;
+    unsigned long generation;
+    int seeded;
+} randombytes_state;
+
+static __thread randombytes_state randombytes_tls;
+static unsigned long randombytes_fork_generation;
+static pthread_once_t randombytes_once = PTHREAD_ONCE_INIT;
+
+static void randombytes_atfork_child(void) {
+    randombytes_fork_generation++;
+}
+
+static void randombytes_register_atfork(void) {
+    pthread_atfork(NULL, NULL, randombytes_atfork_child);
+}
+
+static void randombytes_wipe(void *p, size_t n) {
+    volatile uint8_t *v = (volatile uint8_t *)p;
+    while (n-- > 0) {
+        *v++ = 0;
+    }
+}
+
+static void randombytes_refill(randombytes_state *st) {
+    static const uint8_t nonce[AESCTR_NONCEBYTES] = {0};
+    uint8_t stream[RANDOMBYTES_KEYBYTES + RANDOMBYTES_BUFBYTES];
+    aes256ctx_inline ctx;
+
+    aes256_ctr_keyexp_inline(&ctx, st->key);
+    aes256_ctr_inline(stream, sizeof(stream), nonce, &ctx);
+    memcpy(st->key, stream, RANDOMBYTES_KEYBYTES);
+    memcpy(st->buf, stream + RANDOMBYTES_KEYBYTES, RANDOMBYTES_BUFBYTES);
+    st->avail = RANDOMBYTES_BUFBYTES;
+    randombytes_wipe(stream, sizeof(stream));
+    randombytes_wipe(&ctx, sizeof(ctx));
+}
+
+static int randombytes_buffered(uint8_t *output, size_t n) {
+    randombytes_state *st = &randombytes_tls;
+    uint8_t *src;
+    size_t take;
+
+    if (pthread_once(&randombytes_once, randombytes_register_atfork) != 0) {
+        return -1;
+    }
+    if (!st->seeded || st->generation != randombytes_fork_generation ||
+            st->since_reseed >= RANDOMBYTES_RESEED_BYTES) {
+        randombytes_wipe(st, sizeof(*st));
+        if (randombytes_system(st->key, RANDOMBYTES_KEYBYTES) != 0) {
+            return -1;
+        }
+        st->generation = randombytes_fork_generation;
+        st->seeded = 1;
+    }
+
+    while (n > 0) {
+        if (st->avail == 0) {
+            randombytes_refill(st);
+        }
+        take = n < st->avail ? n : st->avail;
+        src = st->buf + RANDOMBYTES_BUFBYTES - st->avail;
+        memcpy(output, src, take);
+        randombytes_wipe(src, take);
+        st->avail -= take;
+        st->since_reseed += take;
+        output += take;
+        n -= take;
+    }
+    return 0;
+}
+#endif /* defined(PQCLEAN_RANDOMBYTES_BUFFERED) */
+
+
+/* Plain globals: randombytes_set_provider() must be called before any
+ * other thread uses the library (see randombytes.h), so the pair is never
+ * read while it is being written. */
+static PQCLEAN_randombytes_provider randombytes_provider_fn = NULL;
+static void *randombytes_provider_ctx = NULL;
+
+void randombytes_set_provider(PQCLEAN_randombytes_provider provider, void *ctx) {
+    randombytes_provider_fn = provider;
+    randombytes_provider_ctx = ctx;
+}
+
+int randombytes(uint8_t *output, size_t n) {
+    if (randombytes_provider_fn != NULL) {
+        return randombytes_provider_fn(randombytes_provider_ctx, output, n);
+    }
+#if defined(PQCLEAN_RANDOMBYTES_BUFFERED)
+    return randombytes_buffered(output, n);
+#else
+    return randombytes_system(output, n);
+#endif
+}
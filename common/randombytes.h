@@ -17,10 +17,35 @@ extern "C" {
 
 /*
  * Write `n` bytes of high quality random bytes to `buf`
+ *
+ * When randombytes.c is compiled with PQCLEAN_RANDOMBYTES_BUFFERED, the
+ * bytes come from a per-thread AES-256-CTR generator that is seeded from
+ * the system RNG, reseeded every MiB of output and after fork(). This
+ * mode needs POSIX threads and aes.c.
  */
 #define randombytes     PQCLEAN_randombytes
 int randombytes(uint8_t *output, size_t n);
 
+/*
+ * Source of random bytes for randombytes(): fills `n` bytes of `output`
+ * using the caller's state `ctx` and returns 0 on success.
+ */
+typedef int (*PQCLEAN_randombytes_provider)(void *ctx, uint8_t *output, size_t n);
+
+/*
+ * Route all further randombytes() calls through `provider`; passing NULL
+ * restores the built-in generator.
+ *
+ * Must be called before any other thread uses the library. The function
+ * and `ctx` are stored without synchronization, so a concurrent
+ * randombytes() may see the new function with the old context. The same
+ * applies to replacing or removing a provider later on: all other threads
+ * must be quiescent, and `ctx` must stay valid for as long as the provider
+ * is installed.
+ */
+#define randombytes_set_provider PQCLEAN_randombytes_set_provider
+void randombytes_set_provider(PQCLEAN_randombytes_provider provider, void *ctx);
+
 #ifdef __cplusplus
 }
 #endif
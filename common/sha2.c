@@ -7,8 +7,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "cpufeatures.h"
 #include "sha2.h"
 
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
 static uint32_t load_bigendian_32(const uint8_t *x) {
     return (uint32_t)(x[3]) | (((uint32_t)(x[2])) << 8) |
            (((uint32_t)(x[1])) << 16) | (((uint32_t)(x[0])) << 24);
@@ -129,8 +134,8 @@ static void store_bigendian_64(uint8_t *x, uint64_t u) {
     b = a;                                           \
     a = T1 + T2;
 
-static size_t crypto_hashblocks_sha256(uint8_t *statebytes,
-                                       const uint8_t *in, size_t inlen) {
+static size_t crypto_hashblocks_sha256_c(uint8_t *statebytes,
+                                         const uint8_t *in, size_t inlen) {
     uint32_t state[8];
     uint32_t a;
     uint32_t b;
@@ -286,6 +291,101 @@ static size_t crypto_hashblocks_sha256(uint8_t *statebytes,
     return inlen;
 }
 
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+static const uint32_t sha256_round_constants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* SHA-256 compression using the Intel SHA extensions.
+ * The state is kept as ABEF/CDGH as required by sha256rnds2;
+ * each iteration of the inner loop does four rounds. */
+__attribute__((target("sha,sse4.1")))
+static size_t crypto_hashblocks_sha256_shani(uint8_t *statebytes,
+                                             const uint8_t *in, size_t inlen) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    __m128i state0, state1, save0, save1, tmp, msg;
+    __m128i w[4];
+    int i;
+
+    /* statebytes holds a..h big-endian */
+    tmp = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)statebytes), bswap);
+    state1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(statebytes + 16)), bswap);
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);             // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);       // EFGH
+    state0 = _mm_alignr_epi8(tmp, state1, 8);       // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);    // CDGH
+
+    while (inlen >= 64) {
+        save0 = state0;
+        save1 = state1;
+
+        for (i = 0; i < 16; i++) {
+            if (i < 4) {
+                w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + 16 * i)), bswap);
+            } else {
+                tmp = _mm_add_epi32(_mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]),
+                                    _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4));
+                w[i & 3] = _mm_sha256msg2_epu32(tmp, w[(i + 3) & 3]);
+            }
+            msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i *)(sha256_round_constants + 4 * i)));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        }
+
+        state0 = _mm_add_epi32(state0, save0);
+        state1 = _mm_add_epi32(state1, save1);
+
+        in += 64;
+        inlen -= 64;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);          // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);       // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);    // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);       // HGFE
+    _mm_storeu_si128((__m128i *)statebytes, _mm_shuffle_epi8(state0, bswap));
+    _mm_storeu_si128((__m128i *)(statebytes + 16), _mm_shuffle_epi8(state1, bswap));
+
+    return inlen;
+}
+#endif
+
+static size_t crypto_hashblocks_sha256_select(uint8_t *statebytes,
+        const uint8_t *in, size_t inlen);
+
+static size_t (*crypto_hashblocks_sha256_impl)(uint8_t *statebytes,
+        const uint8_t *in, size_t inlen) = crypto_hashblocks_sha256_select;
+
+/* Picks the SHA-256 compression function for the running CPU on first use.
+ * Every candidate computes the same function, so a concurrent first call
+ * from another thread at worst repeats the choice; the pointer itself is
+ * published with a relaxed atomic store. */
+static size_t crypto_hashblocks_sha256_select(uint8_t *statebytes,
+        const uint8_t *in, size_t inlen) {
+    size_t (*impl)(uint8_t *, const uint8_t *, size_t) = crypto_hashblocks_sha256_c;
+#ifdef PQCLEAN_HAVE_X86_DISPATCH
+    if (pqclean_cpu_supports(PQC_CPU_SHA | PQC_CPU_SSE41)) {
+        impl = crypto_hashblocks_sha256_shani;
+    }
+#endif
+    PQCLEAN_DISPATCH_STORE(&crypto_hashblocks_sha256_impl, impl);
+    return impl(statebytes, in, inlen);
+}
+
+static size_t crypto_hashblocks_sha256(uint8_t *statebytes,
+                                       const uint8_t *in, size_t inlen) {
+    size_t (*impl)(uint8_t *, const uint8_t *, size_t) = PQCLEAN_DISPATCH_LOAD(&crypto_hashblocks_sha256_impl);
+    return impl(statebytes, in, inlen);
+}
+
 static size_t crypto_hashblocks_sha512(uint8_t *statebytes,
                                        const uint8_t *in, size_t inlen) {
     uint64_t state[8];
@@ -494,17 +594,144 @@ static const uint8_t iv_512[64] = {
     0x6b, 0x5b, 0xe0, 0xcd, 0x19, 0x13, 0x7e, 0x21, 0x79
 };
 
+static void sha256_inc_init_bytes(uint8_t *statebytes, const uint8_t *iv) {
+    for (size_t i = 0; i < 32; ++i) {
+        statebytes[i] = iv[i];
+    }
+    for (size_t i = 32; i < 40; ++i) {
+        statebytes[i] = 0;
+    }
+}
+
+static void sha512_inc_init_bytes(uint8_t *statebytes, const uint8_t *iv) {
+    for (size_t i = 0; i < 64; ++i) {
+        statebytes[i] = iv[i];
+    }
+    for (size_t i = 64; i < 72; ++i) {
+        statebytes[i] = 0;
+    }
+}
+
+static void sha256_inc_blocks_bytes(uint8_t *statebytes, const uint8_t *in, size_t inblocks) {
+    uint64_t bytes = load_bigendian_64(statebytes + 32);
+
+    crypto_hashblocks_sha256(statebytes, in, 64 * inblocks);
+    bytes += 64 * inblocks;
+
+    store_bigendian_64(statebytes + 32, bytes);
+}
+
+static void sha512_inc_blocks_bytes(uint8_t *statebytes, const uint8_t *in, size_t inblocks) {
+    uint64_t bytes = load_bigendian_64(statebytes + 64);
+
+    crypto_hashblocks_sha512(statebytes, in, 128 * inblocks);
+    bytes += 128 * inblocks;
+
+    store_bigendian_64(statebytes + 64, bytes);
+}
+
+static void sha256_inc_finalize_bytes(uint8_t *out, uint8_t *statebytes, const uint8_t *in, size_t inlen) {
+    uint8_t padded[128];
+    uint64_t bytes = load_bigendian_64(statebytes + 32) + inlen;
+
+    crypto_hashblocks_sha256(statebytes, in, inlen);
+    in += inlen;
+    inlen &= 63;
+    in -= inlen;
+
+    for (size_t i = 0; i < inlen; ++i) {
+        padded[i] = in[i];
+    }
+    padded[inlen] = 0x80;
+
+    if (inlen < 56) {
+        for (size_t i = inlen + 1; i < 56; ++i) {
+            padded[i] = 0;
+        }
+        padded[56] = (uint8_t) (bytes >> 53);
+        padded[57] = (uint8_t) (bytes >> 45);
+        padded[58] = (uint8_t) (bytes >> 37);
+        padded[59] = (uint8_t) (bytes >> 29);
+        padded[60] = (uint8_t) (bytes >> 21);
+        padded[61] = (uint8_t) (bytes >> 13);
+        padded[62] = (uint8_t) (bytes >> 5);
+        padded[63] = (uint8_t) (bytes << 3);
+        crypto_hashblocks_sha256(statebytes, padded, 64);
+    } else {
+        for (size_t i = inlen + 1; i < 120; ++i) {
+            padded[i] = 0;
+        }
+        padded[120] = (uint8_t) (bytes >> 53);
+        padded[121] = (uint8_t) (bytes >> 45);
+        padded[122] = (uint8_t) (bytes >> 37);
+        padded[123] = (uint8_t) (bytes >> 29);
+        padded[124] = (uint8_t) (bytes >> 21);
+        padded[125] = (uint8_t) (bytes >> 13);
+        padded[126] = (uint8_t) (bytes >> 5);
+        padded[127] = (uint8_t) (bytes << 3);
+        crypto_hashblocks_sha256(statebytes, padded, 128);
+    }
+
+    for (size_t i = 0; i < 32; ++i) {
+        out[i] = statebytes[i];
+    }
+}
+
+static void sha512_inc_finalize_bytes(uint8_t *out, uint8_t *statebytes, const uint8_t *in, size_t inlen) {
+    uint8_t padded[256];
+    uint64_t bytes = load_bigendian_64(statebytes + 64) + inlen;
+
+    crypto_hashblocks_sha512(statebytes, in, inlen);
+    in += inlen;
+    inlen &= 127;
+    in -= inlen;
+
+    for (size_t i = 0; i < inlen; ++i) {
+        padded[i] = in[i];
+    }
+    padded[inlen] = 0x80;
+
+    if (inlen < 112) {
+        for (size_t i = inlen + 1; i < 119; ++i) {
+            padded[i] = 0;
+        }
+        padded[119] = (uint8_t) (bytes >> 61);
+        padded[120] = (uint8_t) (bytes >> 53);
+        padded[121] = (uint8_t) (bytes >> 45);
+        padded[122] = (uint8_t) (bytes >> 37);
+        padded[123] = (uint8_t) (bytes >> 29);
+        padded[124] = (uint8_t) (bytes >> 21);
+        padded[125] = (uint8_t) (bytes >> 13);
+        padded[126] = (uint8_t) (bytes >> 5);
+        padded[127] = (uint8_t) (bytes << 3);
+        crypto_hashblocks_sha512(statebytes, padded, 128);
+    } else {
+        for (size_t i = inlen + 1; i < 247; ++i) {
+            padded[i] = 0;
+        }
+        padded[247] = (uint8_t) (bytes >> 61);
+        padded[248] = (uint8_t) (bytes >> 53);
+        padded[249] = (uint8_t) (bytes >> 45);
+        padded[250] = (uint8_t) (bytes >> 37);
+        padded[251] = (uint8_t) (bytes >> 29);
+        padded[252] = (uint8_t) (bytes >> 21);
+        padded[253] = (uint8_t) (bytes >> 13);
+        padded[254] = (uint8_t) (bytes >> 5);
+        padded[255] = (uint8_t) (bytes << 3);
+        crypto_hashblocks_sha512(statebytes, padded, 256);
+    }
+
+    for (size_t i = 0; i < 64; ++i) {
+        out[i] = statebytes[i];
+    }
+}
+
 void sha224_inc_init(sha224ctx *state) {
     state->ctx = malloc(PQC_SHA256CTX_BYTES);
     if (state->ctx == NULL) {
         exit(111);
     }
-    for (size_t i = 0; i < 32; ++i) {
-        state->ctx[i] = iv_224[i];
-    }
-    for (size_t i = 32; i < 40; ++i) {
-        state->ctx[i] = 0;
-    }
+    sha256_inc_init_bytes(state->ctx, iv_224);
 }
 
 void sha256_inc_init(sha256ctx *state) {
@@ -512,12 +739,7 @@ void sha256_inc_init(sha256ctx *state) {
     if (state->ctx == NULL) {
         exit(111);
     }
-    for (size_t i = 0; i < 32; ++i) {
-        state->ctx[i] = iv_256[i];
-    }
-    for (size_t i = 32; i < 40; ++i) {
-        state->ctx[i] = 0;
-    }
+    sha256_inc_init_bytes(state->ctx, iv_256);
 }
 
 void sha384_inc_init(sha384ctx *state) {
@@ -525,12 +747,7 @@ void sha384_inc_init(sha384ctx *state) {
     if (state->ctx == NULL) {
         exit(111);
     }
-    for (size_t i = 0; i < 64; ++i) {
-        state->ctx[i] = iv_384[i];
-    }
-    for (size_t i = 64; i < 72; ++i) {
-        state->ctx[i] = 0;
-    }
+    sha512_inc_init_bytes(state->ctx, iv_384);
 }
 
 void sha512_inc_init(sha512ctx *state) {
@@ -538,12 +755,7 @@ void sha512_inc_init(sha512ctx *state) {
     if (state->ctx == NULL) {
         exit(111);
     }
-    for (size_t i = 0; i < 64; ++i) {
-        state->ctx[i] = iv_512[i];
-    }
-    for (size_t i = 64; i < 72; ++i) {
-        state->ctx[i] = 0;
-    }
+    sha512_inc_init_bytes(state->ctx, iv_512);
 }
 
 void sha224_inc_ctx_clone(sha224ctx *stateout, const sha224ctx *statein) {
@@ -599,12 +811,7 @@ void sha512_inc_ctx_release(sha512ctx *state) {
 }
 
 void sha256_inc_blocks(sha256ctx *state, const uint8_t *in, size_t inblocks) {
-    uint64_t bytes = load_bigendian_64(state->ctx + 32);
-
-    crypto_hashblocks_sha256(state->ctx, in, 64 * inblocks);
-    bytes += 64 * inblocks;
-
-    store_bigendian_64(state->ctx + 32, bytes);
+    sha256_inc_blocks_bytes(state->ctx, in, inblocks);
 }
 
 void sha224_inc_blocks(sha224ctx *state, const uint8_t *in, size_t inblocks) {
@@ -612,12 +819,7 @@ void sha224_inc_blocks(sha224ctx *state, const uint8_t *in, size_t inblocks) {
 }
 
 void sha512_inc_blocks(sha512ctx *state, const uint8_t *in, size_t inblocks) {
-    uint64_t bytes = load_bigendian_64(state->ctx + 64);
-
-    crypto_hashblocks_sha512(state->ctx, in, 128 * inblocks);
-    bytes += 128 * inblocks;
-
-    store_bigendian_64(state->ctx + 64, bytes);
+    sha512_inc_blocks_bytes(state->ctx, in, inblocks);
 }
 
 void sha384_inc_blocks(sha384ctx *state, const uint8_t *in, size_t inblocks) {
@@ -625,50 +827,7 @@ void sha384_inc_blocks(sha384ctx *state, const uint8_t *in, size_t inblocks) {
 }
 
 void sha256_inc_finalize(uint8_t *out, sha256ctx *state, const uint8_t *in, size_t inlen) {
-    uint8_t padded[128];
-    uint64_t bytes = load_bigendian_64(state->ctx + 32) + inlen;
-
-    crypto_hashblocks_sha256(state->ctx, in, inlen);
-    in += inlen;
-    inlen &= 63;
-    in -= inlen;
-
-    for (size_t i = 0; i < inlen; ++i) {
-        padded[i] = in[i];
-    }
-    padded[inlen] = 0x80;
-
-    if (inlen < 56) {
-        for (size_t i = inlen + 1; i < 56; ++i) {
-            padded[i] = 0;
-        }
-        padded[56] = (uint8_t) (bytes >> 53);
-        padded[57] = (uint8_t) (bytes >> 45);
-        padded[58] = (uint8_t) (bytes >> 37);
-        padded[59] = (uint8_t) (bytes >> 29);
-        padded[60] = (uint8_t) (bytes >> 21);
-        padded[61] = (uint8_t) (bytes >> 13);
-        padded[62] = (uint8_t) (bytes >> 5);
-        padded[63] = (uint8_t) (bytes << 3);
-        crypto_hashblocks_sha256(state->ctx, padded, 64);
-    } else {
-        for (size_t i = inlen + 1; i < 120; ++i) {
-            padded[i] = 0;
-        }
-        padded[120] = (uint8_t) (bytes >> 53);
-        padded[121] = (uint8_t) (bytes >> 45);
-        padded[122] = (uint8_t) (bytes >> 37);
-        padded[123] = (uint8_t) (bytes >> 29);
-        padded[124] = (uint8_t) (bytes >> 21);
-        padded[125] = (uint8_t) (bytes >> 13);
-        padded[126] = (uint8_t) (bytes >> 5);
-        padded[127] = (uint8_t) (bytes << 3);
-        crypto_hashblocks_sha256(state->ctx, padded, 128);
-    }
-
-    for (size_t i = 0; i < 32; ++i) {
-        out[i] = state->ctx[i];
-    }
+    sha256_inc_finalize_bytes(out, state->ctx, in, inlen);
     sha256_inc_ctx_release(state);
 }
 
@@ -682,88 +841,135 @@ void sha224_inc_finalize(uint8_t *out, sha224ctx *state, const uint8_t *in, size
 }
 
 void sha512_inc_finalize(uint8_t *out, sha512ctx *state, const uint8_t *in, size_t inlen) {
-    uint8_t padded[256];
-    uint64_t bytes = load_bigendian_64(state->ctx + 64) + inlen;
+    sha512_inc_finalize_bytes(out, state->ctx, in, inlen);
+    sha512_inc_ctx_release(state);
+}
 
-    crypto_hashblocks_sha512(state->ctx, in, inlen);
-    in += inlen;
-    inlen &= 127;
-    in -= inlen;
+void sha384_inc_finalize(uint8_t *out, sha384ctx *state, const uint8_t *in, size_t inlen) {
+    uint8_t tmp[64];
+    sha512_inc_finalize(tmp, (sha512ctx*)state, in, inlen);
 
-    for (size_t i = 0; i < inlen; ++i) {
-        padded[i] = in[i];
+    for (size_t i = 0; i < 48; ++i) {
+        out[i] = tmp[i];
     }
-    padded[inlen] = 0x80;
+}
 
-    if (inlen < 112) {
-        for (size_t i = inlen + 1; i < 119; ++i) {
-            padded[i] = 0;
-        }
-        padded[119] = (uint8_t) (bytes >> 61);
-        padded[120] = (uint8_t) (bytes >> 53);
-        padded[121] = (uint8_t) (bytes >> 45);
-        padded[122] = (uint8_t) (bytes >> 37);
-        padded[123] = (uint8_t) (bytes >> 29);
-        padded[124] = (uint8_t) (bytes >> 21);
-        padded[125] = (uint8_t) (bytes >> 13);
-        padded[126] = (uint8_t) (bytes >> 5);
-        padded[127] = (uint8_t) (bytes << 3);
-        crypto_hashblocks_sha512(state->ctx, padded, 128);
-    } else {
-        for (size_t i = inlen + 1; i < 247; ++i) {
-            padded[i] = 0;
-        }
-        padded[247] = (uint8_t) (bytes >> 61);
-        padded[248] = (uint8_t) (bytes >> 53);
-        padded[249] = (uint8_t) (bytes >> 45);
-        padded[250] = (uint8_t) (bytes >> 37);
-        padded[251] = (uint8_t) (bytes >> 29);
-        padded[252] = (uint8_t) (bytes >> 21);
-        padded[253] = (uint8_t) (bytes >> 13);
-        padded[254] = (uint8_t) (bytes >> 5);
-        padded[255] = (uint8_t) (bytes << 3);
-        crypto_hashblocks_sha512(state->ctx, padded, 256);
-    }
+void sha224_inc_init_inline(sha224ctx_inline *state) {
+    sha256_inc_init_bytes(state->ctx, iv_224);
+}
 
-    for (size_t i = 0; i < 64; ++i) {
-        out[i] = state->ctx[i];
+void sha256_inc_init_inline(sha256ctx_inline *state) {
+    sha256_inc_init_bytes(state->ctx, iv_256);
+}
+
+void sha384_inc_init_inline(sha384ctx_inline *state) {
+    sha512_inc_init_bytes(state->ctx, iv_384);
+}
+
+void sha512_inc_init_inline(sha512ctx_inline *state) {
+    sha512_inc_init_bytes(state->ctx, iv_512);
+}
+
+void sha224_inc_ctx_clone_inline(sha224ctx_inline *stateout, const sha224ctx_inline *statein) {
+    memcpy(stateout->ctx, statein->ctx, PQC_SHA256CTX_BYTES);
+}
+
+void sha256_inc_ctx_clone_inline(sha256ctx_inline *stateout, const sha256ctx_inline *statein) {
+    memcpy(stateout->ctx, statein->ctx, PQC_SHA256CTX_BYTES);
+}
+
+void sha384_inc_ctx_clone_inline(sha384ctx_inline *stateout, const sha384ctx_inline *statein) {
+    memcpy(stateout->ctx, statein->ctx, PQC_SHA512CTX_BYTES);
+}
+
+void sha512_inc_ctx_clone_inline(sha512ctx_inline *stateout, const sha512ctx_inline *statein) {
+    memcpy(stateout->ctx, statein->ctx, PQC_SHA512CTX_BYTES);
+}
+
+void sha224_inc_blocks_inline(sha224ctx_inline *state, const uint8_t *in, size_t inblocks) {
+    sha256_inc_blocks_bytes(state->ctx, in, inblocks);
+}
+
+void sha256_inc_blocks_inline(sha256ctx_inline *state, const uint8_t *in, size_t inblocks) {
+    sha256_inc_blocks_bytes(state->ctx, in, inblocks);
+}
+
+void sha384_inc_blocks_inline(sha384ctx_inline *state, const uint8_t *in, size_t inblocks) {
+    sha512_inc_blocks_bytes(state->ctx, in, inblocks);
+}
+
+void sha512_inc_blocks_inline(sha512ctx_inline *state, const uint8_t *in, size_t inblocks) {
+    sha512_inc_blocks_bytes(state->ctx, in, inblocks);
+}
+
+void sha224_inc_finalize_inline(uint8_t *out, sha224ctx_inline *state, const uint8_t *in, size_t inlen) {
+    uint8_t tmp[32];
+    sha256_inc_finalize_bytes(tmp, state->ctx, in, inlen);
+
+    for (size_t i = 0; i < 28; ++i) {
+        out[i] = tmp[i];
     }
-    sha512_inc_ctx_release(state);
 }
 
-void sha384_inc_finalize(uint8_t *out, sha384ctx *state, const uint8_t *in, size_t inlen) {
+void sha256_inc_finalize_inline(uint8_t *out, sha256ctx_inline *state, const uint8_t *in, size_t inlen) {
+    sha256_inc_finalize_bytes(out, state->ctx, in, inlen);
+}
+
+void sha384_inc_finalize_inline(uint8_t *out, sha384ctx_inline *state, const uint8_t *in, size_t inlen) {
     uint8_t tmp[64];
-    sha512_inc_finalize(tmp, (sha512ctx*)state, in, inlen);
+    sha512_inc_finalize_bytes(tmp, state->ctx, in, inlen);
 
     for (size_t i = 0; i < 48; ++i) {
         out[i] = tmp[i];
     }
 }
 
+void sha512_inc_finalize_inline(uint8_t *out, sha512ctx_inline *state, const uint8_t *in, size_t inlen) {
+    sha512_inc_finalize_bytes(out, state->ctx, in, inlen);
+}
+
 void sha224(uint8_t *out, const uint8_t *in, size_t inlen) {
-    sha224ctx state;
+    sha224ctx_inline state;
 
-    sha224_inc_init(&state);
-    sha224_inc_finalize(out, &state, in, inlen);
+    sha224_inc_init_inline(&state);
+    sha224_inc_finalize_inline(out, &state, in, inlen);
 }
 
 void sha256(uint8_t *out, const uint8_t *in, size_t inlen) {
-    sha256ctx state;
+    sha256ctx_inline state;
 
-    sha256_inc_init(&state);
-    sha256_inc_finalize(out, &state, in, inlen);
+    sha256_inc_init_inline(&state);
+    sha256_inc_finalize_inline(out, &state, in, inlen);
 }
 
 void sha384(uint8_t *out, const uint8_t *in, size_t inlen) {
-    sha384ctx state;
+    sha384ctx_inline state;
 
-    sha384_inc_init(&state);
-    sha384_inc_finalize(out, &state, in, inlen);
+    sha384_inc_init_inline(&state);
+    sha384_inc_finalize_inline(out, &state, in, inlen);
 }
 
 void sha512(uint8_t *out, const uint8_t *in, size_t inlen) {
-    sha512ctx state;
+    sha512ctx_inline state;
 
-    sha512_inc_init(&state);
-    sha512_inc_finalize(out, &state, in, inlen);
+    sha512_inc_init_inline(&state);
+    sha512_inc_finalize_inline(out, &state, in, inlen);
+}
+
+void sha256_batch(uint8_t *const *out,
+                  const uint8_t *const *in, const size_t *inlen, size_t n) {
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        sha256(out[i], in[i], inlen[i]);
+    }
+}
+
+void sha512_batch(uint8_t *const *out,
+                  const uint8_t *const *in, const size_t *inlen, size_t n) {
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        sha512(out[i], in[i], inlen[i]);
+    }
 }
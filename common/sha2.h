@@ -30,6 +30,25 @@ typedef struct {
     uint8_t *ctx;
 } sha512ctx;
 
+/* Inline (caller-owned) structures for the incremental API.
+   These hold the state by value, so they can live on the stack or in an
+   arena, and they never need to be released. */
+typedef struct {
+    uint8_t ctx[PQC_SHA256CTX_BYTES];
+} sha224ctx_inline;
+
+typedef struct {
+    uint8_t ctx[PQC_SHA256CTX_BYTES];
+} sha256ctx_inline;
+
+typedef struct {
+    uint8_t ctx[PQC_SHA512CTX_BYTES];
+} sha384ctx_inline;
+
+typedef struct {
+    uint8_t ctx[PQC_SHA512CTX_BYTES];
+} sha512ctx_inline;
+
 /* ====== SHA224 API ==== */
 
 /**
@@ -171,4 +190,42 @@ void sha512_inc_ctx_release(sha512ctx *state);
  */
 void sha512(uint8_t *out, const uint8_t *in, size_t inlen);
 
+/**
+ * Hash n independent messages in[i] of inlen[i] bytes each into out[i].
+ * Same calling convention as the batched SHA-3 functions in fips202.h, so
+ * that batched callers can switch hash families; the messages are simply
+ * processed one after the other.
+ */
+void sha256_batch(uint8_t *const *out,
+                  const uint8_t *const *in, const size_t *inlen, size_t n);
+void sha512_batch(uint8_t *const *out,
+                  const uint8_t *const *in, const size_t *inlen, size_t n);
+
+/* ====== Allocation-free API on inline structures ==== */
+
+/**
+ * Same semantics as the functions above without the _inline suffix, but
+ * operating on caller-owned states. None of these allocate memory, and
+ * finalize does not release anything.
+ */
+void sha224_inc_init_inline(sha224ctx_inline *state);
+void sha224_inc_ctx_clone_inline(sha224ctx_inline *stateout, const sha224ctx_inline *statein);
+void sha224_inc_blocks_inline(sha224ctx_inline *state, const uint8_t *in, size_t inblocks);
+void sha224_inc_finalize_inline(uint8_t *out, sha224ctx_inline *state, const uint8_t *in, size_t inlen);
+
+void sha256_inc_init_inline(sha256ctx_inline *state);
+void sha256_inc_ctx_clone_inline(sha256ctx_inline *stateout, const sha256ctx_inline *statein);
+void sha256_inc_blocks_inline(sha256ctx_inline *state, const uint8_t *in, size_t inblocks);
+void sha256_inc_finalize_inline(uint8_t *out, sha256ctx_inline *state, const uint8_t *in, size_t inlen);
+
+void sha384_inc_init_inline(sha384ctx_inline *state);
+void sha384_inc_ctx_clone_inline(sha384ctx_inline *stateout, const sha384ctx_inline *statein);
+void sha384_inc_blocks_inline(sha384ctx_inline *state, const uint8_t *in, size_t inblocks);
+void sha384_inc_finalize_inline(uint8_t *out, sha384ctx_inline *state, const uint8_t *in, size_t inlen);
+
+void sha512_inc_init_inline(sha512ctx_inline *state);
+void sha512_inc_ctx_clone_inline(sha512ctx_inline *stateout, const sha512ctx_inline *statein);
+void sha512_inc_blocks_inline(sha512ctx_inline *state, const uint8_t *in, size_t inblocks);
+void sha512_inc_finalize_inline(uint8_t *out, sha512ctx_inline *state, const uint8_t *in, size_t inlen);
+
 #endif
@@ -103,6 +103,82 @@ void cshake256_inc_ctx_clone(shake256incctx *dest, const shake256incctx *src) {
     shake256_inc_ctx_clone(dest, src);
 }
 
+void cshake128_inc_init_inline(shake128incctx_inline *state, const uint8_t *name, size_t namelen, const uint8_t *cstm, size_t cstmlen) {
+    uint8_t encbuf[sizeof(size_t)+1];
+
+    shake128_inc_init_inline(state);
+
+    shake128_inc_absorb_inline(state, encbuf, left_encode(encbuf, SHAKE128_RATE));
+
+    shake128_inc_absorb_inline(state, encbuf, left_encode(encbuf, namelen * 8));
+    shake128_inc_absorb_inline(state, name, namelen);
+
+    shake128_inc_absorb_inline(state, encbuf, left_encode(encbuf, cstmlen * 8));
+    shake128_inc_absorb_inline(state, cstm, cstmlen);
+
+    if (state->ctx[25] != 0) {
+        state->ctx[25] = SHAKE128_RATE - 1;
+        encbuf[0] = 0;
+        shake128_inc_absorb_inline(state, encbuf, 1);
+    }
+}
+
+void cshake128_inc_absorb_inline(shake128incctx_inline *state, const uint8_t *input, size_t inlen) {
+    shake128_inc_absorb_inline(state, input, inlen);
+}
+
+void cshake128_inc_finalize_inline(shake128incctx_inline *state) {
+    state->ctx[state->ctx[25] >> 3] ^= (uint64_t)0x04 << (8 * (state->ctx[25] & 0x07));
+    state->ctx[(SHAKE128_RATE - 1) >> 3] ^= (uint64_t)128 << (8 * ((SHAKE128_RATE - 1) & 0x07));
+    state->ctx[25] = 0;
+}
+
+void cshake128_inc_squeeze_inline(uint8_t *output, size_t outlen, shake128incctx_inline *state) {
+    shake128_inc_squeeze_inline(output, outlen, state);
+}
+
+void cshake128_inc_ctx_clone_inline(shake128incctx_inline *dest, const shake128incctx_inline *src) {
+    shake128_inc_ctx_clone_inline(dest, src);
+}
+
+void cshake256_inc_init_inline(shake256incctx_inline *state, const uint8_t *name, size_t namelen, const uint8_t *cstm, size_t cstmlen) {
+    uint8_t encbuf[sizeof(size_t)+1];
+
+    shake256_inc_init_inline(state);
+
+    shake256_inc_absorb_inline(state, encbuf, left_encode(encbuf, SHAKE256_RATE));
+
+    shake256_inc_absorb_inline(state, encbuf, left_encode(encbuf, namelen * 8));
+    shake256_inc_absorb_inline(state, name, namelen);
+
+    shake256_inc_absorb_inline(state, encbuf, left_encode(encbuf, cstmlen * 8));
+    shake256_inc_absorb_inline(state, cstm, cstmlen);
+
+    if (state->ctx[25] != 0) {
+        state->ctx[25] = SHAKE256_RATE - 1;
+        encbuf[0] = 0;
+        shake256_inc_absorb_inline(state, encbuf, 1);
+    }
+}
+
+void cshake256_inc_absorb_inline(shake256incctx_inline *state, const uint8_t *input, size_t inlen) {
+    shake256_inc_absorb_inline(state, input, inlen);
+}
+
+void cshake256_inc_finalize_inline(shake256incctx_inline *state) {
+    state->ctx[state->ctx[25] >> 3] ^= (uint64_t)0x04 << (8 * (state->ctx[25] & 0x07));
+    state->ctx[(SHAKE256_RATE - 1) >> 3] ^= (uint64_t)128 << (8 * ((SHAKE256_RATE - 1) & 0x07));
+    state->ctx[25] = 0;
+}
+
+void cshake256_inc_squeeze_inline(uint8_t *output, size_t outlen, shake256incctx_inline *state) {
+    shake256_inc_squeeze_inline(output, outlen, state);
+}
+
+void cshake256_inc_ctx_clone_inline(shake256incctx_inline *dest, const shake256incctx_inline *src) {
+    shake256_inc_ctx_clone_inline(dest, src);
+}
+
 /*************************************************
  * Name:        cshake128
  *
@@ -121,12 +197,11 @@ void cshake128(uint8_t *output, size_t outlen,
                const uint8_t *name, size_t namelen,
                const uint8_t *cstm, size_t cstmlen,
                const uint8_t *input, size_t inlen) {
-    shake128incctx state;
-    cshake128_inc_init(&state, name, namelen, cstm, cstmlen);
-    cshake128_inc_absorb(&state, input, inlen);
-    cshake128_inc_finalize(&state);
-    cshake128_inc_squeeze(output, outlen, &state);
-    cshake128_inc_ctx_release(&state);
+    shake128incctx_inline state;
+    cshake128_inc_init_inline(&state, name, namelen, cstm, cstmlen);
+    cshake128_inc_absorb_inline(&state, input, inlen);
+    cshake128_inc_finalize_inline(&state);
+    cshake128_inc_squeeze_inline(output, outlen, &state);
 }
 
 /*************************************************
@@ -147,10 +222,9 @@ void cshake256(uint8_t *output, size_t outlen,
                const uint8_t *name, size_t namelen,
                const uint8_t *cstm, size_t cstmlen,
                const uint8_t *input, size_t inlen) {
-    shake256incctx state;
-    cshake256_inc_init(&state, name, namelen, cstm, cstmlen);
-    cshake256_inc_absorb(&state, input, inlen);
-    cshake256_inc_finalize(&state);
-    cshake256_inc_squeeze(output, outlen, &state);
-    cshake256_inc_ctx_release(&state);
+    shake256incctx_inline state;
+    cshake256_inc_init_inline(&state, name, namelen, cstm, cstmlen);
+    cshake256_inc_absorb_inline(&state, input, inlen);
+    cshake256_inc_finalize_inline(&state);
+    cshake256_inc_squeeze_inline(output, outlen, &state);
 }
@@ -24,4 +24,17 @@ void cshake256_inc_ctx_clone(shake256incctx *dest, const shake256incctx *src);
 
 void cshake256(uint8_t *output, size_t outlen, const uint8_t *name, size_t namelen, const uint8_t* cstm, size_t cstmlen, const uint8_t *input, size_t inlen);
 
+/* Allocation-free variants on caller-owned contexts; see fips202.h */
+void cshake128_inc_init_inline(shake128incctx_inline *state, const uint8_t *name, size_t namelen, const uint8_t *cstm, size_t cstmlen);
+void cshake128_inc_absorb_inline(shake128incctx_inline *state, const uint8_t *input, size_t inlen);
+void cshake128_inc_finalize_inline(shake128incctx_inline *state);
+void cshake128_inc_squeeze_inline(uint8_t *output, size_t outlen, shake128incctx_inline *state);
+void cshake128_inc_ctx_clone_inline(shake128incctx_inline *dest, const shake128incctx_inline *src);
+
+void cshake256_inc_init_inline(shake256incctx_inline *state, const uint8_t *name, size_t namelen, const uint8_t *cstm, size_t cstmlen);
+void cshake256_inc_absorb_inline(shake256incctx_inline *state, const uint8_t *input, size_t inlen);
+void cshake256_inc_finalize_inline(shake256incctx_inline *state);
+void cshake256_inc_squeeze_inline(uint8_t *output, size_t outlen, shake256incctx_inline *state);
+void cshake256_inc_ctx_clone_inline(shake256incctx_inline *dest, const shake256incctx_inline *src);
+
 #endif
@@ -16,6 +16,27 @@
 
 
 
+/**
+ * @brief Keygen of the HQC_KEM IND_CAA2 scheme from caller-provided randomness
+ *
+ * The public key is composed of the syndrome <b>s</b> as well as the seed used to generate the vector <b>h</b>.
+ *
+ * The secret key is composed of the seed used to generate vectors <b>x</b> and <b>y</b>.
+ * As a technicality, the public key is appended to the secret key in order to respect NIST API.
+ *
+ * @param[out] pk String containing the public key
+ * @param[out] sk String containing the secret key
+ * @param[in] coins String of CRYPTO_KEYPAIRCOINBYTES random bytes
+ * @returns 0 if keygen is successful
+ */
+int PQCLEAN_HQCRMRS192_AVX2_crypto_kem_keypair_derand(unsigned char *pk, unsigned char *sk, const unsigned char *coins) {
+
+    PQCLEAN_HQCRMRS192_AVX2_hqc_pke_keygen(pk, sk, coins);
+    return 0;
+}
+
+
+
 /**
  * @brief Keygen of the HQC_KEM IND_CAA2 scheme
  *
@@ -30,21 +51,26 @@
  */
 int PQCLEAN_HQCRMRS192_AVX2_crypto_kem_keypair(unsigned char *pk, unsigned char *sk) {
 
-    PQCLEAN_HQCRMRS192_AVX2_hqc_pke_keygen(pk, sk);
+    uint8_t coins[2 * SEED_BYTES];
+
+    randombytes(coins, SEED_BYTES);
+    randombytes(coins + SEED_BYTES, SEED_BYTES);
+    PQCLEAN_HQCRMRS192_AVX2_crypto_kem_keypair_derand(pk, sk, coins);
     return 0;
 }
 
 
 
 /**
- * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme
+ * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme from caller-provided randomness
  *
  * @param[out] ct String containing the ciphertext
  * @param[out] ss String containing the shared secret
  * @param[in] pk String containing the public key
+ * @param[in] coins String of CRYPTO_ENCCOINBYTES random bytes
  * @returns 0 if encapsulation is successful
  */
-int PQCLEAN_HQCRMRS192_AVX2_crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk) {
+int PQCLEAN_HQCRMRS192_AVX2_crypto_kem_enc_derand(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *coins) {
 
     uint8_t theta[SHA512_BYTES] = {0};
     uint8_t m[VEC_K_SIZE_BYTES] = {0};
@@ -54,7 +80,7 @@ int PQCLEAN_HQCRMRS192_AVX2_crypto_kem_enc(unsigned char *ct, unsigned char *ss,
     unsigned char mc[VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES + VEC_N1N2_SIZE_BYTES] = {0};
 
     // Computing m
-    randombytes(m, VEC_K_SIZE_BYTES);
+    memcpy(m, coins, VEC_K_SIZE_BYTES);
 
     // Computing theta
     sha3_512(theta, m, VEC_K_SIZE_BYTES);
@@ -80,6 +106,24 @@ int PQCLEAN_HQCRMRS192_AVX2_crypto_kem_enc(unsigned char *ct, unsigned char *ss,
 
 
 
+/**
+ * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme
+ *
+ * @param[out] ct String containing the ciphertext
+ * @param[out] ss String containing the shared secret
+ * @param[in] pk String containing the public key
+ * @returns 0 if encapsulation is successful
+ */
+int PQCLEAN_HQCRMRS192_AVX2_crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk) {
+
+    uint8_t coins[VEC_K_SIZE_BYTES];
+
+    randombytes(coins, VEC_K_SIZE_BYTES);
+    return PQCLEAN_HQCRMRS192_AVX2_crypto_kem_enc_derand(ct, ss, pk, coins);
+}
+
+
+
 /**
  * @brief Decapsulation of the HQC_KEM IND_CAA2 scheme
  *
@@ -24,22 +24,21 @@
  *
  * @param[out] pk String containing the public key
  * @param[out] sk String containing the secret key
+ * @param[in] coins Randomness: the secret key seed followed by the public key seed
  */
-void PQCLEAN_HQCRMRS192_CLEAN_hqc_pke_keygen(unsigned char *pk, unsigned char *sk) {
+void PQCLEAN_HQCRMRS192_CLEAN_hqc_pke_keygen(unsigned char *pk, unsigned char *sk, const uint8_t *coins) {
     AES_XOF_struct sk_seedexpander;
     AES_XOF_struct pk_seedexpander;
-    uint8_t sk_seed[SEED_BYTES] = {0};
-    uint8_t pk_seed[SEED_BYTES] = {0};
+    const uint8_t *sk_seed = coins;
+    const uint8_t *pk_seed = coins + SEED_BYTES;
     uint64_t x[VEC_N_SIZE_64] = {0};
     uint32_t y[PARAM_OMEGA] = {0};
     uint64_t h[VEC_N_SIZE_64] = {0};
     uint64_t s[VEC_N_SIZE_64] = {0};
 
     // Create seed_expanders for public key and secret key
-    randombytes(sk_seed, SEED_BYTES);
     seedexpander_init(&sk_seedexpander, sk_seed, sk_seed + 32, SEEDEXPANDER_MAX_LENGTH);
 
-    randombytes(pk_seed, SEED_BYTES);
     seedexpander_init(&pk_seedexpander, pk_seed, pk_seed + 32, SEEDEXPANDER_MAX_LENGTH);
 
     // Compute secret key
@@ -11,12 +11,18 @@
 #define PQCLEAN_HQCRMRS256_AVX2_CRYPTO_PUBLICKEYBYTES               7245
 #define PQCLEAN_HQCRMRS256_AVX2_CRYPTO_BYTES                        64
 #define PQCLEAN_HQCRMRS256_AVX2_CRYPTO_CIPHERTEXTBYTES              14469
+#define PQCLEAN_HQCRMRS256_AVX2_CRYPTO_KEYPAIRCOINBYTES             80
+#define PQCLEAN_HQCRMRS256_AVX2_CRYPTO_ENCCOINBYTES                 32
 
 // As a technicality, the public key is appended to the secret key in order to respect the NIST API.
 // Without this constraint, PQCLEAN_HQCRMRS256_AVX2_CRYPTO_SECRETKEYBYTES would be defined as 32
 
+int PQCLEAN_HQCRMRS256_AVX2_crypto_kem_keypair_derand(unsigned char *pk, unsigned char *sk, const unsigned char *coins);
+
 int PQCLEAN_HQCRMRS256_AVX2_crypto_kem_keypair(unsigned char *pk, unsigned char *sk);
 
+int PQCLEAN_HQCRMRS256_AVX2_crypto_kem_enc_derand(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const unsigned char *coins);
+
 int PQCLEAN_HQCRMRS256_AVX2_crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
 
 int PQCLEAN_HQCRMRS256_AVX2_crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
@@ -26,12 +26,13 @@
  *
  * @param[out] pk String containing the public key
  * @param[out] sk String containing the secret key
+ * @param[in] coins Randomness: the secret key seed followed by the public key seed
  */
-void PQCLEAN_HQCRMRS256_AVX2_hqc_pke_keygen(unsigned char *pk, unsigned char *sk) {
+void PQCLEAN_HQCRMRS256_AVX2_hqc_pke_keygen(unsigned char *pk, unsigned char *sk, const uint8_t *coins) {
     AES_XOF_struct sk_seedexpander;
     AES_XOF_struct pk_seedexpander;
-    uint8_t sk_seed[SEED_BYTES] = {0};
-    uint8_t pk_seed[SEED_BYTES] = {0};
+    const uint8_t *sk_seed = coins;
+    const uint8_t *pk_seed = coins + SEED_BYTES;
     aligned_vec_t vx = {0};
     uint64_t *x = vx.arr64;
     aligned_vec_t vy = {0};
@@ -44,10 +45,8 @@ void PQCLEAN_HQCRMRS256_AVX2_hqc_pke_keygen(unsigned char *pk, unsigned char *sk
     uint64_t *tmp = vtmp.arr64;
 
     // Create seed_expanders for public key and secret key
-    randombytes(sk_seed, SEED_BYTES);
     seedexpander_init(&sk_seedexpander, sk_seed, sk_seed + 32, SEEDEXPANDER_MAX_LENGTH);
 
-    randombytes(pk_seed, SEED_BYTES);
     seedexpander_init(&pk_seedexpander, pk_seed, pk_seed + 32, SEEDEXPANDER_MAX_LENGTH);
 
     // Compute secret key
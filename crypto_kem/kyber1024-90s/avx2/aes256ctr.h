@@ -21,6 +21,12 @@ void PQCLEAN_KYBER102490S_AVX2_aes256ctr_squeezeblocks(uint8_t *out,
         size_t nblocks,
         aes256ctr_ctx *state);
 
+void PQCLEAN_KYBER102490S_AVX2_aes256ctr_squeezeblocks_multi(uint8_t *out,
+        size_t nblocks,
+        const aes256ctr_ctx *state,
+        const uint64_t *nonces,
+        size_t nstreams);
+
 void PQCLEAN_KYBER102490S_AVX2_aes256ctr_prf(uint8_t *out,
         size_t outlen,
         const uint8_t key[32],
@@ -2,19 +2,62 @@
 #define PQCLEAN_KYBER102490S_AVX2_INDCPA_H
 #include "params.h"
 #include "polyvec.h"
+#include <stddef.h>
 #include <stdint.h>
 
 void PQCLEAN_KYBER102490S_AVX2_gen_matrix(polyvec *a, const uint8_t seed[KYBER_SYMBYTES], int transposed);
-void PQCLEAN_KYBER102490S_AVX2_indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
-        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
+void PQCLEAN_KYBER102490S_AVX2_indcpa_keypair_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]);
+
+void PQCLEAN_KYBER102490S_AVX2_indcpa_keypair_mkem_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t matrixseed[KYBER_SYMBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]);
+
+void PQCLEAN_KYBER102490S_AVX2_indcpa_keypair_expanded_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t expandedsk[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        uint8_t expandedpk[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]);
+
+void PQCLEAN_KYBER102490S_AVX2_indcpa_keypair_batch_derand(uint8_t *const *pk,
+        uint8_t *const *sk,
+        const uint8_t *const *coins,
+        size_t n);
 
 void PQCLEAN_KYBER102490S_AVX2_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
         const uint8_t m[KYBER_INDCPA_MSGBYTES],
         const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
         const uint8_t coins[KYBER_SYMBYTES]);
 
+void PQCLEAN_KYBER102490S_AVX2_indcpa_pk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES]);
+
+void PQCLEAN_KYBER102490S_AVX2_indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]);
+
+void PQCLEAN_KYBER102490S_AVX2_indcpa_enc_mkem_shared(uint8_t cshared[KYBER_POLYVECCOMPRESSEDBYTES],
+        polyvec *sp,
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]);
+
+void PQCLEAN_KYBER102490S_AVX2_indcpa_enc_mkem_recipient(uint8_t c[KYBER_POLYCOMPRESSEDBYTES],
+        const polyvec *sp,
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t noiseseed[KYBER_SYMBYTES]);
+
 void PQCLEAN_KYBER102490S_AVX2_indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
         const uint8_t c[KYBER_INDCPA_BYTES],
         const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
 
+void PQCLEAN_KYBER102490S_AVX2_indcpa_sk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
+
+void PQCLEAN_KYBER102490S_AVX2_indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES]);
+
 #endif
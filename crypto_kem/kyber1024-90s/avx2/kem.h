@@ -1,19 +1,61 @@
 #ifndef PQCLEAN_KYBER102490S_AVX2_KEM_H
 #define PQCLEAN_KYBER102490S_AVX2_KEM_H
 #include "params.h"
+#include <stddef.h>
 #include <stdint.h>
 
 #define PQCLEAN_KYBER102490S_AVX2_CRYPTO_SECRETKEYBYTES  KYBER_SECRETKEYBYTES
 #define PQCLEAN_KYBER102490S_AVX2_CRYPTO_PUBLICKEYBYTES  KYBER_PUBLICKEYBYTES
 #define PQCLEAN_KYBER102490S_AVX2_CRYPTO_CIPHERTEXTBYTES KYBER_CIPHERTEXTBYTES
 #define PQCLEAN_KYBER102490S_AVX2_CRYPTO_BYTES           KYBER_SSBYTES
+#define PQCLEAN_KYBER102490S_AVX2_CRYPTO_KEYPAIRCOINBYTES (2 * KYBER_SYMBYTES)
+#define PQCLEAN_KYBER102490S_AVX2_CRYPTO_ENCCOINBYTES     KYBER_SYMBYTES
+#define PQCLEAN_KYBER102490S_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES KYBER_EXPANDEDPUBLICKEYBYTES
+#define PQCLEAN_KYBER102490S_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES KYBER_EXPANDEDSECRETKEYBYTES
+#define PQCLEAN_KYBER102490S_AVX2_CRYPTO_MKEMSEEDBYTES KYBER_SYMBYTES
+#define PQCLEAN_KYBER102490S_AVX2_CRYPTO_MKEMSHAREDBYTES KYBER_POLYVECCOMPRESSEDBYTES
+#define PQCLEAN_KYBER102490S_AVX2_CRYPTO_MKEMRECIPIENTBYTES KYBER_POLYCOMPRESSEDBYTES
 
 #define PQCLEAN_KYBER102490S_AVX2_CRYPTO_ALGNAME "Kyber1024-90s"
 
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins);
+
 int PQCLEAN_KYBER102490S_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_keypair_batch(uint8_t *const *pk, uint8_t *const *sk, size_t n);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *coins);
+
 int PQCLEAN_KYBER102490S_AVX2_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_pk_expand(uint8_t *expanded, const uint8_t *pk);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_enc_expanded_derand(uint8_t *ct, uint8_t *ss, const uint8_t *expanded, const uint8_t *coins);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *expanded);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_enc_batch(uint8_t *const *ct, uint8_t *const *ss, const uint8_t *const *pk, size_t n);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_mkem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *matrixseed, const uint8_t *coins);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_mkem_keypair(uint8_t *pk, uint8_t *sk, const uint8_t *matrixseed);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_mkem_enc_derand(uint8_t *ct_shared, uint8_t *const *ct, uint8_t *ss, const uint8_t *const *pk, size_t n, const uint8_t *coins);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_mkem_enc(uint8_t *ct_shared, uint8_t *const *ct, uint8_t *ss, const uint8_t *const *pk, size_t n);
+
 int PQCLEAN_KYBER102490S_AVX2_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_mkem_dec(uint8_t *ss, const uint8_t *ct_shared, const uint8_t *ct, const uint8_t *sk);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_sk_expand(uint8_t *expanded, const uint8_t *sk);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *expanded);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_sk_expand_from_seed(uint8_t *expanded, const uint8_t *seed);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_dec_from_seed(uint8_t *ss, const uint8_t *ct, const uint8_t *seed);
+
+int PQCLEAN_KYBER102490S_AVX2_crypto_kem_dec_batch(uint8_t *const *ss, const uint8_t *const *ct, const uint8_t *sk, size_t n);
+
 #endif
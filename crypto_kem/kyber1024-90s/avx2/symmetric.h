@@ -19,6 +19,9 @@ typedef aes256ctr_ctx xof_state;
 #define xof_ctx_release(STATE)
 #define prf(OUT, OUTBYTES, KEY, NONCE) PQCLEAN_KYBER102490S_AVX2_aes256ctr_prf(OUT, OUTBYTES, KEY, NONCE)
 #define kdf(OUT, IN, INBYTES) sha256(OUT, IN, INBYTES)
+#define hash_h_batch(OUT, IN, INBYTES, N) sha256_batch(OUT, IN, INBYTES, N)
+#define hash_g_batch(OUT, IN, INBYTES, N) sha512_batch(OUT, IN, INBYTES, N)
+#define kdf_batch(OUT, IN, INBYTES, N) sha256_batch(OUT, IN, INBYTES, N)
 
 
 #endif /* SYMMETRIC_H */
@@ -0,0 +1,30 @@
+#ifndef PQCLEAN_KYBER102490S_AVX512_CDECL_H
+#define PQCLEAN_KYBER102490S_AVX512_CDECL_H
+
+
+
+#define _16XQ            0
+#define _16XQINV        16
+#define _16XV           32
+#define _16XFLO         48
+#define _16XFHI         64
+#define _16XMONTSQLO    80
+#define _16XMONTSQHI    96
+#define _16XMASK       112
+#define _REVIDXB       128
+#define _REVIDXD       144
+#define _ZETAS_EXP     160
+#define _16XSHIFT      624
+
+/* The C ABI on MacOS exports all symbols with a leading
+ * underscore. This means that any symbols we refer to from
+ * C files (functions) can't be found, and all symbols we
+ * refer to from ASM also can't be found (nttconsts.c).
+ *
+ * This define helps us get around this
+ */
+
+#define _cdecl(s) _##s
+#define cdecl(s) s
+
+#endif
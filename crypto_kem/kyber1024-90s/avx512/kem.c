@@ -0,0 +1,872 @@
+#include "indcpa.h"
+#include "kem.h"
+#include "params.h"
+#include "randombytes.h"
+#include "symmetric.h"
+#include "verify.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair_derand
+*
+* Description: Generates public and private key
+*              for CCA-secure Kyber key encapsulation mechanism
+*              from caller-provided randomness
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                (an already allocated array filled with 2*KYBER_SYMBYTES random bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair_derand(uint8_t *pk,
+        uint8_t *sk,
+        const uint8_t *coins) {
+    PQCLEAN_KYBER102490S_AVX512_indcpa_keypair_derand(pk, sk, coins);
+    memcpy(sk + KYBER_INDCPA_SECRETKEYBYTES, pk, KYBER_INDCPA_PUBLICKEYBYTES);
+    hash_h(sk + KYBER_SECRETKEYBYTES - 2 * KYBER_SYMBYTES, pk, KYBER_PUBLICKEYBYTES);
+    /* Value z for pseudo-random output on reject */
+    memcpy(sk + KYBER_SECRETKEYBYTES - KYBER_SYMBYTES, coins + KYBER_SYMBYTES, KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair
+*
+* Description: Generates public and private key
+*              for CCA-secure Kyber key encapsulation mechanism
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair(uint8_t *pk,
+        uint8_t *sk) {
+    uint8_t coins[2 * KYBER_SYMBYTES];
+    randombytes(coins, KYBER_SYMBYTES);
+    randombytes(coins + KYBER_SYMBYTES, KYBER_SYMBYTES);
+    PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair_derand(pk, sk, coins);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair_batch
+*
+* Description: Generates n key pairs for CCA-secure Kyber key
+*              encapsulation mechanism; the matrices, noise and hashes
+*              of up to KYBER_BATCH keys are computed together
+*
+* Arguments:   - uint8_t *const *pk: array of n pointers to output public keys
+*                (each an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - uint8_t *const *sk: array of n pointers to output private keys
+*                (each an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*              - size_t n: number of key pairs
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair_batch(uint8_t *const *pk,
+        uint8_t *const *sk,
+        size_t n) {
+    size_t i, j, m;
+    uint8_t coins[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    const uint8_t *in[KYBER_BATCH];
+    uint8_t *out[KYBER_BATCH];
+    size_t inlen[KYBER_BATCH];
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < KYBER_BATCH) ? n - i : KYBER_BATCH;
+
+        for (j = 0; j < m; j++) {
+            randombytes(coins[j], KYBER_SYMBYTES);
+            randombytes(coins[j] + KYBER_SYMBYTES, KYBER_SYMBYTES);
+            in[j] = coins[j];
+        }
+        PQCLEAN_KYBER102490S_AVX512_indcpa_keypair_batch_derand(pk + i, sk + i, in, m);
+
+        for (j = 0; j < m; j++) {
+            memcpy(sk[i + j] + KYBER_INDCPA_SECRETKEYBYTES, pk[i + j], KYBER_INDCPA_PUBLICKEYBYTES);
+            in[j] = pk[i + j];
+            inlen[j] = KYBER_PUBLICKEYBYTES;
+            out[j] = sk[i + j] + KYBER_SECRETKEYBYTES - 2 * KYBER_SYMBYTES;
+        }
+        hash_h_batch(out, in, inlen, m);
+
+        /* Value z for pseudo-random output on reject */
+        for (j = 0; j < m; j++) {
+            memcpy(sk[i + j] + KYBER_SECRETKEYBYTES - KYBER_SYMBYTES, coins[j] + KYBER_SYMBYTES, KYBER_SYMBYTES);
+        }
+    }
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_derand
+*
+* Description: Generates cipher text and shared
+*              secret for given public key
+*              and caller-provided randomness
+*
+* Arguments:   - uint8_t *ct: pointer to output cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                (an already allocated array filled with KYBER_SYMBYTES random bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_derand(uint8_t *ct,
+        uint8_t *ss,
+        const uint8_t *pk,
+        const uint8_t *coins) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[2 * KYBER_SYMBYTES];
+
+    /* Don't release system RNG output */
+    hash_h(buf, coins, KYBER_SYMBYTES);
+
+    /* Multitarget countermeasure for coins + contributory KEM */
+    hash_h(buf + KYBER_SYMBYTES, pk, KYBER_PUBLICKEYBYTES);
+    hash_g(kr, buf, 2 * KYBER_SYMBYTES);
+
+    /* coins are in kr+KYBER_SYMBYTES */
+    PQCLEAN_KYBER102490S_AVX512_indcpa_enc(ct, buf, pk, kr + KYBER_SYMBYTES);
+
+    /* overwrite coins in kr with H(c) */
+    hash_h(kr + KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
+    /* hash concatenation of pre-k and H(c) to k */
+    kdf(ss, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc
+*
+* Description: Generates cipher text and shared
+*              secret for given public key
+*
+* Arguments:   - uint8_t *ct: pointer to output cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc(uint8_t *ct,
+        uint8_t *ss,
+        const uint8_t *pk) {
+    uint8_t coins[KYBER_SYMBYTES];
+    randombytes(coins, KYBER_SYMBYTES);
+    PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_derand(ct, ss, pk, coins);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_pk_expand
+*
+* Description: Precomputes everything encapsulation derives from
+*              the public key alone (the matrix A^T and t in NTT domain,
+*              and H(pk)) for repeated encapsulation to the same key.
+*              The result is specific to this implementation and must
+*              not be stored or transmitted.
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded public key
+*                (an already allocated array of KYBER_EXPANDEDPUBLICKEYBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_pk_expand(uint8_t *expanded,
+        const uint8_t *pk) {
+    PQCLEAN_KYBER102490S_AVX512_indcpa_pk_expand(expanded, pk);
+    hash_h(expanded + KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES, pk, KYBER_PUBLICKEYBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_expanded_derand
+*
+* Description: Same as PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_derand,
+*              but takes a public key expanded by
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_pk_expand
+*
+* Arguments:   - uint8_t *ct: pointer to output cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *expanded: pointer to input expanded public key
+*                (an already allocated array of KYBER_EXPANDEDPUBLICKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                (an already allocated array filled with KYBER_SYMBYTES random bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_expanded_derand(uint8_t *ct,
+        uint8_t *ss,
+        const uint8_t *expanded,
+        const uint8_t *coins) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[2 * KYBER_SYMBYTES];
+
+    /* Don't release system RNG output */
+    hash_h(buf, coins, KYBER_SYMBYTES);
+
+    /* H(pk) was computed by crypto_kem_pk_expand */
+    memcpy(buf + KYBER_SYMBYTES, expanded + KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES, KYBER_SYMBYTES);
+    hash_g(kr, buf, 2 * KYBER_SYMBYTES);
+
+    /* coins are in kr+KYBER_SYMBYTES */
+    PQCLEAN_KYBER102490S_AVX512_indcpa_enc_expanded(ct, buf, expanded, kr + KYBER_SYMBYTES);
+
+    /* overwrite coins in kr with H(c) */
+    hash_h(kr + KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
+    /* hash concatenation of pre-k and H(c) to k */
+    kdf(ss, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_expanded
+*
+* Description: Same as PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc,
+*              but takes a public key expanded by
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_pk_expand
+*
+* Arguments:   - uint8_t *ct: pointer to output cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *expanded: pointer to input expanded public key
+*                (an already allocated array of KYBER_EXPANDEDPUBLICKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_expanded(uint8_t *ct,
+        uint8_t *ss,
+        const uint8_t *expanded) {
+    uint8_t coins[KYBER_SYMBYTES];
+    randombytes(coins, KYBER_SYMBYTES);
+    PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_expanded_derand(ct, ss, expanded, coins);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_batch
+*
+* Description: Generates cipher texts and shared secrets for n
+*              public keys. Up to KYBER_BATCH encapsulations are run
+*              side by side so that their hash calls can share the
+*              interleaved Keccak permutations of the batched hash API.
+*              Randomness is drawn per encapsulation in the same order as
+*              n calls to PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc,
+*              so the outputs are identical.
+*
+* Arguments:   - uint8_t *const *ct: array of n pointers to output cipher texts
+*                (each an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *const *ss: array of n pointers to output shared secrets
+*                (each an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *const *pk: array of n pointers to input public keys
+*                (each an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - size_t n: number of encapsulations
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_enc_batch(uint8_t *const *ct,
+        uint8_t *const *ss,
+        const uint8_t *const *pk,
+        size_t n) {
+    size_t i, j, m;
+    uint8_t coins[KYBER_BATCH][KYBER_SYMBYTES];
+    uint8_t buf[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    const uint8_t *in[KYBER_BATCH];
+    uint8_t *out[KYBER_BATCH];
+    size_t inlen[KYBER_BATCH];
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < KYBER_BATCH) ? n - i : KYBER_BATCH;
+
+        /* Don't release system RNG output */
+        for (j = 0; j < m; j++) {
+            randombytes(coins[j], KYBER_SYMBYTES);
+            in[j] = coins[j];
+            inlen[j] = KYBER_SYMBYTES;
+            out[j] = buf[j];
+        }
+        hash_h_batch(out, in, inlen, m);
+
+        /* Multitarget countermeasure for coins + contributory KEM */
+        for (j = 0; j < m; j++) {
+            in[j] = pk[i + j];
+            inlen[j] = KYBER_PUBLICKEYBYTES;
+            out[j] = buf[j] + KYBER_SYMBYTES;
+        }
+        hash_h_batch(out, in, inlen, m);
+
+        for (j = 0; j < m; j++) {
+            in[j] = buf[j];
+            inlen[j] = 2 * KYBER_SYMBYTES;
+            out[j] = kr[j];
+        }
+        hash_g_batch(out, in, inlen, m);
+
+        /* coins are in kr+KYBER_SYMBYTES */
+        for (j = 0; j < m; j++) {
+            PQCLEAN_KYBER102490S_AVX512_indcpa_enc(ct[i + j], buf[j], pk[i + j], kr[j] + KYBER_SYMBYTES);
+        }
+
+        /* overwrite coins in kr with H(c) */
+        for (j = 0; j < m; j++) {
+            in[j] = ct[i + j];
+            inlen[j] = KYBER_CIPHERTEXTBYTES;
+            out[j] = kr[j] + KYBER_SYMBYTES;
+        }
+        hash_h_batch(out, in, inlen, m);
+
+        /* hash concatenation of pre-k and H(c) to k */
+        for (j = 0; j < m; j++) {
+            in[j] = kr[j];
+            inlen[j] = 2 * KYBER_SYMBYTES;
+            out[j] = ss[i + j];
+        }
+        kdf_batch(out, in, inlen, m);
+    }
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_keypair_derand
+*
+* Description: Generates a key pair for multi-recipient encapsulation
+*              from caller-provided randomness. All recipients of one
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_enc call
+*              must share the matrix seed. The result is an ordinary key
+*              pair that can also be used with the single-recipient
+*              functions.
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*              - const uint8_t *matrixseed: pointer to input seed of the matrix A
+*                (an already allocated array of KYBER_SYMBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                (an already allocated array filled with 2*KYBER_SYMBYTES random bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_keypair_derand(uint8_t *pk,
+        uint8_t *sk,
+        const uint8_t *matrixseed,
+        const uint8_t *coins) {
+    PQCLEAN_KYBER102490S_AVX512_indcpa_keypair_mkem_derand(pk, sk, matrixseed, coins);
+    memcpy(sk + KYBER_INDCPA_SECRETKEYBYTES, pk, KYBER_INDCPA_PUBLICKEYBYTES);
+    hash_h(sk + KYBER_SECRETKEYBYTES - 2 * KYBER_SYMBYTES, pk, KYBER_PUBLICKEYBYTES);
+    /* Value z for pseudo-random output on reject */
+    memcpy(sk + KYBER_SECRETKEYBYTES - KYBER_SYMBYTES, coins + KYBER_SYMBYTES, KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_keypair
+*
+* Description: Generates a key pair for multi-recipient encapsulation
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*              - const uint8_t *matrixseed: pointer to input seed of the matrix A
+*                (an already allocated array of KYBER_SYMBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_keypair(uint8_t *pk,
+        uint8_t *sk,
+        const uint8_t *matrixseed) {
+    uint8_t coins[2 * KYBER_SYMBYTES];
+    randombytes(coins, 2 * KYBER_SYMBYTES);
+    PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_keypair_derand(pk, sk, matrixseed, coins);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_enc_derand
+*
+* Description: Encapsulates one shared secret to n recipients whose key
+*              pairs share the matrix seed, using caller-provided
+*              randomness. The ephemeral secret r and A^T r + e1 are
+*              computed once; every recipient only costs t^T r + e2.
+*              Recipient i receives ct_shared together with ct[i], which
+*              in this order have the layout of a regular ciphertext.
+*
+*              Since r, and with it ct_shared and the shared secret, is
+*              common to all recipients, it is derived as
+*              G(m || matrixseed) instead of G(m || H(pk)). Each H(pk[i])
+*              still enters the seed of that recipient's e2, and
+*              decapsulation re-encrypts against it. What is given up is
+*              the multi-target binding of G: a search over m is specific
+*              to a matrix seed rather than to a single public key.
+*
+* Arguments:   - uint8_t *ct_shared: pointer to output shared cipher text component
+*                (an already allocated array of KYBER_POLYVECCOMPRESSEDBYTES bytes)
+*              - uint8_t *const *ct: array of n pointers to output recipient components
+*                (each an already allocated array of KYBER_POLYCOMPRESSEDBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *const *pk: array of n pointers to input public keys
+*                (each an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - size_t n: number of recipients
+*              - const uint8_t *coins: pointer to input randomness
+*                (an already allocated array filled with KYBER_SYMBYTES random bytes)
+*
+* Returns 0 (success), or -1 if n is zero or the public keys do not
+* share their matrix seed
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_enc_derand(uint8_t *ct_shared,
+        uint8_t *const *ct,
+        uint8_t *ss,
+        const uint8_t *const *pk,
+        size_t n,
+        const uint8_t *coins) {
+    size_t j, m, l;
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[2 * KYBER_SYMBYTES];
+    uint8_t seedin[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    uint8_t noiseseed[KYBER_BATCH][KYBER_SYMBYTES];
+    const uint8_t *in[KYBER_BATCH];
+    uint8_t *out[KYBER_BATCH];
+    size_t inlen[KYBER_BATCH];
+    polyvec sp;
+
+    if (n == 0) {
+        return -1;
+    }
+    for (j = 1; j < n; j++) {
+        if (PQCLEAN_KYBER102490S_AVX512_verify(pk[0] + KYBER_POLYVECBYTES, pk[j] + KYBER_POLYVECBYTES, KYBER_SYMBYTES)) {
+            return -1;
+        }
+    }
+
+    /* Don't release system RNG output */
+    hash_h(buf, coins, KYBER_SYMBYTES);
+
+    /* The matrix seed stands in for H(pk), which differs between recipients */
+    memcpy(buf + KYBER_SYMBYTES, pk[0] + KYBER_POLYVECBYTES, KYBER_SYMBYTES);
+    hash_g(kr, buf, 2 * KYBER_SYMBYTES);
+
+    /* coins are in kr+KYBER_SYMBYTES */
+    PQCLEAN_KYBER102490S_AVX512_indcpa_enc_mkem_shared(ct_shared, &sp, pk[0], kr + KYBER_SYMBYTES);
+
+    for (l = 0; l < n; l += m) {
+        m = (n - l < KYBER_BATCH) ? n - l : KYBER_BATCH;
+
+        /* Seed of e2 for each recipient: H(coins || H(pk)) */
+        for (j = 0; j < m; j++) {
+            memcpy(seedin[j], kr + KYBER_SYMBYTES, KYBER_SYMBYTES);
+            in[j] = pk[l + j];
+            inlen[j] = KYBER_PUBLICKEYBYTES;
+            out[j] = seedin[j] + KYBER_SYMBYTES;
+        }
+        hash_h_batch(out, in, inlen, m);
+        for (j = 0; j < m; j++) {
+            in[j] = seedin[j];
+            inlen[j] = 2 * KYBER_SYMBYTES;
+            out[j] = noiseseed[j];
+        }
+        hash_h_batch(out, in, inlen, m);
+
+        for (j = 0; j < m; j++) {
+            PQCLEAN_KYBER102490S_AVX512_indcpa_enc_mkem_recipient(ct[l + j], &sp, buf, pk[l + j], noiseseed[j]);
+        }
+    }
+
+    /* overwrite coins in kr with H(ct_shared) */
+    hash_h(kr + KYBER_SYMBYTES, ct_shared, KYBER_POLYVECCOMPRESSEDBYTES);
+    /* hash concatenation of pre-k and H(ct_shared) to k */
+    kdf(ss, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_enc
+*
+* Description: Encapsulates one shared secret to n recipients whose key
+*              pairs share the matrix seed
+*
+* Arguments:   - uint8_t *ct_shared: pointer to output shared cipher text component
+*                (an already allocated array of KYBER_POLYVECCOMPRESSEDBYTES bytes)
+*              - uint8_t *const *ct: array of n pointers to output recipient components
+*                (each an already allocated array of KYBER_POLYCOMPRESSEDBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *const *pk: array of n pointers to input public keys
+*                (each an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*              - size_t n: number of recipients
+*
+* Returns 0 (success), or -1 if n is zero or the public keys do not
+* share their matrix seed
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_enc(uint8_t *ct_shared,
+        uint8_t *const *ct,
+        uint8_t *ss,
+        const uint8_t *const *pk,
+        size_t n) {
+    uint8_t coins[KYBER_SYMBYTES];
+    randombytes(coins, KYBER_SYMBYTES);
+    return PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_enc_derand(ct_shared, ct, ss, pk, n, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_dec
+*
+* Description: Recovers the shared secret of a multi-recipient
+*              encapsulation from the shared component, the component of
+*              this recipient and its private key
+*
+* Arguments:   - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *ct_shared: pointer to input shared cipher text component
+*                (an already allocated array of KYBER_POLYVECCOMPRESSEDBYTES bytes)
+*              - const uint8_t *ct: pointer to input recipient component
+*                (an already allocated array of KYBER_POLYCOMPRESSEDBYTES bytes)
+*              - const uint8_t *sk: pointer to input private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*
+* Returns 0.
+*
+* On failure, ss will contain a pseudo-random value derived from z and
+* H(ct_shared || ct), so different invalid recipient components give
+* unrelated keys.
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_mkem_dec(uint8_t *ss,
+        const uint8_t *ct_shared,
+        const uint8_t *ct,
+        const uint8_t *sk) {
+    int fail;
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[2 * KYBER_SYMBYTES];
+    uint8_t seedin[2 * KYBER_SYMBYTES];
+    uint8_t noiseseed[KYBER_SYMBYTES];
+    uint8_t hc[KYBER_SYMBYTES];
+    ALIGNED_UINT8(KYBER_CIPHERTEXTBYTES) c;
+    ALIGNED_UINT8(KYBER_CIPHERTEXTBYTES) cmp;
+    const uint8_t *pk = sk + KYBER_INDCPA_SECRETKEYBYTES;
+    polyvec sp;
+
+    memcpy(c.coeffs, ct_shared, KYBER_POLYVECCOMPRESSEDBYTES);
+    memcpy(c.coeffs + KYBER_POLYVECCOMPRESSEDBYTES, ct, KYBER_POLYCOMPRESSEDBYTES);
+
+    PQCLEAN_KYBER102490S_AVX512_indcpa_dec(buf, c.coeffs, sk);
+
+    memcpy(buf + KYBER_SYMBYTES, pk + KYBER_POLYVECBYTES, KYBER_SYMBYTES);
+    hash_g(kr, buf, 2 * KYBER_SYMBYTES);
+
+    /* Seed of e2: H(coins || H(pk)) */
+    memcpy(seedin, kr + KYBER_SYMBYTES, KYBER_SYMBYTES);
+    memcpy(seedin + KYBER_SYMBYTES, sk + KYBER_SECRETKEYBYTES - 2 * KYBER_SYMBYTES, KYBER_SYMBYTES);
+    hash_h(noiseseed, seedin, 2 * KYBER_SYMBYTES);
+
+    PQCLEAN_KYBER102490S_AVX512_indcpa_enc_mkem_shared(cmp.coeffs, &sp, pk, kr + KYBER_SYMBYTES);
+    PQCLEAN_KYBER102490S_AVX512_indcpa_enc_mkem_recipient(cmp.coeffs + KYBER_POLYVECCOMPRESSEDBYTES, &sp, buf, pk, noiseseed);
+
+    fail = PQCLEAN_KYBER102490S_AVX512_verify(c.coeffs, cmp.coeffs, KYBER_CIPHERTEXTBYTES);
+
+    /* overwrite coins in kr with H(ct_shared) */
+    hash_h(kr + KYBER_SYMBYTES, ct_shared, KYBER_POLYVECCOMPRESSEDBYTES);
+
+    /* The rejection key is recipient-specific: hash the whole cipher text */
+    hash_h(hc, c.coeffs, KYBER_CIPHERTEXTBYTES);
+
+    /* Overwrite pre-k with z and H(ct_shared) with H(ct_shared || ct) on re-encryption failure */
+    PQCLEAN_KYBER102490S_AVX512_cmov(kr, sk + KYBER_SECRETKEYBYTES - KYBER_SYMBYTES, KYBER_SYMBYTES, fail);
+    PQCLEAN_KYBER102490S_AVX512_cmov(kr + KYBER_SYMBYTES, hc, KYBER_SYMBYTES, fail);
+
+    /* hash concatenation of pre-k and H(ct_shared) to k */
+    kdf(ss, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec
+*
+* Description: Generates shared secret for given
+*              cipher text and private key
+*
+* Arguments:   - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *ct: pointer to input cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - const uint8_t *sk: pointer to input private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*
+* Returns 0.
+*
+* On failure, ss will contain a pseudo-random value.
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec(uint8_t *ss,
+        const uint8_t *ct,
+        const uint8_t *sk) {
+    int fail;
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[2 * KYBER_SYMBYTES];
+    ALIGNED_UINT8(KYBER_CIPHERTEXTBYTES) cmp;
+    const uint8_t *pk = sk + KYBER_INDCPA_SECRETKEYBYTES;
+
+    PQCLEAN_KYBER102490S_AVX512_indcpa_dec(buf, ct, sk);
+
+    /* Multitarget countermeasure for coins + contributory KEM */
+    memcpy(buf + KYBER_SYMBYTES, sk + KYBER_SECRETKEYBYTES - 2 * KYBER_SYMBYTES, KYBER_SYMBYTES);
+    hash_g(kr, buf, 2 * KYBER_SYMBYTES);
+
+    /* coins are in kr+KYBER_SYMBYTES */
+    PQCLEAN_KYBER102490S_AVX512_indcpa_enc(cmp.coeffs, buf, pk, kr + KYBER_SYMBYTES);
+
+    fail = PQCLEAN_KYBER102490S_AVX512_verify(ct, cmp.coeffs, KYBER_CIPHERTEXTBYTES);
+
+    /* overwrite coins in kr with H(c) */
+    hash_h(kr + KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
+
+    /* Overwrite pre-k with z on re-encryption failure */
+    PQCLEAN_KYBER102490S_AVX512_cmov(kr, sk + KYBER_SECRETKEYBYTES - KYBER_SYMBYTES, KYBER_SYMBYTES, fail);
+
+    /* hash concatenation of pre-k and H(c) to k */
+    kdf(ss, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand
+*
+* Description: Precomputes everything decapsulation derives from
+*              the secret key alone: the unpacked secret vector, the
+*              expanded public key used for re-encryption, H(pk) and z.
+*              The result is as sensitive as sk, is specific to this
+*              implementation and must not be stored or transmitted.
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded secret key
+*                (an already allocated array of KYBER_EXPANDEDSECRETKEYBYTES bytes)
+*              - const uint8_t *sk: pointer to input private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand(uint8_t *expanded,
+        const uint8_t *sk) {
+    PQCLEAN_KYBER102490S_AVX512_indcpa_sk_expand(expanded, sk);
+    PQCLEAN_KYBER102490S_AVX512_indcpa_pk_expand(expanded + KYBER_INDCPA_EXPANDEDSECRETKEYBYTES, sk + KYBER_INDCPA_SECRETKEYBYTES);
+    /* H(pk) and z */
+    memcpy(expanded + KYBER_EXPANDEDSECRETKEYBYTES - 2 * KYBER_SYMBYTES,
+           sk + KYBER_SECRETKEYBYTES - 2 * KYBER_SYMBYTES, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec_expanded
+*
+* Description: Same as PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec,
+*              but takes a secret key expanded by
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand
+*
+* Arguments:   - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *ct: pointer to input cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - const uint8_t *expanded: pointer to input expanded secret key
+*                (an already allocated array of KYBER_EXPANDEDSECRETKEYBYTES bytes)
+*
+* Returns 0.
+*
+* On failure, ss will contain a pseudo-random value.
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec_expanded(uint8_t *ss,
+        const uint8_t *ct,
+        const uint8_t *expanded) {
+    int fail;
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[2 * KYBER_SYMBYTES];
+    ALIGNED_UINT8(KYBER_CIPHERTEXTBYTES) cmp;
+
+    PQCLEAN_KYBER102490S_AVX512_indcpa_dec_expanded(buf, ct, expanded);
+
+    /* Multitarget countermeasure for coins + contributory KEM */
+    memcpy(buf + KYBER_SYMBYTES, expanded + KYBER_EXPANDEDSECRETKEYBYTES - 2 * KYBER_SYMBYTES, KYBER_SYMBYTES);
+    hash_g(kr, buf, 2 * KYBER_SYMBYTES);
+
+    /* coins are in kr+KYBER_SYMBYTES */
+    PQCLEAN_KYBER102490S_AVX512_indcpa_enc_expanded(cmp.coeffs, buf, expanded + KYBER_INDCPA_EXPANDEDSECRETKEYBYTES, kr + KYBER_SYMBYTES);
+
+    fail = PQCLEAN_KYBER102490S_AVX512_verify(ct, cmp.coeffs, KYBER_CIPHERTEXTBYTES);
+
+    /* overwrite coins in kr with H(c) */
+    hash_h(kr + KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
+
+    /* Overwrite pre-k with z on re-encryption failure */
+    PQCLEAN_KYBER102490S_AVX512_cmov(kr, expanded + KYBER_EXPANDEDSECRETKEYBYTES - KYBER_SYMBYTES, KYBER_SYMBYTES, fail);
+
+    /* hash concatenation of pre-k and H(c) to k */
+    kdf(ss, kr, 2 * KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand_from_seed
+*
+* Description: Builds the expanded secret key of the key pair that
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair_derand
+*              generates from seed, so that callers only need to store
+*              the seed. The matrix A sampled for key generation is reused
+*              for re-encryption. The output is identical to
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand applied to
+*              the secret key of that key pair.
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded secret key
+*                (an already allocated array of KYBER_EXPANDEDSECRETKEYBYTES bytes)
+*              - const uint8_t *seed: pointer to input key generation seed
+*                (an already allocated array of 2*KYBER_SYMBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand_from_seed(uint8_t *expanded,
+        const uint8_t *seed) {
+    uint8_t pk[KYBER_PUBLICKEYBYTES];
+
+    PQCLEAN_KYBER102490S_AVX512_indcpa_keypair_expanded_derand(pk, expanded, expanded + KYBER_INDCPA_EXPANDEDSECRETKEYBYTES, seed);
+    /* H(pk) and z */
+    hash_h(expanded + KYBER_EXPANDEDSECRETKEYBYTES - 2 * KYBER_SYMBYTES, pk, KYBER_PUBLICKEYBYTES);
+    memcpy(expanded + KYBER_EXPANDEDSECRETKEYBYTES - KYBER_SYMBYTES, seed + KYBER_SYMBYTES, KYBER_SYMBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec_from_seed
+*
+* Description: Same as PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec,
+*              but takes the 2*KYBER_SYMBYTES-byte seed passed to
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_keypair_derand
+*              instead of the secret key, and regenerates the key on the
+*              fly
+*
+* Arguments:   - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *ct: pointer to input cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - const uint8_t *seed: pointer to input key generation seed
+*                (an already allocated array of 2*KYBER_SYMBYTES bytes)
+*
+* Returns 0.
+*
+* On failure, ss will contain a pseudo-random value.
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec_from_seed(uint8_t *ss,
+        const uint8_t *ct,
+        const uint8_t *seed) {
+    uint8_t expanded[KYBER_EXPANDEDSECRETKEYBYTES];
+
+    PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand_from_seed(expanded, seed);
+    return PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec_expanded(ss, ct, expanded);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec_batch
+*
+* Description: Generates shared secrets for n cipher texts under the
+*              same secret key. The secret key and the matrix A are
+*              expanded once for the whole batch, and up to KYBER_BATCH
+*              decapsulations are run side by side so that their hash
+*              calls can share the interleaved Keccak permutations of the
+*              batched hash API. The outputs are identical to n calls to
+*              PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec,
+*              and the same constant-time re-encryption check is used.
+*
+* Arguments:   - uint8_t *const *ss: array of n pointers to output shared secrets
+*                (each an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *const *ct: array of n pointers to input cipher texts
+*                (each an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - const uint8_t *sk: pointer to input private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*              - size_t n: number of decapsulations
+*
+* Returns 0.
+*
+* On failure, ss[i] will contain a pseudo-random value.
+**************************************************/
+int PQCLEAN_KYBER102490S_AVX512_crypto_kem_dec_batch(uint8_t *const *ss,
+        const uint8_t *const *ct,
+        const uint8_t *sk,
+        size_t n) {
+    size_t i, j, m;
+    int fail[KYBER_BATCH];
+    uint8_t expanded[KYBER_EXPANDEDSECRETKEYBYTES];
+    uint8_t buf[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    /* Will contain key, coins */
+    uint8_t kr[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    ALIGNED_UINT8(KYBER_CIPHERTEXTBYTES) cmp[KYBER_BATCH];
+    const uint8_t *in[KYBER_BATCH];
+    uint8_t *out[KYBER_BATCH];
+    size_t inlen[KYBER_BATCH];
+
+    PQCLEAN_KYBER102490S_AVX512_crypto_kem_sk_expand(expanded, sk);
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < KYBER_BATCH) ? n - i : KYBER_BATCH;
+
+        for (j = 0; j < m; j++) {
+            PQCLEAN_KYBER102490S_AVX512_indcpa_dec_expanded(buf[j], ct[i + j], expanded);
+            /* Multitarget countermeasure for coins + contributory KEM */
+            memcpy(buf[j] + KYBER_SYMBYTES, expanded + KYBER_EXPANDEDSECRETKEYBYTES - 2 * KYBER_SYMBYTES, KYBER_SYMBYTES);
+            in[j] = buf[j];
+            inlen[j] = 2 * KYBER_SYMBYTES;
+            out[j] = kr[j];
+        }
+        hash_g_batch(out, in, inlen, m);
+
+        /* coins are in kr+KYBER_SYMBYTES */
+        for (j = 0; j < m; j++) {
+            PQCLEAN_KYBER102490S_AVX512_indcpa_enc_expanded(cmp[j].coeffs, buf[j], expanded + KYBER_INDCPA_EXPANDEDSECRETKEYBYTES, kr[j] + KYBER_SYMBYTES);
+            fail[j] = PQCLEAN_KYBER102490S_AVX512_verify(ct[i + j], cmp[j].coeffs, KYBER_CIPHERTEXTBYTES);
+        }
+
+        /* overwrite coins in kr with H(c) */
+        for (j = 0; j < m; j++) {
+            in[j] = ct[i + j];
+            inlen[j] = KYBER_CIPHERTEXTBYTES;
+            out[j] = kr[j] + KYBER_SYMBYTES;
+        }
+        hash_h_batch(out, in, inlen, m);
+
+        /* Overwrite pre-k with z on re-encryption failure */
+        for (j = 0; j < m; j++) {
+            PQCLEAN_KYBER102490S_AVX512_cmov(kr[j], expanded + KYBER_EXPANDEDSECRETKEYBYTES - KYBER_SYMBYTES, KYBER_SYMBYTES, fail[j]);
+        }
+
+        /* hash concatenation of pre-k and H(c) to k */
+        for (j = 0; j < m; j++) {
+            in[j] = kr[j];
+            inlen[j] = 2 * KYBER_SYMBYTES;
+            out[j] = ss[i + j];
+        }
+        kdf_batch(out, in, inlen, m);
+    }
+    return 0;
+}
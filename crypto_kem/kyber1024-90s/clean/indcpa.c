@@ -3,7 +3,6 @@
 #include "params.h"
 #include "poly.h"
 #include "polyvec.h"
-#include "randombytes.h"
 #include "symmetric.h"
 #include <stddef.h>
 #include <stdint.h>
@@ -104,6 +103,96 @@ static void unpack_ciphertext(polyvec *b, poly *v, const uint8_t c[KYBER_INDCPA_
     PQCLEAN_KYBER102490S_CLEAN_poly_decompress(v, c + KYBER_POLYVECCOMPRESSEDBYTES);
 }
 
+/*************************************************
+* Name:        pack_expanded_pk
+*
+* Description: Serialize the transposed matrix A^T and the public-key vector,
+*              both in NTT domain, into an expanded public key. Coefficients
+*              are stored as 16-bit little-endian words so that they can be
+*              loaded back without any reduction.
+*
+* Arguments:   - uint8_t *r: pointer to the output expanded public key
+*              - const polyvec *pk: pointer to the input public-key polynomial vector
+*              - const polyvec *at: pointer to the input matrix A^T
+**************************************************/
+static void pack_expanded_pk(uint8_t r[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+                             const polyvec *pk,
+                             const polyvec at[KYBER_K]) {
+    size_t i, j, k;
+    for (i = 0; i < KYBER_K + 1; i++) {
+        for (j = 0; j < KYBER_K; j++) {
+            const poly *a = (i < KYBER_K) ? &at[i].vec[j] : &pk->vec[j];
+            for (k = 0; k < KYBER_N; k++) {
+                r[2 * k + 0] = (uint8_t)(a->coeffs[k] >> 0);
+                r[2 * k + 1] = (uint8_t)(a->coeffs[k] >> 8);
+            }
+            r += 2 * KYBER_N;
+        }
+    }
+}
+
+/*************************************************
+* Name:        unpack_expanded_pk
+*
+* Description: De-serialize A^T and the public-key vector from an expanded
+*              public key; inverse of pack_expanded_pk
+*
+* Arguments:   - polyvec *pk: pointer to the output public-key polynomial vector
+*              - polyvec *at: pointer to the output matrix A^T
+*              - const uint8_t *a: pointer to the input expanded public key
+**************************************************/
+static void unpack_expanded_pk(polyvec *pk,
+                               polyvec at[KYBER_K],
+                               const uint8_t a[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES]) {
+    size_t i, j, k;
+    for (i = 0; i < KYBER_K + 1; i++) {
+        for (j = 0; j < KYBER_K; j++) {
+            poly *r = (i < KYBER_K) ? &at[i].vec[j] : &pk->vec[j];
+            for (k = 0; k < KYBER_N; k++) {
+                r->coeffs[k] = (int16_t)(a[2 * k + 0] | ((uint16_t)a[2 * k + 1] << 8));
+            }
+            a += 2 * KYBER_N;
+        }
+    }
+}
+
+/*************************************************
+* Name:        pack_expanded_sk
+*
+* Description: Serialize the secret-key vector, in NTT domain, into an
+*              expanded secret key as 16-bit little-endian words
+*
+* Arguments:   - uint8_t *r: pointer to the output expanded secret key
+*              - const polyvec *sk: pointer to the input secret-key polynomial vector
+**************************************************/
+static void pack_expanded_sk(uint8_t r[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES], const polyvec *sk) {
+    size_t i, k;
+    for (i = 0; i < KYBER_K; i++) {
+        for (k = 0; k < KYBER_N; k++) {
+            r[2 * (i * KYBER_N + k) + 0] = (uint8_t)(sk->vec[i].coeffs[k] >> 0);
+            r[2 * (i * KYBER_N + k) + 1] = (uint8_t)(sk->vec[i].coeffs[k] >> 8);
+        }
+    }
+}
+
+/*************************************************
+* Name:        unpack_expanded_sk
+*
+* Description: De-serialize the secret-key vector from an expanded
+*              secret key; inverse of pack_expanded_sk
+*
+* Arguments:   - polyvec *sk: pointer to the output secret-key polynomial vector
+*              - const uint8_t *a: pointer to the input expanded secret key
+**************************************************/
+static void unpack_expanded_sk(polyvec *sk, const uint8_t a[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES]) {
+    size_t i, k;
+    for (i = 0; i < KYBER_K; i++) {
+        for (k = 0; k < KYBER_N; k++) {
+            sk->vec[i].coeffs[k] = (int16_t)(a[2 * (i * KYBER_N + k) + 0] | ((uint16_t)a[2 * (i * KYBER_N + k) + 1] << 8));
+        }
+    }
+}
+
 /*************************************************
 * Name:        rej_uniform
 *
@@ -191,27 +280,32 @@ void PQCLEAN_KYBER102490S_CLEAN_gen_matrix(polyvec *a, const uint8_t seed[KYBER_
 }
 
 /*************************************************
-* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair
+* Name:        keypair_derand_matrix
 *
-* Description: Generates public and private key for the CPA-secure
-*              public-key encryption scheme underlying Kyber
+* Description: Key generation of the CPA-secure public-key encryption
+*              scheme that also returns the matrix A it sampled; shared by
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_derand,
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_expanded_derand and
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_mkem_derand
 *
 * Arguments:   - uint8_t *pk: pointer to output public key
 *                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
 *              - uint8_t *sk: pointer to output private key
-                              (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*                             (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - polyvec *a: pointer to output matrix A
+*              - const uint8_t *publicseed: pointer to input seed of A
+*                             (of length KYBER_SYMBYTES bytes)
+*              - const uint8_t *noiseseed: pointer to input seed of s and e
+*                             (of length KYBER_SYMBYTES bytes)
 **************************************************/
-void PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
-        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
+static void keypair_derand_matrix(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+                                  uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+                                  polyvec a[KYBER_K],
+                                  const uint8_t publicseed[KYBER_SYMBYTES],
+                                  const uint8_t noiseseed[KYBER_SYMBYTES]) {
     unsigned int i;
-    uint8_t buf[2 * KYBER_SYMBYTES];
-    const uint8_t *publicseed = buf;
-    const uint8_t *noiseseed = buf + KYBER_SYMBYTES;
     uint8_t nonce = 0;
-    polyvec a[KYBER_K], e, pkpv, skpv;
-
-    randombytes(buf, KYBER_SYMBYTES);
-    hash_g(buf, buf, KYBER_SYMBYTES);
+    polyvec e, pkpv, skpv;
 
     gen_a(a, publicseed);
 
@@ -239,34 +333,166 @@ void PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEY
 }
 
 /*************************************************
-* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_enc
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_derand
 *
-* Description: Encryption function of the CPA-secure
-*              public-key encryption scheme underlying Kyber.
+* Description: Generates public and private key for the CPA-secure
+*              public-key encryption scheme underlying Kyber
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+                              (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    polyvec a[KYBER_K];
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, buf, buf + KYBER_SYMBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_mkem_derand
+*
+* Description: Same as PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_derand, but
+*              expands the matrix A from a caller-provided seed, so that a
+*              group of key pairs can share it
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                             (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *matrixseed: pointer to input seed of A
+*                             (of length KYBER_SYMBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_mkem_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t matrixseed[KYBER_SYMBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    polyvec a[KYBER_K];
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, matrixseed, buf + KYBER_SYMBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_expanded_derand
+*
+* Description: Same as PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_derand, but
+*              outputs the secret key as produced by
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_sk_expand and, in addition,
+*              the expanded public key as produced by
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_pk_expand. A^T is obtained by
+*              transposing the matrix A of key generation instead of
+*              being sampled a second time.
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *expandedsk: pointer to output expanded secret key
+*                             (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES bytes)
+*              - uint8_t *expandedpk: pointer to output expanded public key
+*                             (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_expanded_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t expandedsk[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        uint8_t expandedpk[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    unsigned int i, j;
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES];
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec a[KYBER_K], at[KYBER_K], pkpv, skpv;
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, buf, buf + KYBER_SYMBYTES);
+
+    for (i = 0; i < KYBER_K; i++) {
+        for (j = 0; j < KYBER_K; j++) {
+            at[i].vec[j] = a[j].vec[i];
+        }
+    }
+
+    /* Go through the packed keys so that the result matches sk_expand and pk_expand */
+    unpack_sk(&skpv, sk);
+    unpack_pk(&pkpv, seed, pk);
+    pack_expanded_sk(expandedsk, &skpv);
+    pack_expanded_pk(expandedpk, &pkpv, at);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_batch_derand
+*
+* Description: Generates n key pairs for the CPA-secure public-key
+*              encryption scheme, identical to n calls of
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_derand; the seed expansions of all
+*              keys are hashed together.
+*
+* Arguments:   - uint8_t *const *pk: array of n pointers to output public keys
+*                             (each of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *const *sk: array of n pointers to output private keys
+*                             (each of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *const *coins: array of n pointers to input randomness
+*                             (each of length KYBER_SYMBYTES bytes)
+*              - size_t n: number of key pairs, at most KYBER_BATCH
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_keypair_batch_derand(uint8_t *const *pk,
+        uint8_t *const *sk,
+        const uint8_t *const *coins,
+        size_t n) {
+    size_t k;
+    uint8_t buf[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    uint8_t *out[KYBER_BATCH];
+    size_t inlen[KYBER_BATCH];
+    polyvec a[KYBER_K];
+
+    for (k = 0; k < KYBER_BATCH; k++) {
+        out[k] = buf[k];
+        inlen[k] = KYBER_SYMBYTES;
+    }
+    hash_g_batch(out, coins, inlen, n);
+
+    for (k = 0; k < n; k++) {
+        keypair_derand_matrix(pk[k], sk[k], a, buf[k], buf[k] + KYBER_SYMBYTES);
+    }
+}
+
+/*************************************************
+* Name:        enc_unpacked
+*
+* Description: Encryption with an already unpacked public key; shared by
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_enc and
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_expanded
 *
 * Arguments:   - uint8_t *c: pointer to output ciphertext
 *                            (of length KYBER_INDCPA_BYTES bytes)
 *              - const uint8_t *m: pointer to input message
 *                                  (of length KYBER_INDCPA_MSGBYTES bytes)
-*              - const uint8_t *pk: pointer to input public key
-*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const polyvec *pkpv: pointer to input public-key polynomial vector
+*              - const polyvec *at: pointer to input matrix A^T
 *              - const uint8_t *coins: pointer to input random coins used as seed
 *                                      (of length KYBER_SYMBYTES) to deterministically
 *                                      generate all randomness
 **************************************************/
-void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
-        const uint8_t m[KYBER_INDCPA_MSGBYTES],
-        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
-        const uint8_t coins[KYBER_SYMBYTES]) {
+static void enc_unpacked(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const polyvec *pkpv,
+                         const polyvec at[KYBER_K],
+                         const uint8_t coins[KYBER_SYMBYTES]) {
     unsigned int i;
-    uint8_t seed[KYBER_SYMBYTES];
     uint8_t nonce = 0;
-    polyvec sp, pkpv, ep, at[KYBER_K], b;
+    polyvec sp, ep, b;
     poly v, k, epp;
 
-    unpack_pk(&pkpv, seed, pk);
     PQCLEAN_KYBER102490S_CLEAN_poly_frommsg(&k, m);
-    gen_at(at, seed);
 
     for (i = 0; i < KYBER_K; i++) {
         PQCLEAN_KYBER102490S_CLEAN_poly_getnoise_eta1(sp.vec + i, coins, nonce++);
@@ -283,7 +509,7 @@ void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
         PQCLEAN_KYBER102490S_CLEAN_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
     }
 
-    PQCLEAN_KYBER102490S_CLEAN_polyvec_basemul_acc_montgomery(&v, &pkpv, &sp);
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_basemul_acc_montgomery(&v, pkpv, &sp);
 
     PQCLEAN_KYBER102490S_CLEAN_polyvec_invntt_tomont(&b);
     PQCLEAN_KYBER102490S_CLEAN_poly_invntt_tomont(&v);
@@ -297,6 +523,208 @@ void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
     pack_ciphertext(c, &b, &v);
 }
 
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_enc
+*
+* Description: Encryption function of the CPA-secure
+*              public-key encryption scheme underlying Kyber.
+*
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_pk(&pkpv, seed, pk);
+    gen_at(at, seed);
+    enc_unpacked(c, m, &pkpv, at, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_pk_expand
+*
+* Description: Precompute everything indcpa_enc derives from the public key
+*              alone: the public-key vector t and the matrix A^T, both in
+*              NTT domain
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded public key
+*                                   (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_pk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_pk(&pkpv, seed, pk);
+    gen_at(at, seed);
+    pack_expanded_pk(expanded, &pkpv, at);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_expanded
+*
+* Description: Same as PQCLEAN_KYBER102490S_CLEAN_indcpa_enc, but takes
+*              the public key in the form produced by
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_pk_expand
+*
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *expanded: pointer to input expanded public key
+*                                         (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_expanded_pk(&pkpv, at, expanded);
+    enc_unpacked(c, m, &pkpv, at, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_mkem_shared
+*
+* Description: Recipient-independent part of multi-recipient encryption:
+*              samples the ephemeral secret r and the noise e1 from coins
+*              and computes the shared ciphertext component
+*              u = Compress(A^T r + e1). All recipients must use the matrix
+*              A of pk.
+*
+* Arguments:   - uint8_t *cshared: pointer to output shared component
+*                                  (of length KYBER_POLYVECCOMPRESSEDBYTES bytes)
+*              - polyvec *sp: pointer to output ephemeral secret r in NTT domain,
+*                             to be passed to
+*                             PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_mkem_recipient
+*              - const uint8_t *pk: pointer to input public key of any recipient
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_mkem_shared(uint8_t cshared[KYBER_POLYVECCOMPRESSEDBYTES],
+        polyvec *sp,
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    unsigned int i;
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv, ep, b, at[KYBER_K];
+
+    unpack_pk(&pkpv, seed, pk);
+    gen_at(at, seed);
+
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER102490S_CLEAN_poly_getnoise_eta1(&sp->vec[i], coins, (uint8_t)i);
+    }
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER102490S_CLEAN_poly_getnoise_eta2(&ep.vec[i], coins, (uint8_t)(KYBER_K + i));
+    }
+
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_ntt(sp);
+
+    // matrix-vector multiplication
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER102490S_CLEAN_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], sp);
+    }
+
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_invntt_tomont(&b);
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_add(&b, &b, &ep);
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_reduce(&b);
+
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_compress(cshared, &b);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_mkem_recipient
+*
+* Description: Per-recipient part of multi-recipient encryption: computes
+*              v = Compress(t^T r + e2 + Encode(m)) for the public key t
+*              of one recipient. The noise e2 is sampled from a seed that
+*              must be different for every recipient.
+*
+* Arguments:   - uint8_t *c: pointer to output recipient component
+*                            (of length KYBER_POLYCOMPRESSEDBYTES bytes)
+*              - const polyvec *sp: pointer to input ephemeral secret r as returned by
+*                                   PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_mkem_shared
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key of the recipient
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *noiseseed: pointer to input seed of e2
+*                                          (of length KYBER_SYMBYTES)
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc_mkem_recipient(uint8_t c[KYBER_POLYCOMPRESSEDBYTES],
+        const polyvec *sp,
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t noiseseed[KYBER_SYMBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv;
+    poly v, k, epp;
+
+    unpack_pk(&pkpv, seed, pk);
+    PQCLEAN_KYBER102490S_CLEAN_poly_frommsg(&k, m);
+    PQCLEAN_KYBER102490S_CLEAN_poly_getnoise_eta2(&epp, noiseseed, 0);
+
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_basemul_acc_montgomery(&v, &pkpv, sp);
+    PQCLEAN_KYBER102490S_CLEAN_poly_invntt_tomont(&v);
+
+    PQCLEAN_KYBER102490S_CLEAN_poly_add(&v, &v, &epp);
+    PQCLEAN_KYBER102490S_CLEAN_poly_add(&v, &v, &k);
+    PQCLEAN_KYBER102490S_CLEAN_poly_reduce(&v);
+
+    PQCLEAN_KYBER102490S_CLEAN_poly_compress(c, &v);
+}
+
+/*************************************************
+* Name:        dec_unpacked
+*
+* Description: Decryption with an already unpacked secret key; shared by
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_dec and
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_dec_expanded
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const polyvec *skpv: pointer to input secret-key polynomial vector
+**************************************************/
+static void dec_unpacked(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const polyvec *skpv) {
+    polyvec b;
+    poly v, mp;
+
+    unpack_ciphertext(&b, &v, c);
+
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_ntt(&b);
+    PQCLEAN_KYBER102490S_CLEAN_polyvec_basemul_acc_montgomery(&mp, skpv, &b);
+    PQCLEAN_KYBER102490S_CLEAN_poly_invntt_tomont(&mp);
+
+    PQCLEAN_KYBER102490S_CLEAN_poly_sub(&mp, &v, &mp);
+    PQCLEAN_KYBER102490S_CLEAN_poly_reduce(&mp);
+
+    PQCLEAN_KYBER102490S_CLEAN_poly_tomsg(m, &mp);
+}
+
 /*************************************************
 * Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_dec
 *
@@ -313,18 +741,50 @@ void PQCLEAN_KYBER102490S_CLEAN_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
 void PQCLEAN_KYBER102490S_CLEAN_indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
         const uint8_t c[KYBER_INDCPA_BYTES],
         const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
-    polyvec b, skpv;
-    poly v, mp;
+    polyvec skpv;
 
-    unpack_ciphertext(&b, &v, c);
     unpack_sk(&skpv, sk);
+    dec_unpacked(m, c, &skpv);
+}
 
-    PQCLEAN_KYBER102490S_CLEAN_polyvec_ntt(&b);
-    PQCLEAN_KYBER102490S_CLEAN_polyvec_basemul_acc_montgomery(&mp, &skpv, &b);
-    PQCLEAN_KYBER102490S_CLEAN_poly_invntt_tomont(&mp);
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_sk_expand
+*
+* Description: Unpack the secret-key vector s once so that it can be
+*              reused by PQCLEAN_KYBER102490S_CLEAN_indcpa_dec_expanded
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded secret key
+*                                   (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES)
+*              - const uint8_t *sk: pointer to input secret key
+*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_sk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
+    polyvec skpv;
 
-    PQCLEAN_KYBER102490S_CLEAN_poly_sub(&mp, &v, &mp);
-    PQCLEAN_KYBER102490S_CLEAN_poly_reduce(&mp);
+    unpack_sk(&skpv, sk);
+    pack_expanded_sk(expanded, &skpv);
+}
 
-    PQCLEAN_KYBER102490S_CLEAN_poly_tomsg(m, &mp);
+/*************************************************
+* Name:        PQCLEAN_KYBER102490S_CLEAN_indcpa_dec_expanded
+*
+* Description: Same as PQCLEAN_KYBER102490S_CLEAN_indcpa_dec, but takes
+*              the secret key in the form produced by
+*              PQCLEAN_KYBER102490S_CLEAN_indcpa_sk_expand
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const uint8_t *expanded: pointer to input expanded secret key
+*                                         (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER102490S_CLEAN_indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES]) {
+    polyvec skpv;
+
+    unpack_expanded_sk(&skpv, expanded);
+    dec_unpacked(m, c, &skpv);
 }
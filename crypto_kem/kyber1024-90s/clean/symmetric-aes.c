@@ -12,7 +12,7 @@ static inline void br_enc32be(unsigned char *dst, uint32_t x) {
     dst[0] = (unsigned char)(x >> 24);
 }
 
-static void aes256_ctr_xof(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes256ctx *ctx) {
+static void aes256_ctr_xof(unsigned char *out, size_t outlen, const unsigned char *iv, uint32_t ctr, const aes256ctx_inline *ctx) {
     uint8_t ivw[16];
     uint8_t buf[AES_BLOCKBYTES];
     size_t i = 0;
@@ -21,13 +21,13 @@ static void aes256_ctr_xof(unsigned char *out, size_t outlen, const unsigned cha
     br_enc32be(ivw + AESCTR_NONCEBYTES, ctr);
 
     while (outlen > AES_BLOCKBYTES) {
-        aes256_ecb(out, ivw, 1, ctx);
+        aes256_ecb_inline(out, ivw, 1, ctx);
         br_enc32be(ivw + AESCTR_NONCEBYTES, ++ctr);
         out += AES_BLOCKBYTES;
         outlen -= AES_BLOCKBYTES;
     }
     if (outlen > 0) {
-        aes256_ecb(buf, ivw, 1, ctx);
+        aes256_ecb_inline(buf, ivw, 1, ctx);
         for (i = 0; i < outlen; i++) {
             out[i] = buf[i];
         }
@@ -52,10 +52,9 @@ void PQCLEAN_KYBER102490S_CLEAN_aes256ctr_prf(uint8_t *output, size_t outlen, co
     }
     iv[0] = nonce;
 
-    aes256ctx ctx;
-    aes256_ctr_keyexp(&ctx, key);
-    aes256_ctr(output, outlen, iv, &ctx);
-    aes256_ctx_release(&ctx);
+    aes256ctx_inline ctx;
+    aes256_ctr_keyexp_inline(&ctx, key);
+    aes256_ctr_inline(output, outlen, iv, &ctx);
 }
 
 /*************************************************
@@ -71,7 +70,7 @@ void PQCLEAN_KYBER102490S_CLEAN_aes256ctr_prf(uint8_t *output, size_t outlen, co
 *              - uint8_t y:           second additional byte to "absorb"
 **************************************************/
 void PQCLEAN_KYBER102490S_CLEAN_aes256xof_absorb(aes256xof_ctx *s, const uint8_t *key, uint8_t x, uint8_t y) {
-    aes256_ecb_keyexp(&s->sk_exp, key);
+    aes256_ecb_keyexp_inline(&s->sk_exp, key);
     for (int i = 2; i < 12; i++) {
         s->iv[i] = 0;
     }
@@ -94,7 +93,3 @@ void PQCLEAN_KYBER102490S_CLEAN_aes256xof_squeezeblocks(uint8_t *out, size_t nbl
     aes256_ctr_xof(out, nblocks * 64, s->iv, s->ctr, &s->sk_exp);
     s->ctr += (uint32_t) (4 * nblocks);
 }
-
-void PQCLEAN_KYBER102490S_CLEAN_aes256xof_ctx_release(aes256xof_ctx *s) {
-    aes256_ctx_release(&s->sk_exp);
-}
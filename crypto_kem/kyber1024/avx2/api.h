@@ -1,18 +1,60 @@
 #ifndef PQCLEAN_KYBER1024_AVX2_API_H
 #define PQCLEAN_KYBER1024_AVX2_API_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define PQCLEAN_KYBER1024_AVX2_CRYPTO_SECRETKEYBYTES  3168
 #define PQCLEAN_KYBER1024_AVX2_CRYPTO_PUBLICKEYBYTES  1568
 #define PQCLEAN_KYBER1024_AVX2_CRYPTO_CIPHERTEXTBYTES 1568
 #define PQCLEAN_KYBER1024_AVX2_CRYPTO_BYTES           32
+#define PQCLEAN_KYBER1024_AVX2_CRYPTO_KEYPAIRCOINBYTES 64
+#define PQCLEAN_KYBER1024_AVX2_CRYPTO_ENCCOINBYTES     32
+#define PQCLEAN_KYBER1024_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES 10272
+#define PQCLEAN_KYBER1024_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES 12352
+#define PQCLEAN_KYBER1024_AVX2_CRYPTO_MKEMSEEDBYTES 32
+#define PQCLEAN_KYBER1024_AVX2_CRYPTO_MKEMSHAREDBYTES 1408
+#define PQCLEAN_KYBER1024_AVX2_CRYPTO_MKEMRECIPIENTBYTES 160
 #define PQCLEAN_KYBER1024_AVX2_CRYPTO_ALGNAME "Kyber1024"
 
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins);
+
 int PQCLEAN_KYBER1024_AVX2_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_keypair_batch(uint8_t *const *pk, uint8_t *const *sk, size_t n);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *coins);
+
 int PQCLEAN_KYBER1024_AVX2_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_pk_expand(uint8_t *expanded, const uint8_t *pk);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_enc_expanded_derand(uint8_t *ct, uint8_t *ss, const uint8_t *expanded, const uint8_t *coins);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *expanded);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_enc_batch(uint8_t *const *ct, uint8_t *const *ss, const uint8_t *const *pk, size_t n);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_mkem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *matrixseed, const uint8_t *coins);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_mkem_keypair(uint8_t *pk, uint8_t *sk, const uint8_t *matrixseed);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_mkem_enc_derand(uint8_t *ct_shared, uint8_t *const *ct, uint8_t *ss, const uint8_t *const *pk, size_t n, const uint8_t *coins);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_mkem_enc(uint8_t *ct_shared, uint8_t *const *ct, uint8_t *ss, const uint8_t *const *pk, size_t n);
+
 int PQCLEAN_KYBER1024_AVX2_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_mkem_dec(uint8_t *ss, const uint8_t *ct_shared, const uint8_t *ct, const uint8_t *sk);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_sk_expand(uint8_t *expanded, const uint8_t *sk);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *expanded);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_sk_expand_from_seed(uint8_t *expanded, const uint8_t *seed);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_dec_from_seed(uint8_t *ss, const uint8_t *ct, const uint8_t *seed);
+
+int PQCLEAN_KYBER1024_AVX2_crypto_kem_dec_batch(uint8_t *const *ss, const uint8_t *const *ct, const uint8_t *sk, size_t n);
+
 #endif
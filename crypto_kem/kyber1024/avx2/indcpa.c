@@ -5,7 +5,6 @@
 #include "params.h"
 #include "poly.h"
 #include "polyvec.h"
-#include "randombytes.h"
 #include "rejsample.h"
 #include "symmetric.h"
 #include <immintrin.h>
@@ -112,6 +111,68 @@ static void unpack_ciphertext(polyvec *b, poly *v, const uint8_t c[KYBER_INDCPA_
     PQCLEAN_KYBER1024_AVX2_poly_decompress(v, c + KYBER_POLYVECCOMPRESSEDBYTES);
 }
 
+/*************************************************
+* Name:        pack_expanded_pk
+*
+* Description: Store the transposed matrix A^T and the public-key vector,
+*              both in NTT domain and in the coefficient order expected by
+*              the multiplication routines, in an expanded public key
+*
+* Arguments:   - uint8_t *r: pointer to the output expanded public key
+*              - const polyvec *pk: pointer to the input public-key polynomial vector
+*              - const polyvec *at: pointer to the input matrix A^T
+**************************************************/
+static void pack_expanded_pk(uint8_t r[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+                             const polyvec *pk,
+                             const polyvec at[KYBER_K]) {
+    memcpy(r, at, KYBER_K * sizeof(polyvec));
+    memcpy(r + KYBER_K * sizeof(polyvec), pk, sizeof(polyvec));
+}
+
+/*************************************************
+* Name:        unpack_expanded_pk
+*
+* Description: Load A^T and the public-key vector from an expanded public key;
+*              inverse of pack_expanded_pk
+*
+* Arguments:   - polyvec *pk: pointer to the output public-key polynomial vector
+*              - polyvec *at: pointer to the output matrix A^T
+*              - const uint8_t *a: pointer to the input expanded public key
+**************************************************/
+static void unpack_expanded_pk(polyvec *pk,
+                               polyvec at[KYBER_K],
+                               const uint8_t a[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES]) {
+    memcpy(at, a, KYBER_K * sizeof(polyvec));
+    memcpy(pk, a + KYBER_K * sizeof(polyvec), sizeof(polyvec));
+}
+
+/*************************************************
+* Name:        pack_expanded_sk
+*
+* Description: Store the secret-key vector, in NTT domain and in the
+*              coefficient order expected by the multiplication routines,
+*              in an expanded secret key
+*
+* Arguments:   - uint8_t *r: pointer to the output expanded secret key
+*              - const polyvec *sk: pointer to the input secret-key polynomial vector
+**************************************************/
+static void pack_expanded_sk(uint8_t r[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES], const polyvec *sk) {
+    memcpy(r, sk, sizeof(polyvec));
+}
+
+/*************************************************
+* Name:        unpack_expanded_sk
+*
+* Description: Load the secret-key vector from an expanded secret key;
+*              inverse of pack_expanded_sk
+*
+* Arguments:   - polyvec *sk: pointer to the output secret-key polynomial vector
+*              - const uint8_t *a: pointer to the input expanded secret key
+**************************************************/
+static void unpack_expanded_sk(polyvec *sk, const uint8_t a[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES]) {
+    memcpy(sk, a, sizeof(polyvec));
+}
+
 /*************************************************
 * Name:        rej_uniform
 *
@@ -222,47 +283,393 @@ void PQCLEAN_KYBER1024_AVX2_gen_matrix(polyvec *a, const uint8_t seed[32], int t
 }
 
 /*************************************************
-* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_keypair
+* Name:        gen_matrix_entries_4x
 *
-* Description: Generates public and private key for the CPA-secure
-*              public-key encryption scheme underlying Kyber
+* Description: Samples four entries of matrices A through one 4-way
+*              SHAKE128 instance. The entries may belong to matrices of
+*              different seeds; each equals the corresponding entry of
+*              PQCLEAN_KYBER1024_AVX2_gen_matrix(a, seed, 0).
+*
+* Arguments:   - poly *r0, *r1, *r2, *r3: pointers to output polynomials
+*              - const uint8_t *seed0, ..., *seed3: pointers to input seeds
+*                                     (each of length KYBER_SYMBYTES bytes)
+*              - uint16_t pos0, ..., pos3: positions of the entries, row
+*                                          in the high and column in the
+*                                          low byte
+**************************************************/
+static void gen_matrix_entries_4x(poly *r0,
+                                  poly *r1,
+                                  poly *r2,
+                                  poly *r3,
+                                  const uint8_t seed0[KYBER_SYMBYTES],
+                                  const uint8_t seed1[KYBER_SYMBYTES],
+                                  const uint8_t seed2[KYBER_SYMBYTES],
+                                  const uint8_t seed3[KYBER_SYMBYTES],
+                                  uint16_t pos0,
+                                  uint16_t pos1,
+                                  uint16_t pos2,
+                                  uint16_t pos3) {
+    unsigned int ctr0, ctr1, ctr2, ctr3;
+    ALIGNED_UINT8(REJ_UNIFORM_AVX_NBLOCKS * SHAKE128_RATE) buf[4];
+    keccakx4_state state;
+
+    _mm256_store_si256(buf[0].vec, _mm256_loadu_si256((__m256i *)seed0));
+    _mm256_store_si256(buf[1].vec, _mm256_loadu_si256((__m256i *)seed1));
+    _mm256_store_si256(buf[2].vec, _mm256_loadu_si256((__m256i *)seed2));
+    _mm256_store_si256(buf[3].vec, _mm256_loadu_si256((__m256i *)seed3));
+
+    buf[0].coeffs[32] = pos0 & 0xFF;
+    buf[0].coeffs[33] = pos0 >> 8;
+    buf[1].coeffs[32] = pos1 & 0xFF;
+    buf[1].coeffs[33] = pos1 >> 8;
+    buf[2].coeffs[32] = pos2 & 0xFF;
+    buf[2].coeffs[33] = pos2 >> 8;
+    buf[3].coeffs[32] = pos3 & 0xFF;
+    buf[3].coeffs[33] = pos3 >> 8;
+
+    PQCLEAN_KYBER1024_AVX2_shake128x4_absorb_once(&state, buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, 34);
+    PQCLEAN_KYBER1024_AVX2_shake128x4_squeezeblocks(buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, REJ_UNIFORM_AVX_NBLOCKS, &state);
+
+    ctr0 = PQCLEAN_KYBER1024_AVX2_rej_uniform_avx(r0->coeffs, buf[0].coeffs);
+    ctr1 = PQCLEAN_KYBER1024_AVX2_rej_uniform_avx(r1->coeffs, buf[1].coeffs);
+    ctr2 = PQCLEAN_KYBER1024_AVX2_rej_uniform_avx(r2->coeffs, buf[2].coeffs);
+    ctr3 = PQCLEAN_KYBER1024_AVX2_rej_uniform_avx(r3->coeffs, buf[3].coeffs);
+
+    while (ctr0 < KYBER_N || ctr1 < KYBER_N || ctr2 < KYBER_N || ctr3 < KYBER_N) {
+        PQCLEAN_KYBER1024_AVX2_shake128x4_squeezeblocks(buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, 1, &state);
+
+        ctr0 += rej_uniform(r0->coeffs + ctr0, KYBER_N - ctr0, buf[0].coeffs, SHAKE128_RATE);
+        ctr1 += rej_uniform(r1->coeffs + ctr1, KYBER_N - ctr1, buf[1].coeffs, SHAKE128_RATE);
+        ctr2 += rej_uniform(r2->coeffs + ctr2, KYBER_N - ctr2, buf[2].coeffs, SHAKE128_RATE);
+        ctr3 += rej_uniform(r3->coeffs + ctr3, KYBER_N - ctr3, buf[3].coeffs, SHAKE128_RATE);
+    }
+
+    PQCLEAN_KYBER1024_AVX2_poly_nttunpack(r0);
+    PQCLEAN_KYBER1024_AVX2_poly_nttunpack(r1);
+    PQCLEAN_KYBER1024_AVX2_poly_nttunpack(r2);
+    PQCLEAN_KYBER1024_AVX2_poly_nttunpack(r3);
+}
+
+
+/*************************************************
+* Name:        keypair_from_noise
+*
+* Description: Computes t = As + e and packs the key pair of the
+*              CPA-secure public-key encryption scheme
 *
 * Arguments:   - uint8_t *pk: pointer to output public key
 *                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
 *              - uint8_t *sk: pointer to output private key
-                              (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*                             (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const polyvec *a: pointer to input matrix A
+*              - polyvec *skpv: pointer to input secret vector s,
+*                               transformed to the NTT domain in place
+*              - polyvec *e: pointer to input error vector e,
+*                            transformed to the NTT domain in place
+*              - const uint8_t *publicseed: pointer to input seed of A
+*                             (of length KYBER_SYMBYTES bytes)
 **************************************************/
-void PQCLEAN_KYBER1024_AVX2_indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
-        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
+static void keypair_from_noise(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+                               uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+                               const polyvec a[KYBER_K],
+                               polyvec *skpv,
+                               polyvec *e,
+                               const uint8_t publicseed[KYBER_SYMBYTES]) {
     unsigned int i;
-    uint8_t buf[2 * KYBER_SYMBYTES];
-    const uint8_t *publicseed = buf;
-    const uint8_t *noiseseed = buf + KYBER_SYMBYTES;
-    polyvec a[KYBER_K], e, pkpv, skpv;
+    polyvec pkpv;
 
-    randombytes(buf, KYBER_SYMBYTES);
-    hash_g(buf, buf, KYBER_SYMBYTES);
+    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(skpv);
+    PQCLEAN_KYBER1024_AVX2_polyvec_reduce(skpv);
+    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(e);
+
+    // matrix-vector multiplication
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&pkpv.vec[i], &a[i], skpv);
+        PQCLEAN_KYBER1024_AVX2_poly_tomont(&pkpv.vec[i]);
+    }
+
+    PQCLEAN_KYBER1024_AVX2_polyvec_add(&pkpv, &pkpv, e);
+    PQCLEAN_KYBER1024_AVX2_polyvec_reduce(&pkpv);
+
+    pack_sk(sk, skpv);
+    pack_pk(pk, &pkpv, publicseed);
+}
+
+/*************************************************
+* Name:        keypair_derand_matrix
+*
+* Description: Key generation of the CPA-secure public-key encryption
+*              scheme that also returns the matrix A it sampled; shared by
+*              PQCLEAN_KYBER1024_AVX2_indcpa_keypair_derand,
+*              PQCLEAN_KYBER1024_AVX2_indcpa_keypair_expanded_derand and
+*              PQCLEAN_KYBER1024_AVX2_indcpa_keypair_mkem_derand
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                             (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - polyvec *a: pointer to output matrix A
+*              - const uint8_t *publicseed: pointer to input seed of A
+*                             (of length KYBER_SYMBYTES bytes)
+*              - const uint8_t *noiseseed: pointer to input seed of s and e
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+static void keypair_derand_matrix(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+                                  uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+                                  polyvec a[KYBER_K],
+                                  const uint8_t publicseed[KYBER_SYMBYTES],
+                                  const uint8_t noiseseed[KYBER_SYMBYTES]) {
+    polyvec e, skpv;
 
     gen_a(a, publicseed);
 
     PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1_4x(skpv.vec + 0, skpv.vec + 1, skpv.vec + 2, skpv.vec + 3, noiseseed,  0, 1, 2, 3);
     PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1_4x(e.vec + 0, e.vec + 1, e.vec + 2, e.vec + 3, noiseseed, 4, 5, 6, 7);
 
-    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(&skpv);
-    PQCLEAN_KYBER1024_AVX2_polyvec_reduce(&skpv);
-    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(&e);
+    keypair_from_noise(pk, sk, a, &skpv, &e, publicseed);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_keypair_derand
+*
+* Description: Generates public and private key for the CPA-secure
+*              public-key encryption scheme underlying Kyber
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+                              (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_keypair_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    polyvec a[KYBER_K];
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, buf, buf + KYBER_SYMBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_keypair_mkem_derand
+*
+* Description: Same as PQCLEAN_KYBER1024_AVX2_indcpa_keypair_derand, but
+*              expands the matrix A from a caller-provided seed, so that a
+*              group of key pairs can share it
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                             (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *matrixseed: pointer to input seed of A
+*                             (of length KYBER_SYMBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_keypair_mkem_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t matrixseed[KYBER_SYMBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    polyvec a[KYBER_K];
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, matrixseed, buf + KYBER_SYMBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_keypair_expanded_derand
+*
+* Description: Same as PQCLEAN_KYBER1024_AVX2_indcpa_keypair_derand, but
+*              outputs the secret key as produced by
+*              PQCLEAN_KYBER1024_AVX2_indcpa_sk_expand and, in addition,
+*              the expanded public key as produced by
+*              PQCLEAN_KYBER1024_AVX2_indcpa_pk_expand. A^T is obtained by
+*              transposing the matrix A of key generation instead of
+*              being sampled a second time.
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *expandedsk: pointer to output expanded secret key
+*                             (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES bytes)
+*              - uint8_t *expandedpk: pointer to output expanded public key
+*                             (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_keypair_expanded_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t expandedsk[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        uint8_t expandedpk[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    unsigned int i, j;
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES];
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec a[KYBER_K], at[KYBER_K], pkpv, skpv;
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, buf, buf + KYBER_SYMBYTES);
+
+    for (i = 0; i < KYBER_K; i++) {
+        for (j = 0; j < KYBER_K; j++) {
+            at[i].vec[j] = a[j].vec[i];
+        }
+    }
+
+    /* Go through the packed keys so that the result matches sk_expand and pk_expand */
+    unpack_sk(&skpv, sk);
+    unpack_pk(&pkpv, seed, pk);
+    pack_expanded_sk(expandedsk, &skpv);
+    pack_expanded_pk(expandedpk, &pkpv, at);
+}
+
+/*
+ * Number of keys whose matrix entries and noise polynomials are sampled
+ * together, chosen so that both fill whole 4-way Keccak calls
+ */
+#define KEYPAIR_GROUP (((KYBER_K * KYBER_K) % 4 == 0) ? 1 : 4)
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_keypair_batch_derand
+*
+* Description: Generates n key pairs for the CPA-secure public-key
+*              encryption scheme, identical to n calls of
+*              PQCLEAN_KYBER1024_AVX2_indcpa_keypair_derand. The matrix entries and noise
+*              polynomials of KEYPAIR_GROUP keys at a time are scheduled
+*              onto shared 4-way SHAKE calls, so no lane is left idle
+*              when KYBER_K * KYBER_K is not a multiple of four.
+*
+* Arguments:   - uint8_t *const *pk: array of n pointers to output public keys
+*                             (each of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *const *sk: array of n pointers to output private keys
+*                             (each of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *const *coins: array of n pointers to input randomness
+*                             (each of length KYBER_SYMBYTES bytes)
+*              - size_t n: number of key pairs, at most KYBER_BATCH
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_keypair_batch_derand(uint8_t *const *pk,
+        uint8_t *const *sk,
+        const uint8_t *const *coins,
+        size_t n) {
+    size_t g, k, l, m, t, total;
+    unsigned int i, j;
+    uint8_t buf[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    uint8_t *out[KYBER_BATCH];
+    size_t inlen[KYBER_BATCH];
+    polyvec a[KEYPAIR_GROUP][KYBER_K];
+    polyvec e[KEYPAIR_GROUP], skpv[KEYPAIR_GROUP];
+    poly pad;
+    poly *r[4];
+    const uint8_t *seed[4];
+    uint16_t pos[4];
+    uint8_t nonce[4];
+
+    for (k = 0; k < KYBER_BATCH; k++) {
+        out[k] = buf[k];
+        inlen[k] = KYBER_SYMBYTES;
+    }
+    hash_g_batch(out, coins, inlen, n);
+
+    for (g = 0; g < n; g += m) {
+        m = (n - g < KEYPAIR_GROUP) ? n - g : KEYPAIR_GROUP;
+
+        // matrix entries of all m keys, four per 4-way SHAKE128 call
+        total = m * KYBER_K * KYBER_K;
+        for (t = 0; t < total; t += 4) {
+            for (l = 0; l < 4; l++) {
+                if (t + l < total) {
+                    k = (t + l) / (KYBER_K * KYBER_K);
+                    i = (unsigned int)((t + l) / KYBER_K % KYBER_K);
+                    j = (unsigned int)((t + l) % KYBER_K);
+                    r[l] = &a[k][i].vec[j];
+                    seed[l] = buf[g + k];
+                    pos[l] = (uint16_t)((i << 8) | j);
+                } else {
+                    r[l] = &pad;
+                    seed[l] = buf[g];
+                    pos[l] = 0;
+                }
+            }
+            gen_matrix_entries_4x(r[0], r[1], r[2], r[3], seed[0], seed[1], seed[2], seed[3], pos[0], pos[1], pos[2], pos[3]);
+        }
+
+        // s and e of all m keys, four per 4-way SHAKE256 call
+        total = m * 2 * KYBER_K;
+        for (t = 0; t < total; t += 4) {
+            for (l = 0; l < 4; l++) {
+                if (t + l < total) {
+                    k = (t + l) / (2 * KYBER_K);
+                    i = (unsigned int)((t + l) % (2 * KYBER_K));
+                    r[l] = (i < KYBER_K) ? &skpv[k].vec[i] : &e[k].vec[i - KYBER_K];
+                    seed[l] = buf[g + k] + KYBER_SYMBYTES;
+                    nonce[l] = (uint8_t)i;
+                } else {
+                    r[l] = &pad;
+                    seed[l] = buf[g] + KYBER_SYMBYTES;
+                    nonce[l] = 0;
+                }
+            }
+            PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1_4x_multi(r[0], r[1], r[2], r[3], seed[0], seed[1], seed[2], seed[3], nonce[0], nonce[1], nonce[2], nonce[3]);
+        }
+
+        for (k = 0; k < m; k++) {
+            keypair_from_noise(pk[g + k], sk[g + k], a[k], &skpv[k], &e[k], buf[g + k]);
+        }
+    }
+}
+
+/*************************************************
+* Name:        enc_unpacked
+*
+* Description: Encryption with an already unpacked public key; shared by
+*              PQCLEAN_KYBER1024_AVX2_indcpa_enc and
+*              PQCLEAN_KYBER1024_AVX2_indcpa_enc_expanded
+*
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const polyvec *pkpv: pointer to input public-key polynomial vector
+*              - const polyvec *at: pointer to input matrix A^T
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+static void enc_unpacked(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const polyvec *pkpv,
+                         const polyvec at[KYBER_K],
+                         const uint8_t coins[KYBER_SYMBYTES]) {
+    unsigned int i;
+    polyvec sp, ep, b;
+    poly v, k, epp;
+
+    PQCLEAN_KYBER1024_AVX2_poly_frommsg(&k, m);
+
+    PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1_4x(sp.vec + 0, sp.vec + 1, sp.vec + 2, sp.vec + 3, coins, 0, 1, 2, 3);
+    PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1_4x(ep.vec + 0, ep.vec + 1, ep.vec + 2, ep.vec + 3, coins, 4, 5, 6, 7);
+    PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta2(&epp, coins, 8);
+
+    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(&sp);
 
     // matrix-vector multiplication
     for (i = 0; i < KYBER_K; i++) {
-        PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&pkpv.vec[i], &a[i], &skpv);
-        PQCLEAN_KYBER1024_AVX2_poly_tomont(&pkpv.vec[i]);
+        PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
     }
+    PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&v, pkpv, &sp);
 
-    PQCLEAN_KYBER1024_AVX2_polyvec_add(&pkpv, &pkpv, &e);
-    PQCLEAN_KYBER1024_AVX2_polyvec_reduce(&pkpv);
+    PQCLEAN_KYBER1024_AVX2_polyvec_invntt_tomont(&b);
+    PQCLEAN_KYBER1024_AVX2_poly_invntt_tomont(&v);
 
-    pack_sk(sk, &skpv);
-    pack_pk(pk, &pkpv, publicseed);
+    PQCLEAN_KYBER1024_AVX2_polyvec_add(&b, &b, &ep);
+    PQCLEAN_KYBER1024_AVX2_poly_add(&v, &v, &epp);
+    PQCLEAN_KYBER1024_AVX2_poly_add(&v, &v, &k);
+    PQCLEAN_KYBER1024_AVX2_polyvec_reduce(&b);
+    PQCLEAN_KYBER1024_AVX2_poly_reduce(&v);
+
+    pack_ciphertext(c, &b, &v);
 }
 
 /*************************************************
@@ -285,37 +692,188 @@ void PQCLEAN_KYBER1024_AVX2_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
                                        const uint8_t m[KYBER_INDCPA_MSGBYTES],
                                        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
                                        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_pk(&pkpv, seed, pk);
+    gen_at(at, seed);
+    enc_unpacked(c, m, &pkpv, at, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_pk_expand
+*
+* Description: Precompute everything indcpa_enc derives from the public key
+*              alone: the public-key vector t and the matrix A^T, both in
+*              NTT domain
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded public key
+*                                   (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_pk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_pk(&pkpv, seed, pk);
+    gen_at(at, seed);
+    pack_expanded_pk(expanded, &pkpv, at);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_enc_expanded
+*
+* Description: Same as PQCLEAN_KYBER1024_AVX2_indcpa_enc, but takes
+*              the public key in the form produced by
+*              PQCLEAN_KYBER1024_AVX2_indcpa_pk_expand
+*
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *expanded: pointer to input expanded public key
+*                                         (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_expanded_pk(&pkpv, at, expanded);
+    enc_unpacked(c, m, &pkpv, at, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_enc_mkem_shared
+*
+* Description: Recipient-independent part of multi-recipient encryption:
+*              samples the ephemeral secret r and the noise e1 from coins
+*              and computes the shared ciphertext component
+*              u = Compress(A^T r + e1). All recipients must use the matrix
+*              A of pk.
+*
+* Arguments:   - uint8_t *cshared: pointer to output shared component
+*                                  (of length KYBER_POLYVECCOMPRESSEDBYTES bytes)
+*              - polyvec *sp: pointer to output ephemeral secret r in NTT domain,
+*                             to be passed to
+*                             PQCLEAN_KYBER1024_AVX2_indcpa_enc_mkem_recipient
+*              - const uint8_t *pk: pointer to input public key of any recipient
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_enc_mkem_shared(uint8_t cshared[KYBER_POLYVECCOMPRESSEDBYTES],
+        polyvec *sp,
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
     unsigned int i;
+    uint8_t buf[KYBER_POLYVECCOMPRESSEDBYTES + 2];
     uint8_t seed[KYBER_SYMBYTES];
-    polyvec sp, pkpv, ep, at[KYBER_K], b;
-    poly v, k, epp;
+    polyvec pkpv, ep, b, at[KYBER_K];
 
     unpack_pk(&pkpv, seed, pk);
-    PQCLEAN_KYBER1024_AVX2_poly_frommsg(&k, m);
     gen_at(at, seed);
 
-    PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1_4x(sp.vec + 0, sp.vec + 1, sp.vec + 2, sp.vec + 3, coins, 0, 1, 2, 3);
-    PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1_4x(ep.vec + 0, ep.vec + 1, ep.vec + 2, ep.vec + 3, coins, 4, 5, 6, 7);
-    PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta2(&epp, coins, 8);
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta1(&sp->vec[i], coins, (uint8_t)i);
+    }
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta2(&ep.vec[i], coins, (uint8_t)(KYBER_K + i));
+    }
 
-    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(&sp);
+    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(sp);
 
     // matrix-vector multiplication
     for (i = 0; i < KYBER_K; i++) {
-        PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
+        PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], sp);
     }
-    PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&v, &pkpv, &sp);
 
     PQCLEAN_KYBER1024_AVX2_polyvec_invntt_tomont(&b);
+    PQCLEAN_KYBER1024_AVX2_polyvec_add(&b, &b, &ep);
+    PQCLEAN_KYBER1024_AVX2_polyvec_reduce(&b);
+
+    PQCLEAN_KYBER1024_AVX2_polyvec_compress(buf, &b);
+    memcpy(cshared, buf, KYBER_POLYVECCOMPRESSEDBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_enc_mkem_recipient
+*
+* Description: Per-recipient part of multi-recipient encryption: computes
+*              v = Compress(t^T r + e2 + Encode(m)) for the public key t
+*              of one recipient. The noise e2 is sampled from a seed that
+*              must be different for every recipient.
+*
+* Arguments:   - uint8_t *c: pointer to output recipient component
+*                            (of length KYBER_POLYCOMPRESSEDBYTES bytes)
+*              - const polyvec *sp: pointer to input ephemeral secret r as returned by
+*                                   PQCLEAN_KYBER1024_AVX2_indcpa_enc_mkem_shared
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key of the recipient
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *noiseseed: pointer to input seed of e2
+*                                          (of length KYBER_SYMBYTES)
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_enc_mkem_recipient(uint8_t c[KYBER_POLYCOMPRESSEDBYTES],
+        const polyvec *sp,
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t noiseseed[KYBER_SYMBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv;
+    poly v, k, epp;
+
+    unpack_pk(&pkpv, seed, pk);
+    PQCLEAN_KYBER1024_AVX2_poly_frommsg(&k, m);
+    PQCLEAN_KYBER1024_AVX2_poly_getnoise_eta2(&epp, noiseseed, 0);
+
+    PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&v, &pkpv, sp);
     PQCLEAN_KYBER1024_AVX2_poly_invntt_tomont(&v);
 
-    PQCLEAN_KYBER1024_AVX2_polyvec_add(&b, &b, &ep);
     PQCLEAN_KYBER1024_AVX2_poly_add(&v, &v, &epp);
     PQCLEAN_KYBER1024_AVX2_poly_add(&v, &v, &k);
-    PQCLEAN_KYBER1024_AVX2_polyvec_reduce(&b);
     PQCLEAN_KYBER1024_AVX2_poly_reduce(&v);
 
-    pack_ciphertext(c, &b, &v);
+    PQCLEAN_KYBER1024_AVX2_poly_compress(c, &v);
+}
+
+/*************************************************
+* Name:        dec_unpacked
+*
+* Description: Decryption with an already unpacked secret key; shared by
+*              PQCLEAN_KYBER1024_AVX2_indcpa_dec and
+*              PQCLEAN_KYBER1024_AVX2_indcpa_dec_expanded
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const polyvec *skpv: pointer to input secret-key polynomial vector
+**************************************************/
+static void dec_unpacked(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const polyvec *skpv) {
+    polyvec b;
+    poly v, mp;
+
+    unpack_ciphertext(&b, &v, c);
+
+    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(&b);
+    PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&mp, skpv, &b);
+    PQCLEAN_KYBER1024_AVX2_poly_invntt_tomont(&mp);
+
+    PQCLEAN_KYBER1024_AVX2_poly_sub(&mp, &v, &mp);
+    PQCLEAN_KYBER1024_AVX2_poly_reduce(&mp);
+
+    PQCLEAN_KYBER1024_AVX2_poly_tomsg(m, &mp);
 }
 
 /*************************************************
@@ -334,18 +892,50 @@ void PQCLEAN_KYBER1024_AVX2_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
 void PQCLEAN_KYBER1024_AVX2_indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
                                        const uint8_t c[KYBER_INDCPA_BYTES],
                                        const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
-    polyvec b, skpv;
-    poly v, mp;
+    polyvec skpv;
 
-    unpack_ciphertext(&b, &v, c);
     unpack_sk(&skpv, sk);
+    dec_unpacked(m, c, &skpv);
+}
 
-    PQCLEAN_KYBER1024_AVX2_polyvec_ntt(&b);
-    PQCLEAN_KYBER1024_AVX2_polyvec_basemul_acc_montgomery(&mp, &skpv, &b);
-    PQCLEAN_KYBER1024_AVX2_poly_invntt_tomont(&mp);
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_sk_expand
+*
+* Description: Unpack the secret-key vector s once so that it can be
+*              reused by PQCLEAN_KYBER1024_AVX2_indcpa_dec_expanded
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded secret key
+*                                   (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES)
+*              - const uint8_t *sk: pointer to input secret key
+*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_sk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
+    polyvec skpv;
 
-    PQCLEAN_KYBER1024_AVX2_poly_sub(&mp, &v, &mp);
-    PQCLEAN_KYBER1024_AVX2_poly_reduce(&mp);
+    unpack_sk(&skpv, sk);
+    pack_expanded_sk(expanded, &skpv);
+}
 
-    PQCLEAN_KYBER1024_AVX2_poly_tomsg(m, &mp);
+/*************************************************
+* Name:        PQCLEAN_KYBER1024_AVX2_indcpa_dec_expanded
+*
+* Description: Same as PQCLEAN_KYBER1024_AVX2_indcpa_dec, but takes
+*              the secret key in the form produced by
+*              PQCLEAN_KYBER1024_AVX2_indcpa_sk_expand
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const uint8_t *expanded: pointer to input expanded secret key
+*                                         (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER1024_AVX2_indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES]) {
+    polyvec skpv;
+
+    unpack_expanded_sk(&skpv, expanded);
+    dec_unpacked(m, c, &skpv);
 }
@@ -28,5 +28,14 @@
 /* 32 bytes of additional space to save H(pk) */
 #define KYBER_SECRETKEYBYTES  (KYBER_INDCPA_SECRETKEYBYTES + KYBER_INDCPA_PUBLICKEYBYTES + 2*KYBER_SYMBYTES)
 #define KYBER_CIPHERTEXTBYTES (KYBER_INDCPA_BYTES)
+/* A^T and t in the NTT domain (16-bit coefficients), followed by H(pk) */
+#define KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES ((KYBER_K * KYBER_K + KYBER_K) * KYBER_N * 2)
+#define KYBER_EXPANDEDPUBLICKEYBYTES (KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES + KYBER_SYMBYTES)
+/* s in the NTT domain (16-bit coefficients), the expanded public key and z */
+#define KYBER_INDCPA_EXPANDEDSECRETKEYBYTES (KYBER_K * KYBER_N * 2)
+#define KYBER_EXPANDEDSECRETKEYBYTES (KYBER_INDCPA_EXPANDEDSECRETKEYBYTES + KYBER_EXPANDEDPUBLICKEYBYTES + KYBER_SYMBYTES)
+
+/* Number of operations the batch functions interleave */
+#define KYBER_BATCH 8
 
 #endif
@@ -0,0 +1,90 @@
+#include "fips202.h"
+#include "fips202x8.h"
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Use implementation from the Keccak Code Package */
+#define KeccakF1600_StatePermute8x KeccakP1600times8_PermuteAll_24rounds
+extern void KeccakF1600_StatePermute8x(__m512i *s);
+
+static void keccakx8_absorb_once(__m512i s[25],
+                                 unsigned int r,
+                                 const uint8_t *const in[8],
+                                 size_t inlen,
+                                 uint8_t p) {
+    size_t i;
+    uint64_t pos = 0;
+    __m512i t, idx;
+
+    for (i = 0; i < 25; ++i) {
+        s[i] = _mm512_setzero_si512();
+    }
+
+    idx = _mm512_set_epi64((long long)in[7], (long long)in[6], (long long)in[5], (long long)in[4],
+                           (long long)in[3], (long long)in[2], (long long)in[1], (long long)in[0]);
+    while (inlen >= r) {
+        for (i = 0; i < r / 8; ++i) {
+            t = _mm512_i64gather_epi64(idx, (long long *)pos, 1);
+            s[i] = _mm512_xor_si512(s[i], t);
+            pos += 8;
+        }
+        inlen -= r;
+
+        KeccakF1600_StatePermute8x(s);
+    }
+
+    for (i = 0; i < inlen / 8; ++i) {
+        t = _mm512_i64gather_epi64(idx, (long long *)pos, 1);
+        s[i] = _mm512_xor_si512(s[i], t);
+        pos += 8;
+    }
+    inlen -= 8 * i;
+
+    if (inlen) {
+        t = _mm512_i64gather_epi64(idx, (long long *)pos, 1);
+        idx = _mm512_set1_epi64((long long)((1ULL << (8 * inlen)) - 1));
+        t = _mm512_and_si512(t, idx);
+        s[i] = _mm512_xor_si512(s[i], t);
+    }
+
+    t = _mm512_set1_epi64((long long)((uint64_t)p << 8 * inlen));
+    s[i] = _mm512_xor_si512(s[i], t);
+    t = _mm512_set1_epi64((long long)(1ULL << 63));
+    s[r / 8 - 1] = _mm512_xor_si512(s[r / 8 - 1], t);
+}
+
+static void keccakx8_squeezeblocks(uint8_t *const out[8],
+                                   size_t nblocks,
+                                   unsigned int r,
+                                   __m512i s[25]) {
+    unsigned int i, j;
+    size_t off = 0;
+    uint64_t t[8];
+
+    while (nblocks > 0) {
+        KeccakF1600_StatePermute8x(s);
+        for (i = 0; i < r / 8; ++i) {
+            _mm512_storeu_si512((__m512i *)t, s[i]);
+            for (j = 0; j < 8; ++j) {
+                memcpy(&out[j][off + 8 * i], &t[j], 8);
+            }
+        }
+
+        off += r;
+        --nblocks;
+    }
+}
+
+void PQCLEAN_KYBER1024_AVX512_shake128x8_absorb_once(keccakx8_state *state,
+        const uint8_t *const in[8],
+        size_t inlen) {
+    keccakx8_absorb_once(state->s, SHAKE128_RATE, in, inlen, 0x1F);
+}
+
+void PQCLEAN_KYBER1024_AVX512_shake128x8_squeezeblocks(uint8_t *const out[8],
+        size_t nblocks,
+        keccakx8_state *state) {
+    keccakx8_squeezeblocks(out, nblocks, SHAKE128_RATE, state->s);
+}
@@ -0,0 +1,34 @@
+#ifndef PQCLEAN_KYBER1024_AVX512_SYMMETRIC_H
+#define PQCLEAN_KYBER1024_AVX512_SYMMETRIC_H
+#include "fips202.h"
+#include "fips202x4.h"
+#include "params.h"
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+typedef shake128ctx_inline xof_state;
+
+void PQCLEAN_KYBER1024_AVX512_kyber_shake128_absorb(xof_state *s,
+        const uint8_t seed[KYBER_SYMBYTES],
+        uint8_t x,
+        uint8_t y);
+
+void PQCLEAN_KYBER1024_AVX512_kyber_shake256_prf(uint8_t *out, size_t outlen, const uint8_t key[KYBER_SYMBYTES], uint8_t nonce);
+
+#define XOF_BLOCKBYTES SHAKE128_RATE
+
+#define hash_h(OUT, IN, INBYTES) sha3_256(OUT, IN, INBYTES)
+#define hash_g(OUT, IN, INBYTES) sha3_512(OUT, IN, INBYTES)
+#define xof_absorb(STATE, SEED, X, Y) PQCLEAN_KYBER1024_AVX512_kyber_shake128_absorb(STATE, SEED, X, Y)
+#define xof_squeezeblocks(OUT, OUTBLOCKS, STATE) shake128_squeezeblocks_inline(OUT, OUTBLOCKS, STATE)
+#define xof_ctx_release(STATE)
+#define prf(OUT, OUTBYTES, KEY, NONCE) PQCLEAN_KYBER1024_AVX512_kyber_shake256_prf(OUT, OUTBYTES, KEY, NONCE)
+#define kdf(OUT, IN, INBYTES) shake256(OUT, KYBER_SSBYTES, IN, INBYTES)
+#define hash_h_batch(OUT, IN, INBYTES, N) sha3_256_batch(OUT, IN, INBYTES, N)
+#define hash_g_batch(OUT, IN, INBYTES, N) sha3_512_batch(OUT, IN, INBYTES, N)
+#define kdf_batch(OUT, IN, INBYTES, N) shake256_batch(OUT, KYBER_SSBYTES, IN, INBYTES, N)
+
+
+#endif /* SYMMETRIC_H */
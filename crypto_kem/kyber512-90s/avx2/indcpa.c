@@ -5,7 +5,6 @@
 #include "params.h"
 #include "poly.h"
 #include "polyvec.h"
-#include "randombytes.h"
 #include "rejsample.h"
 #include "symmetric.h"
 #include <immintrin.h>
@@ -112,6 +111,68 @@ static void unpack_ciphertext(polyvec *b, poly *v, const uint8_t c[KYBER_INDCPA_
     PQCLEAN_KYBER51290S_AVX2_poly_decompress(v, c + KYBER_POLYVECCOMPRESSEDBYTES);
 }
 
+/*************************************************
+* Name:        pack_expanded_pk
+*
+* Description: Store the transposed matrix A^T and the public-key vector,
+*              both in NTT domain and in the coefficient order expected by
+*              the multiplication routines, in an expanded public key
+*
+* Arguments:   - uint8_t *r: pointer to the output expanded public key
+*              - const polyvec *pk: pointer to the input public-key polynomial vector
+*              - const polyvec *at: pointer to the input matrix A^T
+**************************************************/
+static void pack_expanded_pk(uint8_t r[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+                             const polyvec *pk,
+                             const polyvec at[KYBER_K]) {
+    memcpy(r, at, KYBER_K * sizeof(polyvec));
+    memcpy(r + KYBER_K * sizeof(polyvec), pk, sizeof(polyvec));
+}
+
+/*************************************************
+* Name:        unpack_expanded_pk
+*
+* Description: Load A^T and the public-key vector from an expanded public key;
+*              inverse of pack_expanded_pk
+*
+* Arguments:   - polyvec *pk: pointer to the output public-key polynomial vector
+*              - polyvec *at: pointer to the output matrix A^T
+*              - const uint8_t *a: pointer to the input expanded public key
+**************************************************/
+static void unpack_expanded_pk(polyvec *pk,
+                               polyvec at[KYBER_K],
+                               const uint8_t a[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES]) {
+    memcpy(at, a, KYBER_K * sizeof(polyvec));
+    memcpy(pk, a + KYBER_K * sizeof(polyvec), sizeof(polyvec));
+}
+
+/*************************************************
+* Name:        pack_expanded_sk
+*
+* Description: Store the secret-key vector, in NTT domain and in the
+*              coefficient order expected by the multiplication routines,
+*              in an expanded secret key
+*
+* Arguments:   - uint8_t *r: pointer to the output expanded secret key
+*              - const polyvec *sk: pointer to the input secret-key polynomial vector
+**************************************************/
+static void pack_expanded_sk(uint8_t r[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES], const polyvec *sk) {
+    memcpy(r, sk, sizeof(polyvec));
+}
+
+/*************************************************
+* Name:        unpack_expanded_sk
+*
+* Description: Load the secret-key vector from an expanded secret key;
+*              inverse of pack_expanded_sk
+*
+* Arguments:   - polyvec *sk: pointer to the output secret-key polynomial vector
+*              - const uint8_t *a: pointer to the input expanded secret key
+**************************************************/
+static void unpack_expanded_sk(polyvec *sk, const uint8_t a[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES]) {
+    memcpy(sk, a, sizeof(polyvec));
+}
+
 /*************************************************
 * Name:        rej_uniform
 *
@@ -167,8 +228,9 @@ static unsigned int rej_uniform(int16_t *r,
 void PQCLEAN_KYBER51290S_AVX2_gen_matrix(polyvec *a, const uint8_t seed[32], int transposed) {
     unsigned int ctr, i, j, k;
     unsigned int buflen, off;
-    uint64_t nonce = 0;
-    ALIGNED_UINT8(REJ_UNIFORM_AVX_NBLOCKS * AES256CTR_BLOCKBYTES) buf;
+    uint8_t *p;
+    uint64_t nonces[KYBER_K * KYBER_K];
+    ALIGNED_UINT8(KYBER_K * KYBER_K * REJ_UNIFORM_AVX_BUFLEN) buf;
     aes256ctr_ctx state;
 
     PQCLEAN_KYBER51290S_AVX2_aes256ctr_init(&state, seed, 0);
@@ -176,24 +238,32 @@ void PQCLEAN_KYBER51290S_AVX2_gen_matrix(polyvec *a, const uint8_t seed[32], int
     for (i = 0; i < KYBER_K; i++) {
         for (j = 0; j < KYBER_K; j++) {
             if (transposed) {
-                nonce = (j << 8) | i;
+                nonces[i * KYBER_K + j] = (j << 8) | i;
             } else {
-                nonce = (i << 8) | j;
+                nonces[i * KYBER_K + j] = (i << 8) | j;
             }
+        }
+    }
+
+    /* Run the counter streams of all entries interleaved */
+    PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks_multi(buf.coeffs, REJ_UNIFORM_AVX_NBLOCKS, &state, nonces, KYBER_K * KYBER_K);
 
-            state.n = _mm_loadl_epi64((__m128i *)&nonce);
-            PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(buf.coeffs, REJ_UNIFORM_AVX_NBLOCKS, &state);
-            buflen = REJ_UNIFORM_AVX_NBLOCKS * AES256CTR_BLOCKBYTES;
-            ctr = PQCLEAN_KYBER51290S_AVX2_rej_uniform_avx(a[i].vec[j].coeffs, buf.coeffs);
+    for (i = 0; i < KYBER_K; i++) {
+        for (j = 0; j < KYBER_K; j++) {
+            p = buf.coeffs + (i * KYBER_K + j) * REJ_UNIFORM_AVX_BUFLEN;
+            buflen = REJ_UNIFORM_AVX_BUFLEN;
+            ctr = PQCLEAN_KYBER51290S_AVX2_rej_uniform_avx(a[i].vec[j].coeffs, p);
 
+            /* Continue the stream of this entry where the first squeeze stopped */
+            state.n = _mm_set_epi64x(4 * REJ_UNIFORM_AVX_NBLOCKS, (int64_t)nonces[i * KYBER_K + j]);
             while (ctr < KYBER_N) {
                 off = buflen % 3;
                 for (k = 0; k < off; k++) {
-                    buf.coeffs[k] = buf.coeffs[buflen - off + k];
+                    p[k] = p[buflen - off + k];
                 }
-                PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(buf.coeffs + off, 1, &state);
+                PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(p + off, 1, &state);
                 buflen = off + AES256CTR_BLOCKBYTES;
-                ctr += rej_uniform(a[i].vec[j].coeffs + ctr, KYBER_N - ctr, buf.coeffs, buflen);
+                ctr += rej_uniform(a[i].vec[j].coeffs + ctr, KYBER_N - ctr, p, buflen);
             }
 
             PQCLEAN_KYBER51290S_AVX2_poly_nttunpack(&a[i].vec[j]);
@@ -202,45 +272,49 @@ void PQCLEAN_KYBER51290S_AVX2_gen_matrix(polyvec *a, const uint8_t seed[32], int
 }
 
 /*************************************************
-* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_keypair
+* Name:        keypair_derand_matrix
 *
-* Description: Generates public and private key for the CPA-secure
-*              public-key encryption scheme underlying Kyber
+* Description: Key generation of the CPA-secure public-key encryption
+*              scheme that also returns the matrix A it sampled; shared by
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_derand,
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_expanded_derand and
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_mkem_derand
 *
 * Arguments:   - uint8_t *pk: pointer to output public key
 *                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
 *              - uint8_t *sk: pointer to output private key
-                              (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*                             (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - polyvec *a: pointer to output matrix A
+*              - const uint8_t *publicseed: pointer to input seed of A
+*                             (of length KYBER_SYMBYTES bytes)
+*              - const uint8_t *noiseseed: pointer to input seed of s and e
+*                             (of length KYBER_SYMBYTES bytes)
 **************************************************/
-void PQCLEAN_KYBER51290S_AVX2_indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
-        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
+static void keypair_derand_matrix(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+                                  uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+                                  polyvec a[KYBER_K],
+                                  const uint8_t publicseed[KYBER_SYMBYTES],
+                                  const uint8_t noiseseed[KYBER_SYMBYTES]) {
     unsigned int i;
-    uint8_t buf[2 * KYBER_SYMBYTES];
-    const uint8_t *publicseed = buf;
-    const uint8_t *noiseseed = buf + KYBER_SYMBYTES;
-    polyvec a[KYBER_K], e, pkpv, skpv;
-
-    randombytes(buf, KYBER_SYMBYTES);
-    hash_g(buf, buf, KYBER_SYMBYTES);
+    polyvec e, pkpv, skpv;
 
     gen_a(a, publicseed);
 
 #define NOISE_NBLOCKS ((KYBER_ETA1*KYBER_N/4)/AES256CTR_BLOCKBYTES) /* Assumes divisibility */
-    uint64_t nonce = 0;
-    ALIGNED_UINT8(NOISE_NBLOCKS * AES256CTR_BLOCKBYTES + 32) coins; // +32 bytes as required by PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1
+#define NOISE_NVECS (NOISE_NBLOCKS*AES256CTR_BLOCKBYTES/32)
+    uint64_t nonces[2 * KYBER_K];
+    ALIGNED_UINT8(2 * KYBER_K * NOISE_NBLOCKS * AES256CTR_BLOCKBYTES + 32) noisebuf; // +32 bytes as required by PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1
     aes256ctr_ctx state;
-    PQCLEAN_KYBER51290S_AVX2_aes256ctr_init(&state, noiseseed, nonce++);
+    PQCLEAN_KYBER51290S_AVX2_aes256ctr_init(&state, noiseseed, 0);
+    for (i = 0; i < 2 * KYBER_K; i++) {
+        nonces[i] = i;
+    }
+    PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks_multi(noisebuf.coeffs, NOISE_NBLOCKS, &state, nonces, 2 * KYBER_K);
     for (i = 0; i < KYBER_K; i++) {
-        PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(coins.coeffs, NOISE_NBLOCKS, &state);
-        state.n = _mm_loadl_epi64((__m128i *)&nonce);
-        nonce += 1;
-        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1(&skpv.vec[i], coins.vec);
+        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1(&skpv.vec[i], &noisebuf.vec[i * NOISE_NVECS]);
     }
     for (i = 0; i < KYBER_K; i++) {
-        PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(coins.coeffs, NOISE_NBLOCKS, &state);
-        state.n = _mm_loadl_epi64((__m128i *)&nonce);
-        nonce += 1;
-        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1(&e.vec[i], coins.vec);
+        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1(&e.vec[i], &noisebuf.vec[(KYBER_K + i) * NOISE_NVECS]);
     }
 
     PQCLEAN_KYBER51290S_AVX2_polyvec_ntt(&skpv);
@@ -260,6 +334,208 @@ void PQCLEAN_KYBER51290S_AVX2_indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBY
     pack_pk(pk, &pkpv, publicseed);
 }
 
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_derand
+*
+* Description: Generates public and private key for the CPA-secure
+*              public-key encryption scheme underlying Kyber
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+                              (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    polyvec a[KYBER_K];
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, buf, buf + KYBER_SYMBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_mkem_derand
+*
+* Description: Same as PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_derand, but
+*              expands the matrix A from a caller-provided seed, so that a
+*              group of key pairs can share it
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *sk: pointer to output private key
+*                             (of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *matrixseed: pointer to input seed of A
+*                             (of length KYBER_SYMBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_mkem_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
+        const uint8_t matrixseed[KYBER_SYMBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    polyvec a[KYBER_K];
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, matrixseed, buf + KYBER_SYMBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_expanded_derand
+*
+* Description: Same as PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_derand, but
+*              outputs the secret key as produced by
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_sk_expand and, in addition,
+*              the expanded public key as produced by
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_pk_expand. A^T is obtained by
+*              transposing the matrix A of key generation instead of
+*              being sampled a second time.
+*
+* Arguments:   - uint8_t *pk: pointer to output public key
+*                             (of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *expandedsk: pointer to output expanded secret key
+*                             (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES bytes)
+*              - uint8_t *expandedpk: pointer to output expanded public key
+*                             (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES bytes)
+*              - const uint8_t *coins: pointer to input randomness
+*                             (of length KYBER_SYMBYTES bytes)
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_expanded_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        uint8_t expandedsk[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        uint8_t expandedpk[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    unsigned int i, j;
+    uint8_t buf[2 * KYBER_SYMBYTES];
+    uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES];
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec a[KYBER_K], at[KYBER_K], pkpv, skpv;
+
+    hash_g(buf, coins, KYBER_SYMBYTES);
+    keypair_derand_matrix(pk, sk, a, buf, buf + KYBER_SYMBYTES);
+
+    for (i = 0; i < KYBER_K; i++) {
+        for (j = 0; j < KYBER_K; j++) {
+            at[i].vec[j] = a[j].vec[i];
+        }
+    }
+
+    /* Go through the packed keys so that the result matches sk_expand and pk_expand */
+    unpack_sk(&skpv, sk);
+    unpack_pk(&pkpv, seed, pk);
+    pack_expanded_sk(expandedsk, &skpv);
+    pack_expanded_pk(expandedpk, &pkpv, at);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_batch_derand
+*
+* Description: Generates n key pairs for the CPA-secure public-key
+*              encryption scheme, identical to n calls of
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_derand; the seed expansions of all
+*              keys are hashed together.
+*
+* Arguments:   - uint8_t *const *pk: array of n pointers to output public keys
+*                             (each of length KYBER_INDCPA_PUBLICKEYBYTES bytes)
+*              - uint8_t *const *sk: array of n pointers to output private keys
+*                             (each of length KYBER_INDCPA_SECRETKEYBYTES bytes)
+*              - const uint8_t *const *coins: array of n pointers to input randomness
+*                             (each of length KYBER_SYMBYTES bytes)
+*              - size_t n: number of key pairs, at most KYBER_BATCH
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_keypair_batch_derand(uint8_t *const *pk,
+        uint8_t *const *sk,
+        const uint8_t *const *coins,
+        size_t n) {
+    size_t k;
+    uint8_t buf[KYBER_BATCH][2 * KYBER_SYMBYTES];
+    uint8_t *out[KYBER_BATCH];
+    size_t inlen[KYBER_BATCH];
+    polyvec a[KYBER_K];
+
+    for (k = 0; k < KYBER_BATCH; k++) {
+        out[k] = buf[k];
+        inlen[k] = KYBER_SYMBYTES;
+    }
+    hash_g_batch(out, coins, inlen, n);
+
+    for (k = 0; k < n; k++) {
+        keypair_derand_matrix(pk[k], sk[k], a, buf[k], buf[k] + KYBER_SYMBYTES);
+    }
+}
+
+/*************************************************
+* Name:        enc_unpacked
+*
+* Description: Encryption with an already unpacked public key; shared by
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_enc and
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_enc_expanded
+*
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const polyvec *pkpv: pointer to input public-key polynomial vector
+*              - const polyvec *at: pointer to input matrix A^T
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+static void enc_unpacked(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const polyvec *pkpv,
+                         const polyvec at[KYBER_K],
+                         const uint8_t coins[KYBER_SYMBYTES]) {
+    unsigned int i;
+    polyvec sp, ep, b;
+    poly v, k, epp;
+
+    PQCLEAN_KYBER51290S_AVX2_poly_frommsg(&k, m);
+
+#define NOISE_NBLOCKS ((KYBER_ETA1*KYBER_N/4)/AES256CTR_BLOCKBYTES) /* Assumes divisibility */
+#define CIPHERTEXTNOISE_NBLOCKS ((KYBER_ETA2*KYBER_N/4)/AES256CTR_BLOCKBYTES) /* Assumes divisibility */
+#define CIPHERTEXTNOISE_NVECS (CIPHERTEXTNOISE_NBLOCKS*AES256CTR_BLOCKBYTES/32)
+    uint64_t nonces[2 * KYBER_K + 1];
+    ALIGNED_UINT8(KYBER_K * NOISE_NBLOCKS * AES256CTR_BLOCKBYTES + 32) buf; /* +32 bytes as required by PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1 */
+    ALIGNED_UINT8((KYBER_K + 1) * CIPHERTEXTNOISE_NBLOCKS * AES256CTR_BLOCKBYTES) buf2;
+    aes256ctr_ctx state;
+    PQCLEAN_KYBER51290S_AVX2_aes256ctr_init(&state, coins, 0);
+    for (i = 0; i < 2 * KYBER_K + 1; i++) {
+        nonces[i] = i;
+    }
+    PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks_multi(buf.coeffs, NOISE_NBLOCKS, &state, nonces, KYBER_K);
+    PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks_multi(buf2.coeffs, CIPHERTEXTNOISE_NBLOCKS, &state, nonces + KYBER_K, KYBER_K + 1);
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1(&sp.vec[i], &buf.vec[i * NOISE_NVECS]);
+    }
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta2(&ep.vec[i], &buf2.vec[i * CIPHERTEXTNOISE_NVECS]);
+    }
+    PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta2(&epp, &buf2.vec[KYBER_K * CIPHERTEXTNOISE_NVECS]);
+
+    PQCLEAN_KYBER51290S_AVX2_polyvec_ntt(&sp);
+
+    // matrix-vector multiplication
+    for (i = 0; i < KYBER_K; i++) {
+        PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
+    }
+    PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&v, pkpv, &sp);
+
+    PQCLEAN_KYBER51290S_AVX2_polyvec_invntt_tomont(&b);
+    PQCLEAN_KYBER51290S_AVX2_poly_invntt_tomont(&v);
+
+    PQCLEAN_KYBER51290S_AVX2_polyvec_add(&b, &b, &ep);
+    PQCLEAN_KYBER51290S_AVX2_poly_add(&v, &v, &epp);
+    PQCLEAN_KYBER51290S_AVX2_poly_add(&v, &v, &k);
+    PQCLEAN_KYBER51290S_AVX2_polyvec_reduce(&b);
+    PQCLEAN_KYBER51290S_AVX2_poly_reduce(&v);
+
+    pack_ciphertext(c, &b, &v);
+}
+
 /*************************************************
 * Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_enc
 *
@@ -280,56 +556,188 @@ void PQCLEAN_KYBER51290S_AVX2_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
         const uint8_t m[KYBER_INDCPA_MSGBYTES],
         const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
         const uint8_t coins[KYBER_SYMBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_pk(&pkpv, seed, pk);
+    gen_at(at, seed);
+    enc_unpacked(c, m, &pkpv, at, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_pk_expand
+*
+* Description: Precompute everything indcpa_enc derives from the public key
+*              alone: the public-key vector t and the matrix A^T, both in
+*              NTT domain
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded public key
+*                                   (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_pk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_pk(&pkpv, seed, pk);
+    gen_at(at, seed);
+    pack_expanded_pk(expanded, &pkpv, at);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_enc_expanded
+*
+* Description: Same as PQCLEAN_KYBER51290S_AVX2_indcpa_enc, but takes
+*              the public key in the form produced by
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_pk_expand
+*
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *expanded: pointer to input expanded public key
+*                                         (of length KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
+    polyvec pkpv, at[KYBER_K];
+
+    unpack_expanded_pk(&pkpv, at, expanded);
+    enc_unpacked(c, m, &pkpv, at, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_enc_mkem_shared
+*
+* Description: Recipient-independent part of multi-recipient encryption:
+*              samples the ephemeral secret r and the noise e1 from coins
+*              and computes the shared ciphertext component
+*              u = Compress(A^T r + e1). All recipients must use the matrix
+*              A of pk.
+*
+* Arguments:   - uint8_t *cshared: pointer to output shared component
+*                                  (of length KYBER_POLYVECCOMPRESSEDBYTES bytes)
+*              - polyvec *sp: pointer to output ephemeral secret r in NTT domain,
+*                             to be passed to
+*                             PQCLEAN_KYBER51290S_AVX2_indcpa_enc_mkem_recipient
+*              - const uint8_t *pk: pointer to input public key of any recipient
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_enc_mkem_shared(uint8_t cshared[KYBER_POLYVECCOMPRESSEDBYTES],
+        polyvec *sp,
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t coins[KYBER_SYMBYTES]) {
     unsigned int i;
+    uint8_t buf[KYBER_POLYVECCOMPRESSEDBYTES + 2];
     uint8_t seed[KYBER_SYMBYTES];
-    polyvec sp, pkpv, ep, at[KYBER_K], b;
-    poly v, k, epp;
+    polyvec pkpv, ep, b, at[KYBER_K];
 
     unpack_pk(&pkpv, seed, pk);
-    PQCLEAN_KYBER51290S_AVX2_poly_frommsg(&k, m);
     gen_at(at, seed);
 
-#define NOISE_NBLOCKS ((KYBER_ETA1*KYBER_N/4)/AES256CTR_BLOCKBYTES) /* Assumes divisibility */
-#define CIPHERTEXTNOISE_NBLOCKS ((KYBER_ETA2*KYBER_N/4)/AES256CTR_BLOCKBYTES) /* Assumes divisibility */
-    uint64_t nonce = 0;
-    ALIGNED_UINT8(NOISE_NBLOCKS * AES256CTR_BLOCKBYTES + 32) buf; /* +32 bytes as required by PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1 */
-    aes256ctr_ctx state;
-    PQCLEAN_KYBER51290S_AVX2_aes256ctr_init(&state, coins, nonce++);
     for (i = 0; i < KYBER_K; i++) {
-        PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(buf.coeffs, NOISE_NBLOCKS, &state);
-        state.n = _mm_loadl_epi64((__m128i *)&nonce);
-        nonce += 1;
-        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta1(&sp.vec[i], buf.vec);
+        PQCLEAN_KYBER51290S_AVX2_poly_getnoise_eta1(&sp->vec[i], coins, (uint8_t)i);
     }
     for (i = 0; i < KYBER_K; i++) {
-        PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(buf.coeffs, CIPHERTEXTNOISE_NBLOCKS, &state);
-        state.n = _mm_loadl_epi64((__m128i *)&nonce);
-        nonce += 1;
-        PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta2(&ep.vec[i], buf.vec);
+        PQCLEAN_KYBER51290S_AVX2_poly_getnoise_eta2(&ep.vec[i], coins, (uint8_t)(KYBER_K + i));
     }
-    PQCLEAN_KYBER51290S_AVX2_aes256ctr_squeezeblocks(buf.coeffs, CIPHERTEXTNOISE_NBLOCKS, &state);
-    state.n = _mm_loadl_epi64((__m128i *)&nonce);
-    nonce += 1;
-    PQCLEAN_KYBER51290S_AVX2_poly_cbd_eta2(&epp, buf.vec);
 
-    PQCLEAN_KYBER51290S_AVX2_polyvec_ntt(&sp);
+    PQCLEAN_KYBER51290S_AVX2_polyvec_ntt(sp);
 
     // matrix-vector multiplication
     for (i = 0; i < KYBER_K; i++) {
-        PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
+        PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], sp);
     }
-    PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&v, &pkpv, &sp);
 
     PQCLEAN_KYBER51290S_AVX2_polyvec_invntt_tomont(&b);
+    PQCLEAN_KYBER51290S_AVX2_polyvec_add(&b, &b, &ep);
+    PQCLEAN_KYBER51290S_AVX2_polyvec_reduce(&b);
+
+    PQCLEAN_KYBER51290S_AVX2_polyvec_compress(buf, &b);
+    memcpy(cshared, buf, KYBER_POLYVECCOMPRESSEDBYTES);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_enc_mkem_recipient
+*
+* Description: Per-recipient part of multi-recipient encryption: computes
+*              v = Compress(t^T r + e2 + Encode(m)) for the public key t
+*              of one recipient. The noise e2 is sampled from a seed that
+*              must be different for every recipient.
+*
+* Arguments:   - uint8_t *c: pointer to output recipient component
+*                            (of length KYBER_POLYCOMPRESSEDBYTES bytes)
+*              - const polyvec *sp: pointer to input ephemeral secret r as returned by
+*                                   PQCLEAN_KYBER51290S_AVX2_indcpa_enc_mkem_shared
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key of the recipient
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *noiseseed: pointer to input seed of e2
+*                                          (of length KYBER_SYMBYTES)
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_enc_mkem_recipient(uint8_t c[KYBER_POLYCOMPRESSEDBYTES],
+        const polyvec *sp,
+        const uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+        const uint8_t noiseseed[KYBER_SYMBYTES]) {
+    uint8_t seed[KYBER_SYMBYTES];
+    polyvec pkpv;
+    poly v, k, epp;
+
+    unpack_pk(&pkpv, seed, pk);
+    PQCLEAN_KYBER51290S_AVX2_poly_frommsg(&k, m);
+    PQCLEAN_KYBER51290S_AVX2_poly_getnoise_eta2(&epp, noiseseed, 0);
+
+    PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&v, &pkpv, sp);
     PQCLEAN_KYBER51290S_AVX2_poly_invntt_tomont(&v);
 
-    PQCLEAN_KYBER51290S_AVX2_polyvec_add(&b, &b, &ep);
     PQCLEAN_KYBER51290S_AVX2_poly_add(&v, &v, &epp);
     PQCLEAN_KYBER51290S_AVX2_poly_add(&v, &v, &k);
-    PQCLEAN_KYBER51290S_AVX2_polyvec_reduce(&b);
     PQCLEAN_KYBER51290S_AVX2_poly_reduce(&v);
 
-    pack_ciphertext(c, &b, &v);
+    PQCLEAN_KYBER51290S_AVX2_poly_compress(c, &v);
+}
+
+/*************************************************
+* Name:        dec_unpacked
+*
+* Description: Decryption with an already unpacked secret key; shared by
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_dec and
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_dec_expanded
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const polyvec *skpv: pointer to input secret-key polynomial vector
+**************************************************/
+static void dec_unpacked(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const polyvec *skpv) {
+    polyvec b;
+    poly v, mp;
+
+    unpack_ciphertext(&b, &v, c);
+
+    PQCLEAN_KYBER51290S_AVX2_polyvec_ntt(&b);
+    PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&mp, skpv, &b);
+    PQCLEAN_KYBER51290S_AVX2_poly_invntt_tomont(&mp);
+
+    PQCLEAN_KYBER51290S_AVX2_poly_sub(&mp, &v, &mp);
+    PQCLEAN_KYBER51290S_AVX2_poly_reduce(&mp);
+
+    PQCLEAN_KYBER51290S_AVX2_poly_tomsg(m, &mp);
 }
 
 /*************************************************
@@ -348,18 +756,50 @@ void PQCLEAN_KYBER51290S_AVX2_indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
 void PQCLEAN_KYBER51290S_AVX2_indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
         const uint8_t c[KYBER_INDCPA_BYTES],
         const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
-    polyvec b, skpv;
-    poly v, mp;
+    polyvec skpv;
 
-    unpack_ciphertext(&b, &v, c);
     unpack_sk(&skpv, sk);
+    dec_unpacked(m, c, &skpv);
+}
 
-    PQCLEAN_KYBER51290S_AVX2_polyvec_ntt(&b);
-    PQCLEAN_KYBER51290S_AVX2_polyvec_basemul_acc_montgomery(&mp, &skpv, &b);
-    PQCLEAN_KYBER51290S_AVX2_poly_invntt_tomont(&mp);
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_sk_expand
+*
+* Description: Unpack the secret-key vector s once so that it can be
+*              reused by PQCLEAN_KYBER51290S_AVX2_indcpa_dec_expanded
+*
+* Arguments:   - uint8_t *expanded: pointer to output expanded secret key
+*                                   (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES)
+*              - const uint8_t *sk: pointer to input secret key
+*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_sk_expand(uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES],
+        const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]) {
+    polyvec skpv;
 
-    PQCLEAN_KYBER51290S_AVX2_poly_sub(&mp, &v, &mp);
-    PQCLEAN_KYBER51290S_AVX2_poly_reduce(&mp);
+    unpack_sk(&skpv, sk);
+    pack_expanded_sk(expanded, &skpv);
+}
 
-    PQCLEAN_KYBER51290S_AVX2_poly_tomsg(m, &mp);
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX2_indcpa_dec_expanded
+*
+* Description: Same as PQCLEAN_KYBER51290S_AVX2_indcpa_dec, but takes
+*              the secret key in the form produced by
+*              PQCLEAN_KYBER51290S_AVX2_indcpa_sk_expand
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const uint8_t *expanded: pointer to input expanded secret key
+*                                         (of length KYBER_INDCPA_EXPANDEDSECRETKEYBYTES)
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX2_indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+        const uint8_t c[KYBER_INDCPA_BYTES],
+        const uint8_t expanded[KYBER_INDCPA_EXPANDEDSECRETKEYBYTES]) {
+    polyvec skpv;
+
+    unpack_expanded_sk(&skpv, expanded);
+    dec_unpacked(m, c, &skpv);
 }
@@ -0,0 +1,240 @@
+#include "aes256ctr.h"
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+/* Based heavily on public-domain code by Romain Dolbeau
+ * Different handling of nonce+counter than original version using
+ * separated 64-bit nonce and internal 64-bit counter, starting from zero
+ * Public Domain */
+
+
+static inline void aesni_encrypt4(uint8_t out[64], __m128i *n, const __m128i rkeys[16]) {
+    __m128i f, f0, f1, f2, f3;
+    const __m128i idx = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    /* Load current counter value */
+    f = _mm_load_si128(n);
+
+    /* Increase counter in 4 consecutive blocks */
+    f0 = _mm_shuffle_epi8(_mm_add_epi64(f, _mm_set_epi64x(0, 0)), idx);
+    f1 = _mm_shuffle_epi8(_mm_add_epi64(f, _mm_set_epi64x(1, 0)), idx);
+    f2 = _mm_shuffle_epi8(_mm_add_epi64(f, _mm_set_epi64x(2, 0)), idx);
+    f3 = _mm_shuffle_epi8(_mm_add_epi64(f, _mm_set_epi64x(3, 0)), idx);
+
+    /* Write counter for next iteration, increased by 4 */
+    _mm_store_si128(n, _mm_add_epi64(f, _mm_set_epi64x(4, 0)));
+
+    /* Actual AES encryption, 4x interleaved */
+    f  = _mm_load_si128(&rkeys[0]);
+    f0 = _mm_xor_si128(f0, f);
+    f1 = _mm_xor_si128(f1, f);
+    f2 = _mm_xor_si128(f2, f);
+    f3 = _mm_xor_si128(f3, f);
+
+    for (int i = 1; i < 14; i++) {
+        f  = _mm_load_si128(&rkeys[i]);
+        f0 = _mm_aesenc_si128(f0, f);
+        f1 = _mm_aesenc_si128(f1, f);
+        f2 = _mm_aesenc_si128(f2, f);
+        f3 = _mm_aesenc_si128(f3, f);
+    }
+
+    f  = _mm_load_si128(&rkeys[14]);
+    f0 = _mm_aesenclast_si128(f0, f);
+    f1 = _mm_aesenclast_si128(f1, f);
+    f2 = _mm_aesenclast_si128(f2, f);
+    f3 = _mm_aesenclast_si128(f3, f);
+
+    /* Write results */
+    _mm_storeu_si128((__m128i *)(out + 0), f0);
+    _mm_storeu_si128((__m128i *)(out + 16), f1);
+    _mm_storeu_si128((__m128i *)(out + 32), f2);
+    _mm_storeu_si128((__m128i *)(out + 48), f3);
+}
+
+/* Broadcasts the round keys to all four 128-bit lanes */
+static inline void vaes_rkeys(__m512i rk[15], const __m128i rkeys[16]) {
+    int i;
+
+    for (i = 0; i < 15; i++) {
+        rk[i] = _mm512_broadcast_i32x4(_mm_load_si128(&rkeys[i]));
+    }
+}
+
+/* Counter blocks ctr to ctr+3 for the nonce and counter in n */
+static inline __m512i vaes_ctrblocks(__m128i n, uint64_t ctr) {
+    const __m512i idx = _mm512_broadcast_i32x4(_mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0));
+    __m512i f;
+
+    f = _mm512_broadcast_i32x4(n);
+    f = _mm512_add_epi64(f, _mm512_set_epi64((int64_t)ctr + 3, 0, (int64_t)ctr + 2, 0, (int64_t)ctr + 1, 0, (int64_t)ctr, 0));
+    return _mm512_shuffle_epi8(f, idx);
+}
+
+/* Encrypts the 32 counter blocks in f and writes the first 4*n of them to out */
+static inline void vaes_encrypt32(uint8_t *out, __m512i f[8], const __m512i rk[15], int n) {
+    int i, j;
+
+    /* Actual AES encryption, 8x4 interleaved */
+    for (j = 0; j < 8; j++) {
+        f[j] = _mm512_xor_si512(f[j], rk[0]);
+    }
+
+    for (i = 1; i < 14; i++) {
+        for (j = 0; j < 8; j++) {
+            f[j] = _mm512_aesenc_epi128(f[j], rk[i]);
+        }
+    }
+
+    for (j = 0; j < 8; j++) {
+        f[j] = _mm512_aesenclast_epi128(f[j], rk[14]);
+    }
+
+    /* Write results */
+    for (j = 0; j < n; j++) {
+        _mm512_storeu_si512((__m512i *)(out + 64 * j), f[j]);
+    }
+}
+
+void PQCLEAN_KYBER51290S_AVX512_aes256ctr_init(aes256ctr_ctx *state, const uint8_t key[32], uint64_t nonce) {
+    __m128i key0, key1, temp0, temp1, temp2, temp4;
+    int idx = 0;
+
+    key0 = _mm_loadu_si128((__m128i *)(key + 0));
+    key1 = _mm_loadu_si128((__m128i *)(key + 16));
+    state->n = _mm_loadl_epi64((__m128i *)&nonce);
+
+    state->rkeys[idx++] = key0;
+    temp0 = key0;
+    temp2 = key1;
+    temp4 = _mm_setzero_si128();
+
+#define BLOCK1(IMM)                                                     \
+    temp1 = _mm_aeskeygenassist_si128(temp2, IMM);                        \
+    state->rkeys[idx++] = temp2;                                          \
+    temp4 = (__m128i)_mm_shuffle_ps((__m128)temp4, (__m128)temp0, 0x10);  \
+    temp0 = _mm_xor_si128(temp0, temp4);                                  \
+    temp4 = (__m128i)_mm_shuffle_ps((__m128)temp4, (__m128)temp0, 0x8c);  \
+    temp0 = _mm_xor_si128(temp0, temp4);                                  \
+    temp1 = (__m128i)_mm_shuffle_ps((__m128)temp1, (__m128)temp1, 0xff);  \
+    temp0 = _mm_xor_si128(temp0, temp1)
+
+#define BLOCK2(IMM)                                                     \
+    temp1 = _mm_aeskeygenassist_si128(temp0, IMM);                        \
+    state->rkeys[idx++] = temp0;                                          \
+    temp4 = (__m128i)_mm_shuffle_ps((__m128)temp4, (__m128)temp2, 0x10);  \
+    temp2 = _mm_xor_si128(temp2, temp4);                                  \
+    temp4 = (__m128i)_mm_shuffle_ps((__m128)temp4, (__m128)temp2, 0x8c);  \
+    temp2 = _mm_xor_si128(temp2, temp4);                                  \
+    temp1 = (__m128i)_mm_shuffle_ps((__m128)temp1, (__m128)temp1, 0xaa);  \
+    temp2 = _mm_xor_si128(temp2, temp1)
+
+    BLOCK1(0x01);
+    BLOCK2(0x01);
+
+    BLOCK1(0x02);
+    BLOCK2(0x02);
+
+    BLOCK1(0x04);
+    BLOCK2(0x04);
+
+    BLOCK1(0x08);
+    BLOCK2(0x08);
+
+    BLOCK1(0x10);
+    BLOCK2(0x10);
+
+    BLOCK1(0x20);
+    BLOCK2(0x20);
+
+    BLOCK1(0x40);
+    state->rkeys[idx++] = temp0;
+}
+
+void PQCLEAN_KYBER51290S_AVX512_aes256ctr_squeezeblocks(uint8_t *out,
+        size_t nblocks,
+        aes256ctr_ctx *state) {
+    __m512i rk[15], f[8];
+    int j;
+
+    if (nblocks >= 8) {
+        vaes_rkeys(rk, state->rkeys);
+    }
+    for (; nblocks >= 8; nblocks -= 8) {
+        for (j = 0; j < 8; j++) {
+            f[j] = vaes_ctrblocks(state->n, 4 * j);
+        }
+        state->n = _mm_add_epi64(state->n, _mm_set_epi64x(32, 0));
+        vaes_encrypt32(out, f, rk, 8);
+        out += 512;
+    }
+    for (; nblocks > 0; nblocks--) {
+        aesni_encrypt4(out, &state->n, state->rkeys);
+        out += 64;
+    }
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER51290S_AVX512_aes256ctr_squeezeblocks_multi
+*
+* Description: Squeeze nblocks blocks from each of nstreams counter mode
+*              streams under the key of state. Stream i uses nonce nonces[i]
+*              and a counter starting from zero; its output is written to
+*              out + i*nblocks*AES256CTR_BLOCKBYTES. The AES blocks of all
+*              streams are encrypted 32 at a time with VAES, so that short
+*              streams still keep the AES pipeline busy.
+*
+* Arguments:   - uint8_t *out: pointer to output
+*              - size_t nblocks: number of blocks per stream
+*              - const aes256ctr_ctx *state: pointer to expanded key
+*              - const uint64_t *nonces: pointer to nstreams nonces
+*              - size_t nstreams: number of streams
+**************************************************/
+void PQCLEAN_KYBER51290S_AVX512_aes256ctr_squeezeblocks_multi(uint8_t *out,
+        size_t nblocks,
+        const aes256ctr_ctx *state,
+        const uint64_t *nonces,
+        size_t nstreams) {
+    __m512i rk[15], f[8];
+    size_t i, s = 0, ctr = 0, total = nblocks * nstreams;
+    int j;
+
+    vaes_rkeys(rk, state->rkeys);
+    for (i = 0; i < total; i += 8) {
+        for (j = 0; j < 8; j++) {
+            f[j] = vaes_ctrblocks(_mm_set_epi64x(0, (int64_t)nonces[s]), 4 * ctr);
+            if (++ctr == nblocks) {
+                ctr = 0;
+                /* Past the last stream: repeat its nonce for the unused blocks */
+                s += (s + 1 < nstreams);
+            }
+        }
+        if (total - i >= 8) {
+            vaes_encrypt32(out + 64 * i, f, rk, 8);
+        } else {
+            vaes_encrypt32(out + 64 * i, f, rk, (int)(total - i));
+        }
+    }
+}
+
+void PQCLEAN_KYBER51290S_AVX512_aes256ctr_prf(uint8_t *out,
+        size_t outlen,
+        const uint8_t key[32],
+        uint64_t nonce) {
+    unsigned int i;
+    uint8_t buf[64];
+    aes256ctr_ctx state;
+
+    PQCLEAN_KYBER51290S_AVX512_aes256ctr_init(&state, key, nonce);
+
+    PQCLEAN_KYBER51290S_AVX512_aes256ctr_squeezeblocks(out, outlen / 64, &state);
+    out += outlen - outlen % 64;
+    outlen %= 64;
+
+    if (outlen) {
+        aesni_encrypt4(buf, &state.n, state.rkeys);
+        for (i = 0; i < outlen; i++) {
+            out[i] = buf[i];
+        }
+    }
+}
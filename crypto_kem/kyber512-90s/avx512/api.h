@@ -0,0 +1,60 @@
+#ifndef PQCLEAN_KYBER51290S_AVX512_API_H
+#define PQCLEAN_KYBER51290S_AVX512_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_SECRETKEYBYTES  1632
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_PUBLICKEYBYTES  800
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_CIPHERTEXTBYTES 768
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_BYTES           32
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_KEYPAIRCOINBYTES 64
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_ENCCOINBYTES     32
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_EXPANDEDPUBLICKEYBYTES 3104
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_EXPANDEDSECRETKEYBYTES 4160
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_MKEMSEEDBYTES 32
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_MKEMSHAREDBYTES 640
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_MKEMRECIPIENTBYTES 128
+#define PQCLEAN_KYBER51290S_AVX512_CRYPTO_ALGNAME "Kyber512-90s"
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_keypair_batch(uint8_t *const *pk, uint8_t *const *sk, size_t n);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *coins);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_pk_expand(uint8_t *expanded, const uint8_t *pk);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_enc_expanded_derand(uint8_t *ct, uint8_t *ss, const uint8_t *expanded, const uint8_t *coins);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *expanded);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_enc_batch(uint8_t *const *ct, uint8_t *const *ss, const uint8_t *const *pk, size_t n);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_mkem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *matrixseed, const uint8_t *coins);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_mkem_keypair(uint8_t *pk, uint8_t *sk, const uint8_t *matrixseed);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_mkem_enc_derand(uint8_t *ct_shared, uint8_t *const *ct, uint8_t *ss, const uint8_t *const *pk, size_t n, const uint8_t *coins);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_mkem_enc(uint8_t *ct_shared, uint8_t *const *ct, uint8_t *ss, const uint8_t *const *pk, size_t n);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_mkem_dec(uint8_t *ss, const uint8_t *ct_shared, const uint8_t *ct, const uint8_t *sk);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_sk_expand(uint8_t *expanded, const uint8_t *sk);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *expanded);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_sk_expand_from_seed(uint8_t *expanded, const uint8_t *seed);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_dec_from_seed(uint8_t *ss, const uint8_t *ct, const uint8_t *seed);
+
+int PQCLEAN_KYBER51290S_AVX512_crypto_kem_dec_batch(uint8_t *const *ss, const uint8_t *const *ct, const uint8_t *sk, size_t n);
+
+#endif
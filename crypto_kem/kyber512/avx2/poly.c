@@ -267,6 +267,52 @@ void PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1_4x(poly *r0,
     PQCLEAN_KYBER512_AVX2_poly_cbd_eta1(r3, buf[3].vec);
 }
 
+/*************************************************
+* Name:        PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1_4x_multi
+*
+* Description: Same as PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1_4x, but with a separate
+*              seed for each output polynomial, so that noise of several
+*              keys can share one 4-way SHAKE256 instance
+*
+* Arguments:   - poly *r0, *r1, *r2, *r3: pointers to output polynomials
+*              - const uint8_t *seed0, ..., *seed3: pointers to input seeds
+*                                     (each of length KYBER_SYMBYTES bytes)
+*              - uint8_t nonce0, ..., nonce3: one-byte input nonces
+**************************************************/
+void PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1_4x_multi(poly *r0,
+        poly *r1,
+        poly *r2,
+        poly *r3,
+        const uint8_t seed0[KYBER_SYMBYTES],
+        const uint8_t seed1[KYBER_SYMBYTES],
+        const uint8_t seed2[KYBER_SYMBYTES],
+        const uint8_t seed3[KYBER_SYMBYTES],
+        uint8_t nonce0,
+        uint8_t nonce1,
+        uint8_t nonce2,
+        uint8_t nonce3) {
+    ALIGNED_UINT8(NOISE_NBLOCKS * SHAKE256_RATE) buf[4];
+    keccakx4_state state;
+
+    _mm256_store_si256(buf[0].vec, _mm256_loadu_si256((__m256i *)seed0));
+    _mm256_store_si256(buf[1].vec, _mm256_loadu_si256((__m256i *)seed1));
+    _mm256_store_si256(buf[2].vec, _mm256_loadu_si256((__m256i *)seed2));
+    _mm256_store_si256(buf[3].vec, _mm256_loadu_si256((__m256i *)seed3));
+
+    buf[0].coeffs[32] = nonce0;
+    buf[1].coeffs[32] = nonce1;
+    buf[2].coeffs[32] = nonce2;
+    buf[3].coeffs[32] = nonce3;
+
+    PQCLEAN_KYBER512_AVX2_shake256x4_absorb_once(&state, buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, 33);
+    PQCLEAN_KYBER512_AVX2_shake256x4_squeezeblocks(buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, NOISE_NBLOCKS, &state);
+
+    PQCLEAN_KYBER512_AVX2_poly_cbd_eta1(r0, buf[0].vec);
+    PQCLEAN_KYBER512_AVX2_poly_cbd_eta1(r1, buf[1].vec);
+    PQCLEAN_KYBER512_AVX2_poly_cbd_eta1(r2, buf[2].vec);
+    PQCLEAN_KYBER512_AVX2_poly_cbd_eta1(r3, buf[3].vec);
+}
+
 void PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1122_4x(poly *r0,
         poly *r1,
         poly *r2,
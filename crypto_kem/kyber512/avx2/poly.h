@@ -30,6 +30,19 @@ void PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1_4x(poly *r0,
         uint8_t nonce2,
         uint8_t nonce3);
 
+void PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1_4x_multi(poly *r0,
+        poly *r1,
+        poly *r2,
+        poly *r3,
+        const uint8_t seed0[KYBER_SYMBYTES],
+        const uint8_t seed1[KYBER_SYMBYTES],
+        const uint8_t seed2[KYBER_SYMBYTES],
+        const uint8_t seed3[KYBER_SYMBYTES],
+        uint8_t nonce0,
+        uint8_t nonce1,
+        uint8_t nonce2,
+        uint8_t nonce3);
+
 void PQCLEAN_KYBER512_AVX2_poly_getnoise_eta1122_4x(poly *r0,
         poly *r1,
         poly *r2,
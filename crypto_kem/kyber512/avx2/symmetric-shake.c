@@ -25,7 +25,7 @@ void PQCLEAN_KYBER512_AVX2_kyber_shake128_absorb(xof_state *state,
     extseed[KYBER_SYMBYTES + 0] = x;
     extseed[KYBER_SYMBYTES + 1] = y;
 
-    shake128_absorb(state, extseed, sizeof(extseed));
+    shake128_absorb_inline(state, extseed, sizeof(extseed));
 }
 
 /*************************************************
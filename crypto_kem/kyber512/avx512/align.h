@@ -0,0 +1,21 @@
+#ifndef PQCLEAN_KYBER512_AVX512_ALIGN_H
+#define PQCLEAN_KYBER512_AVX512_ALIGN_H
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#define ALIGNED_UINT8(N)        \
+    union {                     \
+        uint8_t coeffs[(N)];      \
+        __m256i vec[((N)+31)/32]; \
+    }
+
+/* The __m512i member aligns polynomials for the 32-lane NTT */
+#define ALIGNED_INT16(N)             \
+    union {                          \
+        int16_t coeffs[(N)];         \
+        __m256i vec[((N)+15)/16];    \
+        __m512i vec512[((N)+31)/32]; \
+    }
+
+#endif
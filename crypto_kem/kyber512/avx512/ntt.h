@@ -0,0 +1,21 @@
+#ifndef PQCLEAN_KYBER512_AVX512_NTT_H
+#define PQCLEAN_KYBER512_AVX512_NTT_H
+
+#include <immintrin.h>
+#include <stdint.h>
+
+void PQCLEAN_KYBER512_AVX512_ntt_avx(__m256i *r, const __m256i *PQCLEAN_KYBER512_AVX512_qdata);
+void PQCLEAN_KYBER512_AVX512_invntt_avx(__m256i *r, const __m256i *PQCLEAN_KYBER512_AVX512_qdata);
+
+void PQCLEAN_KYBER512_AVX512_nttpack_avx(__m256i *r, const __m256i *PQCLEAN_KYBER512_AVX512_qdata);
+void PQCLEAN_KYBER512_AVX512_nttunpack_avx(__m256i *r, const __m256i *PQCLEAN_KYBER512_AVX512_qdata);
+
+void PQCLEAN_KYBER512_AVX512_basemul_avx(__m256i *r,
+        const __m256i *a,
+        const __m256i *b,
+        const __m256i *PQCLEAN_KYBER512_AVX512_qdata);
+
+void PQCLEAN_KYBER512_AVX512_ntttobytes_avx(uint8_t *r, const __m256i *a, const __m256i *PQCLEAN_KYBER512_AVX512_qdata);
+void PQCLEAN_KYBER512_AVX512_nttfrombytes_avx(__m256i *r, const uint8_t *a, const __m256i *PQCLEAN_KYBER512_AVX512_qdata);
+
+#endif
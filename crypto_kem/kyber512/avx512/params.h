@@ -0,0 +1,41 @@
+#ifndef PQCLEAN_KYBER512_AVX512_PARAMS_H
+#define PQCLEAN_KYBER512_AVX512_PARAMS_H
+
+
+
+#define KYBER_N 256
+#define KYBER_Q 3329
+
+#define KYBER_SYMBYTES 32   /* size in bytes of hashes, and seeds */
+#define KYBER_SSBYTES  32   /* size in bytes of shared key */
+
+#define KYBER_POLYBYTES     384
+#define KYBER_POLYVECBYTES  (KYBER_K * KYBER_POLYBYTES)
+
+#define KYBER_K 2
+#define KYBER_ETA1 3
+#define KYBER_POLYCOMPRESSEDBYTES    128
+#define KYBER_POLYVECCOMPRESSEDBYTES (KYBER_K * 320)
+
+#define KYBER_ETA2 2
+
+#define KYBER_INDCPA_MSGBYTES       (KYBER_SYMBYTES)
+#define KYBER_INDCPA_PUBLICKEYBYTES (KYBER_POLYVECBYTES + KYBER_SYMBYTES)
+#define KYBER_INDCPA_SECRETKEYBYTES (KYBER_POLYVECBYTES)
+#define KYBER_INDCPA_BYTES          (KYBER_POLYVECCOMPRESSEDBYTES + KYBER_POLYCOMPRESSEDBYTES)
+
+#define KYBER_PUBLICKEYBYTES  (KYBER_INDCPA_PUBLICKEYBYTES)
+/* 32 bytes of additional space to save H(pk) */
+#define KYBER_SECRETKEYBYTES  (KYBER_INDCPA_SECRETKEYBYTES + KYBER_INDCPA_PUBLICKEYBYTES + 2*KYBER_SYMBYTES)
+#define KYBER_CIPHERTEXTBYTES (KYBER_INDCPA_BYTES)
+/* A^T and t in the NTT domain (16-bit coefficients), followed by H(pk) */
+#define KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES ((KYBER_K * KYBER_K + KYBER_K) * KYBER_N * 2)
+#define KYBER_EXPANDEDPUBLICKEYBYTES (KYBER_INDCPA_EXPANDEDPUBLICKEYBYTES + KYBER_SYMBYTES)
+/* s in the NTT domain (16-bit coefficients), the expanded public key and z */
+#define KYBER_INDCPA_EXPANDEDSECRETKEYBYTES (KYBER_K * KYBER_N * 2)
+#define KYBER_EXPANDEDSECRETKEYBYTES (KYBER_INDCPA_EXPANDEDSECRETKEYBYTES + KYBER_EXPANDEDPUBLICKEYBYTES + KYBER_SYMBYTES)
+
+/* Number of operations the batch functions interleave */
+#define KYBER_BATCH 8
+
+#endif
@@ -52,6 +52,35 @@ static inline void aesni_encrypt4(uint8_t out[64], __m128i *n, const __m128i rke
     _mm_storeu_si128((__m128i *)(out + 48), f3);
 }
 
+/* Encrypts the 8 counter blocks in f and writes the first n of them to out */
+static inline void aesni_encrypt8(uint8_t *out, __m128i f[8], const __m128i rkeys[16], int n) {
+    __m128i k;
+    int i, j;
+
+    /* Actual AES encryption, 8x interleaved */
+    k = _mm_load_si128(&rkeys[0]);
+    for (j = 0; j < 8; j++) {
+        f[j] = _mm_xor_si128(f[j], k);
+    }
+
+    for (i = 1; i < 14; i++) {
+        k = _mm_load_si128(&rkeys[i]);
+        for (j = 0; j < 8; j++) {
+            f[j] = _mm_aesenc_si128(f[j], k);
+        }
+    }
+
+    k = _mm_load_si128(&rkeys[14]);
+    for (j = 0; j < 8; j++) {
+        f[j] = _mm_aesenclast_si128(f[j], k);
+    }
+
+    /* Write results */
+    for (j = 0; j < n; j++) {
+        _mm_storeu_si128((__m128i *)(out + 16 * j), f[j]);
+    }
+}
+
 void PQCLEAN_KYBER76890S_AVX2_aes256ctr_init(aes256ctr_ctx *state, const uint8_t key[32], uint64_t nonce) {
     __m128i key0, key1, temp0, temp1, temp2, temp4;
     int idx = 0;
@@ -110,10 +139,64 @@ void PQCLEAN_KYBER76890S_AVX2_aes256ctr_init(aes256ctr_ctx *state, const uint8_t
 void PQCLEAN_KYBER76890S_AVX2_aes256ctr_squeezeblocks(uint8_t *out,
         size_t nblocks,
         aes256ctr_ctx *state) {
-    size_t i;
-    for (i = 0; i < nblocks; i++) {
+    __m128i f[8];
+    const __m128i idx = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0);
+    int j;
+
+    for (; nblocks >= 2; nblocks -= 2) {
+        for (j = 0; j < 8; j++) {
+            f[j] = _mm_shuffle_epi8(_mm_add_epi64(state->n, _mm_set_epi64x(j, 0)), idx);
+        }
+        state->n = _mm_add_epi64(state->n, _mm_set_epi64x(8, 0));
+        aesni_encrypt8(out, f, state->rkeys, 8);
+        out += 128;
+    }
+    if (nblocks) {
         aesni_encrypt4(out, &state->n, state->rkeys);
-        out += 64;
+    }
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER76890S_AVX2_aes256ctr_squeezeblocks_multi
+*
+* Description: Squeeze nblocks blocks from each of nstreams counter mode
+*              streams under the key of state. Stream i uses nonce nonces[i]
+*              and a counter starting from zero; its output is written to
+*              out + i*nblocks*AES256CTR_BLOCKBYTES. The AES blocks of all
+*              streams are encrypted 8 at a time, so that short streams
+*              still keep the AES pipeline busy.
+*
+* Arguments:   - uint8_t *out: pointer to output
+*              - size_t nblocks: number of blocks per stream
+*              - const aes256ctr_ctx *state: pointer to expanded key
+*              - const uint64_t *nonces: pointer to nstreams nonces
+*              - size_t nstreams: number of streams
+**************************************************/
+void PQCLEAN_KYBER76890S_AVX2_aes256ctr_squeezeblocks_multi(uint8_t *out,
+        size_t nblocks,
+        const aes256ctr_ctx *state,
+        const uint64_t *nonces,
+        size_t nstreams) {
+    __m128i f[8];
+    const __m128i idx = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0);
+    const size_t nctr = 4 * nblocks; /* 16-byte counter blocks per stream */
+    size_t i, s = 0, ctr = 0, total = nctr * nstreams;
+    int j;
+
+    for (i = 0; i < total; i += 8) {
+        for (j = 0; j < 8; j++) {
+            f[j] = _mm_shuffle_epi8(_mm_set_epi64x((int64_t)ctr, (int64_t)nonces[s]), idx);
+            if (++ctr == nctr) {
+                ctr = 0;
+                /* Past the last stream: repeat its nonce for the unused blocks */
+                s += (s + 1 < nstreams);
+            }
+        }
+        if (total - i >= 8) {
+            aesni_encrypt8(out + 16 * i, f, state->rkeys, 8);
+        } else {
+            aesni_encrypt8(out + 16 * i, f, state->rkeys, (int)(total - i));
+        }
     }
 }
 
@@ -127,11 +210,9 @@ void PQCLEAN_KYBER76890S_AVX2_aes256ctr_prf(uint8_t *out,
 
     PQCLEAN_KYBER76890S_AVX2_aes256ctr_init(&state, key, nonce);
 
-    while (outlen >= 64) {
-        aesni_encrypt4(out, &state.n, state.rkeys);
-        outlen -= 64;
-        out += 64;
-    }
+    PQCLEAN_KYBER76890S_AVX2_aes256ctr_squeezeblocks(out, outlen / 64, &state);
+    out += outlen - outlen % 64;
+    outlen %= 64;
 
     if (outlen) {
         aesni_encrypt4(buf, &state.n, state.rkeys);
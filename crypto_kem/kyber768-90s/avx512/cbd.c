@@ -0,0 +1,68 @@
+#include "cbd.h"
+#include "params.h"
+#include <immintrin.h>
+#include <stdint.h>
+
+/*************************************************
+* Name:        cbd2
+*
+* Description: Given an array of uniformly random bytes, compute
+*              polynomial with coefficients distributed according to
+*              a centered binomial distribution with parameter eta=2.
+*              Works on 64 input bytes (128 coefficients) per iteration.
+*
+* Arguments:   - poly *r: pointer to output polynomial
+*              - const __m256i *buf: pointer to aligned input byte array
+**************************************************/
+static void cbd2(poly *restrict r, const __m256i buf[2 * KYBER_N / 128]) {
+    unsigned int i;
+    __m512i f0, f1, f2, f3;
+    const __m512i mask55 = _mm512_set1_epi32(0x55555555);
+    const __m512i mask33 = _mm512_set1_epi32(0x33333333);
+    const __m512i mask03 = _mm512_set1_epi32(0x03030303);
+    const __m512i mask0F = _mm512_set1_epi32(0x0F0F0F0F);
+    const __m512i idx0 = _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0);
+    const __m512i idx1 = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+
+    for (i = 0; i < KYBER_N / 128; i++) {
+        f0 = _mm512_loadu_si512(&buf[2 * i]);
+
+        f1 = _mm512_srli_epi16(f0, 1);
+        f0 = _mm512_and_si512(mask55, f0);
+        f1 = _mm512_and_si512(mask55, f1);
+        f0 = _mm512_add_epi8(f0, f1);
+
+        f1 = _mm512_srli_epi16(f0, 2);
+        f0 = _mm512_and_si512(mask33, f0);
+        f1 = _mm512_and_si512(mask33, f1);
+        f0 = _mm512_add_epi8(f0, mask33);
+        f0 = _mm512_sub_epi8(f0, f1);
+
+        f1 = _mm512_srli_epi16(f0, 4);
+        f0 = _mm512_and_si512(mask0F, f0);
+        f1 = _mm512_and_si512(mask0F, f1);
+        f0 = _mm512_sub_epi8(f0, mask03);
+        f1 = _mm512_sub_epi8(f1, mask03);
+
+        f2 = _mm512_unpacklo_epi8(f0, f1);
+        f3 = _mm512_unpackhi_epi8(f0, f1);
+
+        /* interleave the 128-bit lanes of f2 and f3 as the avx2 code stores them */
+        f0 = _mm512_permutex2var_epi64(f2, idx0, f3);
+        f1 = _mm512_permutex2var_epi64(f2, idx1, f3);
+
+        _mm512_store_si512(&r->vec512[4 * i + 0], _mm512_cvtepi8_epi16(_mm512_castsi512_si256(f0)));
+        _mm512_store_si512(&r->vec512[4 * i + 1], _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(f0, 1)));
+        _mm512_store_si512(&r->vec512[4 * i + 2], _mm512_cvtepi8_epi16(_mm512_castsi512_si256(f1)));
+        _mm512_store_si512(&r->vec512[4 * i + 3], _mm512_cvtepi8_epi16(_mm512_extracti64x4_epi64(f1, 1)));
+    }
+}
+
+/* buf 32 bytes longer for cbd3 */
+void PQCLEAN_KYBER76890S_AVX512_poly_cbd_eta1(poly *r, const __m256i buf[KYBER_ETA1 * KYBER_N / 128 + 1]) {
+    cbd2(r, buf);
+}
+
+void PQCLEAN_KYBER76890S_AVX512_poly_cbd_eta2(poly *r, const __m256i buf[KYBER_ETA2 * KYBER_N / 128]) {
+    cbd2(r, buf);
+}
@@ -0,0 +1,576 @@
+#include "align.h"
+#include "consts.h"
+#include "ntt.h"
+#include <immintrin.h>
+#include <stdint.h>
+
+/*
+ * 32-lane versions of the NTT, inverse NTT and base multiplication of the
+ * avx2 implementation. They keep the coefficient order of the avx2 code, so
+ * that the packing and shuffling routines of shuffle.S can be reused as is.
+ *
+ * The avx2 code transforms the two halves of a polynomial (coefficients
+ * 0..127 and 128..255) one after the other with the same sequence of
+ * instructions but different zetas. Here the 16 coefficients the avx2 code
+ * keeps in one ymm register for the first half go into the low 256 bits of a
+ * zmm register, and the corresponding 16 coefficients of the second half into
+ * its high 256 bits, so that both halves are processed by the same
+ * instructions. The in-lane shuffles work unchanged on zmm registers;
+ * only the 128-bit lane swap (shuffle8) needs a two-source permutation.
+ *
+ * The functions below mirror the macros of ntt.S, invntt.S, basemul.S and
+ * fq.inc, with y[i] standing for register ymm<i>.
+ */
+
+/* Load 16 coefficients at lo and 16 at hi into one vector */
+static inline __m512i load2(const __m256i *lo, const __m256i *hi) {
+    return _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_load_si256(lo)), _mm256_load_si256(hi), 1);
+}
+
+static inline void store2(__m256i *lo, __m256i *hi, __m512i a) {
+    _mm256_store_si256(lo, _mm512_castsi512_si256(a));
+    _mm256_store_si256(hi, _mm512_extracti64x4_epi64(a, 1));
+}
+
+/*
+ * Converts between vectors holding 32 consecutive coefficients and vectors
+ * holding 16 coefficients of each half: [r0 r1] [r8 r9] <-> [r0 r8] [r1 r9]
+ */
+static inline void transpose2(__m512i y[16], int a, int b) {
+    __m512i t0, t1;
+    t0 = _mm512_shuffle_i64x2(y[a], y[b], 0x44);
+    t1 = _mm512_shuffle_i64x2(y[a], y[b], 0xEE);
+    y[a] = t0;
+    y[b] = t1;
+}
+
+static inline __m512i bcast(const __m256i *a) {
+    return _mm512_broadcast_i64x4(_mm256_load_si256(a));
+}
+
+/* Broadcast the four 16-bit values at qdata.coeffs[off] */
+static inline __m512i bcastq(const __m256i *qdata, unsigned int off) {
+    return _mm512_broadcastq_epi64(_mm_loadl_epi64((const __m128i *)((const int16_t *)qdata + off)));
+}
+
+static inline void mul(__m512i y[16],
+                       int rh0, int rh1, int rh2, int rh3,
+                       int zl0, int zl1, int zh0, int zh1) {
+    y[12] = _mm512_mullo_epi16(y[zl0], y[rh0]);
+    y[13] = _mm512_mullo_epi16(y[zl0], y[rh1]);
+    y[14] = _mm512_mullo_epi16(y[zl1], y[rh2]);
+    y[15] = _mm512_mullo_epi16(y[zl1], y[rh3]);
+    y[rh0] = _mm512_mulhi_epi16(y[zh0], y[rh0]);
+    y[rh1] = _mm512_mulhi_epi16(y[zh0], y[rh1]);
+    y[rh2] = _mm512_mulhi_epi16(y[zh1], y[rh2]);
+    y[rh3] = _mm512_mulhi_epi16(y[zh1], y[rh3]);
+}
+
+static inline void reduce(__m512i y[16]) {
+    y[12] = _mm512_mulhi_epi16(y[0], y[12]);
+    y[13] = _mm512_mulhi_epi16(y[0], y[13]);
+    y[14] = _mm512_mulhi_epi16(y[0], y[14]);
+    y[15] = _mm512_mulhi_epi16(y[0], y[15]);
+}
+
+static inline void update(__m512i y[16], int rln,
+                          int rl0, int rl1, int rl2, int rl3,
+                          int rh0, int rh1, int rh2, int rh3) {
+    y[rln] = _mm512_add_epi16(y[rl0], y[rh0]);
+    y[rh0] = _mm512_sub_epi16(y[rl0], y[rh0]);
+    y[rl0] = _mm512_add_epi16(y[rl1], y[rh1]);
+    y[rh1] = _mm512_sub_epi16(y[rl1], y[rh1]);
+    y[rl1] = _mm512_add_epi16(y[rl2], y[rh2]);
+    y[rh2] = _mm512_sub_epi16(y[rl2], y[rh2]);
+    y[rl2] = _mm512_add_epi16(y[rl3], y[rh3]);
+    y[rh3] = _mm512_sub_epi16(y[rl3], y[rh3]);
+
+    y[rln] = _mm512_sub_epi16(y[rln], y[12]);
+    y[rh0] = _mm512_add_epi16(y[rh0], y[12]);
+    y[rl0] = _mm512_sub_epi16(y[rl0], y[13]);
+    y[rh1] = _mm512_add_epi16(y[rh1], y[13]);
+    y[rl1] = _mm512_sub_epi16(y[rl1], y[14]);
+    y[rh2] = _mm512_add_epi16(y[rh2], y[14]);
+    y[rl2] = _mm512_sub_epi16(y[rl2], y[15]);
+    y[rh3] = _mm512_add_epi16(y[rh3], y[15]);
+}
+
+static inline void butterfly(__m512i y[16],
+                             int rl0, int rl1, int rl2, int rl3,
+                             int rh0, int rh1, int rh2, int rh3,
+                             int zl0, int zl1, int zh0, int zh1) {
+    y[12] = _mm512_sub_epi16(y[rh0], y[rl0]);
+    y[rl0] = _mm512_add_epi16(y[rl0], y[rh0]);
+    y[13] = _mm512_sub_epi16(y[rh1], y[rl1]);
+
+    y[rh0] = _mm512_mullo_epi16(y[zl0], y[12]);
+    y[rl1] = _mm512_add_epi16(y[rl1], y[rh1]);
+    y[14] = _mm512_sub_epi16(y[rh2], y[rl2]);
+
+    y[rh1] = _mm512_mullo_epi16(y[zl0], y[13]);
+    y[rl2] = _mm512_add_epi16(y[rl2], y[rh2]);
+    y[15] = _mm512_sub_epi16(y[rh3], y[rl3]);
+
+    y[rh2] = _mm512_mullo_epi16(y[zl1], y[14]);
+    y[rl3] = _mm512_add_epi16(y[rl3], y[rh3]);
+    y[rh3] = _mm512_mullo_epi16(y[zl1], y[15]);
+
+    y[12] = _mm512_mulhi_epi16(y[zh0], y[12]);
+    y[13] = _mm512_mulhi_epi16(y[zh0], y[13]);
+    y[14] = _mm512_mulhi_epi16(y[zh1], y[14]);
+    y[15] = _mm512_mulhi_epi16(y[zh1], y[15]);
+
+    y[rh0] = _mm512_mulhi_epi16(y[0], y[rh0]);
+    y[rh1] = _mm512_mulhi_epi16(y[0], y[rh1]);
+    y[rh2] = _mm512_mulhi_epi16(y[0], y[rh2]);
+    y[rh3] = _mm512_mulhi_epi16(y[0], y[rh3]);
+
+    y[rh0] = _mm512_sub_epi16(y[12], y[rh0]);
+    y[rh1] = _mm512_sub_epi16(y[13], y[rh1]);
+    y[rh2] = _mm512_sub_epi16(y[14], y[rh2]);
+    y[rh3] = _mm512_sub_epi16(y[15], y[rh3]);
+}
+
+static inline __m512i red16(const __m512i y[16], __m512i r) {
+    __m512i x;
+    x = _mm512_mulhi_epi16(y[1], r);
+    x = _mm512_srai_epi16(x, 10);
+    x = _mm512_mullo_epi16(y[0], x);
+    return _mm512_sub_epi16(r, x);
+}
+
+static inline void fqmulprecomp(__m512i y[16], int al, int ah, int b) {
+    __m512i x;
+    x = _mm512_mullo_epi16(y[al], y[b]);
+    y[b] = _mm512_mulhi_epi16(y[ah], y[b]);
+    x = _mm512_mulhi_epi16(y[0], x);
+    y[b] = _mm512_sub_epi16(y[b], x);
+}
+
+/* Swaps the 128-bit lanes of r0 and r1 within each 256-bit half */
+static inline void shuffle8(__m512i y[16], int r0, int r1, int r2, int r3) {
+    const __m512i idxlo = _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+    const __m512i idxhi = _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+    __m512i t2, t3;
+    t2 = _mm512_permutex2var_epi64(y[r0], idxlo, y[r1]);
+    t3 = _mm512_permutex2var_epi64(y[r0], idxhi, y[r1]);
+    y[r2] = t2;
+    y[r3] = t3;
+}
+
+static inline void shuffle4(__m512i y[16], int r0, int r1, int r2, int r3) {
+    __m512i t2, t3;
+    t2 = _mm512_unpacklo_epi64(y[r0], y[r1]);
+    t3 = _mm512_unpackhi_epi64(y[r0], y[r1]);
+    y[r2] = t2;
+    y[r3] = t3;
+}
+
+static inline void shuffle2(__m512i y[16], int r0, int r1, int r2, int r3) {
+    y[r2] = _mm512_castps_si512(_mm512_moveldup_ps(_mm512_castsi512_ps(y[r1])));
+    y[r2] = _mm512_mask_blend_epi32(0xAAAA, y[r0], y[r2]);
+    y[r0] = _mm512_srli_epi64(y[r0], 32);
+    y[r3] = _mm512_mask_blend_epi32(0xAAAA, y[r0], y[r1]);
+}
+
+static inline void shuffle1(__m512i y[16], int r0, int r1, int r2, int r3) {
+    y[r2] = _mm512_slli_epi32(y[r1], 16);
+    y[r2] = _mm512_mask_blend_epi16(0xAAAAAAAA, y[r0], y[r2]);
+    y[r0] = _mm512_srli_epi32(y[r0], 16);
+    y[r3] = _mm512_mask_blend_epi16(0xAAAAAAAA, y[r0], y[r1]);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER76890S_AVX512_ntt_avx
+*
+* Description: Forward NTT, 32 coefficients per instruction.
+*              Same input and output order as the avx2 version.
+*
+* Arguments:   - __m256i *r: pointer to in/output polynomial
+*              - const __m256i *qdata: pointer to precomputed constants
+**************************************************/
+void PQCLEAN_KYBER76890S_AVX512_ntt_avx(__m256i *r, const __m256i *qdata) {
+    __m512i y[16];
+    const __m256i *zetas = qdata + _ZETAS_EXP / 16;
+
+    y[0] = bcast(&qdata[_16XQ / 16]);
+
+    /* level 0 */
+    y[15] = bcastq(qdata, _ZETAS_EXP + 0);
+    y[2] = bcastq(qdata, _ZETAS_EXP + 4);
+    y[8] = _mm512_load_si512(&r[8]);
+    y[9] = _mm512_load_si512(&r[10]);
+    y[10] = _mm512_load_si512(&r[12]);
+    y[11] = _mm512_load_si512(&r[14]);
+
+    mul(y, 8, 9, 10, 11, 15, 15, 2, 2);
+
+    y[4] = _mm512_load_si512(&r[0]);
+    y[5] = _mm512_load_si512(&r[2]);
+    y[6] = _mm512_load_si512(&r[4]);
+    y[7] = _mm512_load_si512(&r[6]);
+
+    reduce(y);
+    update(y, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+
+    /* levels 1 to 6, both halves at once */
+    transpose2(y, 3, 8);
+    transpose2(y, 4, 9);
+    transpose2(y, 5, 10);
+    transpose2(y, 6, 11);
+    y[7] = y[9];
+    y[9] = y[10];
+    y[10] = y[6];
+    y[6] = y[4];
+    y[4] = y[3];
+    y[12] = y[8];
+    y[8] = y[5];
+    y[5] = y[12];
+
+    /* level 1 */
+    y[15] = load2(&zetas[1], &zetas[15]);
+    y[2] = load2(&zetas[2], &zetas[16]);
+
+    mul(y, 8, 9, 10, 11, 15, 15, 2, 2);
+
+    reduce(y);
+    update(y, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+
+    /* level 2 */
+    shuffle8(y, 5, 10, 7, 10);
+    shuffle8(y, 6, 11, 5, 11);
+
+    y[15] = load2(&zetas[3], &zetas[17]);
+    y[2] = load2(&zetas[4], &zetas[18]);
+
+    mul(y, 7, 10, 5, 11, 15, 15, 2, 2);
+
+    shuffle8(y, 3, 8, 6, 8);
+    shuffle8(y, 4, 9, 3, 9);
+
+    reduce(y);
+    update(y, 4, 6, 8, 3, 9, 7, 10, 5, 11);
+
+    /* level 3 */
+    shuffle4(y, 8, 5, 9, 5);
+    shuffle4(y, 3, 11, 8, 11);
+
+    y[15] = load2(&zetas[5], &zetas[19]);
+    y[2] = load2(&zetas[6], &zetas[20]);
+
+    mul(y, 9, 5, 8, 11, 15, 15, 2, 2);
+
+    shuffle4(y, 4, 7, 3, 7);
+    shuffle4(y, 6, 10, 4, 10);
+
+    reduce(y);
+    update(y, 6, 3, 7, 4, 10, 9, 5, 8, 11);
+
+    /* level 4 */
+    shuffle2(y, 7, 8, 10, 8);
+    shuffle2(y, 4, 11, 7, 11);
+
+    y[15] = load2(&zetas[7], &zetas[21]);
+    y[2] = load2(&zetas[8], &zetas[22]);
+
+    mul(y, 10, 8, 7, 11, 15, 15, 2, 2);
+
+    shuffle2(y, 6, 9, 4, 9);
+    shuffle2(y, 3, 5, 6, 5);
+
+    reduce(y);
+    update(y, 3, 4, 9, 6, 5, 10, 8, 7, 11);
+
+    /* level 5 */
+    shuffle1(y, 9, 7, 5, 7);
+    shuffle1(y, 6, 11, 9, 11);
+
+    y[15] = load2(&zetas[9], &zetas[23]);
+    y[2] = load2(&zetas[10], &zetas[24]);
+
+    mul(y, 5, 7, 9, 11, 15, 15, 2, 2);
+
+    shuffle1(y, 3, 10, 6, 10);
+    shuffle1(y, 4, 8, 3, 8);
+
+    reduce(y);
+    update(y, 4, 6, 10, 3, 8, 5, 7, 9, 11);
+
+    /* level 6 */
+    y[14] = load2(&zetas[11], &zetas[25]);
+    y[15] = load2(&zetas[13], &zetas[27]);
+    y[8] = load2(&zetas[12], &zetas[26]);
+    y[2] = load2(&zetas[14], &zetas[28]);
+
+    mul(y, 10, 3, 9, 11, 14, 15, 8, 2);
+
+    reduce(y);
+    update(y, 8, 4, 6, 5, 7, 10, 3, 9, 11);
+
+    transpose2(y, 8, 4);
+    transpose2(y, 10, 3);
+    transpose2(y, 6, 5);
+    transpose2(y, 9, 11);
+
+    _mm512_store_si512(&r[0], y[8]);
+    _mm512_store_si512(&r[2], y[10]);
+    _mm512_store_si512(&r[4], y[6]);
+    _mm512_store_si512(&r[6], y[9]);
+    _mm512_store_si512(&r[8], y[4]);
+    _mm512_store_si512(&r[10], y[3]);
+    _mm512_store_si512(&r[12], y[5]);
+    _mm512_store_si512(&r[14], y[11]);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER76890S_AVX512_invntt_avx
+*
+* Description: Inverse NTT and multiplication by Montgomery factor 2^16,
+*              32 coefficients per instruction.
+*              Same input and output order as the avx2 version.
+*
+* Arguments:   - __m256i *r: pointer to in/output polynomial
+*              - const __m256i *qdata: pointer to precomputed constants
+**************************************************/
+void PQCLEAN_KYBER76890S_AVX512_invntt_avx(__m256i *r, const __m256i *qdata) {
+    __m512i y[16], idx;
+    const __m256i *zetas = qdata + _ZETAS_EXP / 16;
+
+    y[0] = bcast(&qdata[_16XQ / 16]);
+
+    /* levels 0 to 5, both halves at once */
+    /* level 0 */
+    y[2] = bcast(&qdata[_16XFLO / 16]);
+    y[3] = bcast(&qdata[_16XFHI / 16]);
+
+    y[4] = _mm512_load_si512(&r[0]);
+    y[5] = _mm512_load_si512(&r[8]);
+    y[6] = _mm512_load_si512(&r[2]);
+    y[7] = _mm512_load_si512(&r[10]);
+    transpose2(y, 4, 5);
+    transpose2(y, 6, 7);
+
+    fqmulprecomp(y, 2, 3, 4);
+    fqmulprecomp(y, 2, 3, 6);
+    fqmulprecomp(y, 2, 3, 5);
+    fqmulprecomp(y, 2, 3, 7);
+
+    y[8] = _mm512_load_si512(&r[4]);
+    y[9] = _mm512_load_si512(&r[12]);
+    y[10] = _mm512_load_si512(&r[6]);
+    y[11] = _mm512_load_si512(&r[14]);
+    transpose2(y, 8, 9);
+    transpose2(y, 10, 11);
+
+    fqmulprecomp(y, 2, 3, 8);
+    fqmulprecomp(y, 2, 3, 10);
+    fqmulprecomp(y, 2, 3, 9);
+    fqmulprecomp(y, 2, 3, 11);
+
+    y[15] = _mm512_permutex_epi64(load2(&zetas[27], &zetas[13]), 0x4E);
+    y[1] = _mm512_permutex_epi64(load2(&zetas[25], &zetas[11]), 0x4E);
+    y[2] = _mm512_permutex_epi64(load2(&zetas[28], &zetas[14]), 0x4E);
+    y[3] = _mm512_permutex_epi64(load2(&zetas[26], &zetas[12]), 0x4E);
+    y[12] = bcast(&qdata[_REVIDXB / 16]);
+    y[15] = _mm512_shuffle_epi8(y[15], y[12]);
+    y[1] = _mm512_shuffle_epi8(y[1], y[12]);
+    y[2] = _mm512_shuffle_epi8(y[2], y[12]);
+    y[3] = _mm512_shuffle_epi8(y[3], y[12]);
+
+    butterfly(y, 4, 5, 8, 9, 6, 7, 10, 11, 15, 1, 2, 3);
+
+    /* level 1 */
+    y[2] = _mm512_permutex_epi64(load2(&zetas[23], &zetas[9]), 0x4E);
+    y[3] = _mm512_permutex_epi64(load2(&zetas[24], &zetas[10]), 0x4E);
+    y[1] = bcast(&qdata[_REVIDXB / 16]);
+    y[2] = _mm512_shuffle_epi8(y[2], y[1]);
+    y[3] = _mm512_shuffle_epi8(y[3], y[1]);
+
+    butterfly(y, 4, 5, 6, 7, 8, 9, 10, 11, 2, 2, 3, 3);
+
+    shuffle1(y, 4, 5, 3, 5);
+    shuffle1(y, 6, 7, 4, 7);
+    shuffle1(y, 8, 9, 6, 9);
+    shuffle1(y, 10, 11, 8, 11);
+
+    /* level 2 */
+    idx = bcast(&qdata[_REVIDXD / 16]);
+    idx = _mm512_mask_add_epi32(idx, 0xFF00, idx, _mm512_set1_epi32(8));
+    y[2] = _mm512_permutexvar_epi32(idx, load2(&zetas[21], &zetas[7]));
+    y[10] = _mm512_permutexvar_epi32(idx, load2(&zetas[22], &zetas[8]));
+
+    butterfly(y, 3, 4, 6, 8, 5, 7, 9, 11, 2, 2, 10, 10);
+
+    y[1] = bcast(&qdata[_16XV / 16]);
+    y[3] = red16(y, y[3]);
+
+    shuffle2(y, 3, 4, 10, 4);
+    shuffle2(y, 6, 8, 3, 8);
+    shuffle2(y, 5, 7, 6, 7);
+    shuffle2(y, 9, 11, 5, 11);
+
+    /* level 3 */
+    y[2] = _mm512_permutex_epi64(load2(&zetas[19], &zetas[5]), 0x1B);
+    y[9] = _mm512_permutex_epi64(load2(&zetas[20], &zetas[6]), 0x1B);
+
+    butterfly(y, 10, 3, 6, 5, 4, 8, 7, 11, 2, 2, 9, 9);
+
+    shuffle4(y, 10, 3, 9, 3);
+    shuffle4(y, 6, 5, 10, 5);
+    shuffle4(y, 4, 8, 6, 8);
+    shuffle4(y, 7, 11, 4, 11);
+
+    /* level 4 */
+    y[2] = _mm512_permutex_epi64(load2(&zetas[17], &zetas[3]), 0x4E);
+    y[7] = _mm512_permutex_epi64(load2(&zetas[18], &zetas[4]), 0x4E);
+
+    butterfly(y, 9, 10, 6, 4, 3, 5, 8, 11, 2, 2, 7, 7);
+
+    y[9] = red16(y, y[9]);
+
+    shuffle8(y, 9, 10, 7, 10);
+    shuffle8(y, 6, 4, 9, 4);
+    shuffle8(y, 3, 5, 6, 5);
+    shuffle8(y, 8, 11, 3, 11);
+
+    /* level 5 */
+    y[2] = load2(&zetas[15], &zetas[1]);
+    y[8] = load2(&zetas[16], &zetas[2]);
+
+    butterfly(y, 7, 9, 6, 3, 10, 4, 5, 11, 2, 2, 8, 8);
+
+    /* level 6 */
+    transpose2(y, 7, 9);
+    transpose2(y, 6, 3);
+    transpose2(y, 10, 4);
+    transpose2(y, 5, 11);
+    y[12] = y[7];
+    y[7] = y[5];
+    y[5] = y[6];
+    y[6] = y[10];
+    y[10] = y[4];
+    y[4] = y[12];
+    y[8] = y[9];
+    y[9] = y[3];
+
+    y[2] = bcastq(qdata, _ZETAS_EXP + 0);
+    y[3] = bcastq(qdata, _ZETAS_EXP + 4);
+
+    butterfly(y, 4, 5, 6, 7, 8, 9, 10, 11, 2, 2, 3, 3);
+
+    /* The avx2 code reduces coefficients 0..15 only */
+    y[4] = _mm512_mask_blend_epi16(0x0000FFFF, y[4], red16(y, y[4]));
+
+    _mm512_store_si512(&r[0], y[4]);
+    _mm512_store_si512(&r[2], y[5]);
+    _mm512_store_si512(&r[4], y[6]);
+    _mm512_store_si512(&r[6], y[7]);
+    _mm512_store_si512(&r[8], y[8]);
+    _mm512_store_si512(&r[10], y[9]);
+    _mm512_store_si512(&r[12], y[10]);
+    _mm512_store_si512(&r[14], y[11]);
+}
+
+/*************************************************
+* Name:        PQCLEAN_KYBER76890S_AVX512_basemul_avx
+*
+* Description: Multiplication of two polynomials in NTT domain,
+*              32 coefficients per instruction.
+*              Same input and output order as the avx2 version.
+*
+* Arguments:   - __m256i *r: pointer to output polynomial
+*              - const __m256i *a: pointer to first input polynomial
+*              - const __m256i *b: pointer to second input polynomial
+*              - const __m256i *qdata: pointer to precomputed constants
+**************************************************/
+void PQCLEAN_KYBER76890S_AVX512_basemul_avx(__m256i *r,
+        const __m256i *a,
+        const __m256i *b,
+        const __m256i *qdata) {
+    unsigned int i;
+    __m512i y[16], t;
+    const __m256i *zetas = qdata + _ZETAS_EXP / 16;
+
+    /* blocks of 64 coefficients 4*i+0..3 and 4*i+4..7 at once */
+    for (i = 0; i < 2; i++) {
+        y[0] = bcast(&qdata[_16XQINV / 16]);
+        y[1] = load2(&a[8 * i + 0], &a[8 * i + 4]);    // a0
+        y[2] = load2(&a[8 * i + 1], &a[8 * i + 5]);    // b0
+        y[3] = load2(&a[8 * i + 2], &a[8 * i + 6]);    // a1
+        y[4] = load2(&a[8 * i + 3], &a[8 * i + 7]);    // b1
+
+        y[9] = _mm512_mullo_epi16(y[0], y[1]);         // a0.lo
+        y[10] = _mm512_mullo_epi16(y[0], y[2]);        // b0.lo
+        y[11] = _mm512_mullo_epi16(y[0], y[3]);        // a1.lo
+        y[12] = _mm512_mullo_epi16(y[0], y[4]);        // b1.lo
+
+        y[5] = load2(&b[8 * i + 0], &b[8 * i + 4]);    // c0
+        y[6] = load2(&b[8 * i + 1], &b[8 * i + 5]);    // d0
+
+        y[13] = _mm512_mulhi_epi16(y[5], y[1]);        // a0c0.hi
+        y[1] = _mm512_mulhi_epi16(y[6], y[1]);         // a0d0.hi
+        y[14] = _mm512_mulhi_epi16(y[5], y[2]);        // b0c0.hi
+        y[2] = _mm512_mulhi_epi16(y[6], y[2]);         // b0d0.hi
+
+        y[7] = load2(&b[8 * i + 2], &b[8 * i + 6]);    // c1
+        y[8] = load2(&b[8 * i + 3], &b[8 * i + 7]);    // d1
+
+        y[15] = _mm512_mulhi_epi16(y[7], y[3]);        // a1c1.hi
+        y[3] = _mm512_mulhi_epi16(y[8], y[3]);         // a1d1.hi
+        y[0] = _mm512_mulhi_epi16(y[7], y[4]);         // b1c1.hi
+        y[4] = _mm512_mulhi_epi16(y[8], y[4]);         // b1d1.hi
+
+        t = y[13];
+
+        y[13] = _mm512_mullo_epi16(y[5], y[9]);        // a0c0.lo
+        y[9] = _mm512_mullo_epi16(y[6], y[9]);         // a0d0.lo
+        y[5] = _mm512_mullo_epi16(y[5], y[10]);        // b0c0.lo
+        y[10] = _mm512_mullo_epi16(y[6], y[10]);       // b0d0.lo
+
+        y[6] = _mm512_mullo_epi16(y[7], y[11]);        // a1c1.lo
+        y[11] = _mm512_mullo_epi16(y[8], y[11]);       // a1d1.lo
+        y[7] = _mm512_mullo_epi16(y[7], y[12]);        // b1c1.lo
+        y[12] = _mm512_mullo_epi16(y[8], y[12]);       // b1d1.lo
+
+        y[8] = bcast(&qdata[_16XQ / 16]);
+        y[13] = _mm512_mulhi_epi16(y[8], y[13]);
+        y[9] = _mm512_mulhi_epi16(y[8], y[9]);
+        y[5] = _mm512_mulhi_epi16(y[8], y[5]);
+        y[10] = _mm512_mulhi_epi16(y[8], y[10]);
+        y[6] = _mm512_mulhi_epi16(y[8], y[6]);
+        y[11] = _mm512_mulhi_epi16(y[8], y[11]);
+        y[7] = _mm512_mulhi_epi16(y[8], y[7]);
+        y[12] = _mm512_mulhi_epi16(y[8], y[12]);
+
+        y[13] = _mm512_sub_epi16(y[13], t);            // -a0c0
+        y[9] = _mm512_sub_epi16(y[1], y[9]);           // a0d0
+        y[5] = _mm512_sub_epi16(y[14], y[5]);          // b0c0
+        y[10] = _mm512_sub_epi16(y[2], y[10]);         // b0d0
+
+        y[6] = _mm512_sub_epi16(y[15], y[6]);          // a1c1
+        y[11] = _mm512_sub_epi16(y[3], y[11]);         // a1d1
+        y[7] = _mm512_sub_epi16(y[0], y[7]);           // b1c1
+        y[12] = _mm512_sub_epi16(y[4], y[12]);         // b1d1
+
+        y[0] = load2(&zetas[14 * i + 11], &zetas[14 * i + 13]);
+        y[1] = load2(&zetas[14 * i + 12], &zetas[14 * i + 14]);
+        y[2] = _mm512_mullo_epi16(y[0], y[10]);
+        y[3] = _mm512_mullo_epi16(y[0], y[12]);
+        y[10] = _mm512_mulhi_epi16(y[1], y[10]);
+        y[12] = _mm512_mulhi_epi16(y[1], y[12]);
+        y[2] = _mm512_mulhi_epi16(y[8], y[2]);
+        y[3] = _mm512_mulhi_epi16(y[8], y[3]);
+        y[10] = _mm512_sub_epi16(y[10], y[2]);         // rb0d0
+        y[12] = _mm512_sub_epi16(y[12], y[3]);         // rb1d1
+
+        y[9] = _mm512_add_epi16(y[9], y[5]);
+        y[11] = _mm512_add_epi16(y[11], y[7]);
+        y[13] = _mm512_sub_epi16(y[10], y[13]);
+        y[6] = _mm512_sub_epi16(y[6], y[12]);
+
+        store2(&r[8 * i + 0], &r[8 * i + 4], y[13]);
+        store2(&r[8 * i + 1], &r[8 * i + 5], y[9]);
+        store2(&r[8 * i + 2], &r[8 * i + 6], y[6]);
+        store2(&r[8 * i + 3], &r[8 * i + 7], y[11]);
+    }
+}
@@ -0,0 +1,93 @@
+#include "align.h"
+#include "consts.h"
+#include "params.h"
+#include "rejsample.h"
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+//#define BMI
+
+
+unsigned int PQCLEAN_KYBER76890S_AVX512_rej_uniform_avx(int16_t *restrict r, const uint8_t *buf) {
+    unsigned int ctr, pos;
+    uint16_t val0, val1;
+    uint32_t good;
+    uint64_t idx0;
+    const __m256i bound  = _mm256_load_si256(&PQCLEAN_KYBER76890S_AVX512_qdata.vec[_16XQ / 16]);
+    const __m256i ones   = _mm256_set1_epi8(1);
+    const __m256i mask  = _mm256_set1_epi16(0xFFF);
+    const __m256i idx8  = _mm256_set_epi8(15, 14, 14, 13, 12, 11, 11, 10,
+                                          9, 8, 8, 7, 6, 5, 5, 4,
+                                          11, 10, 10, 9, 8, 7, 7, 6,
+                                          5, 4, 4, 3, 2, 1, 1, 0);
+    const __m512i bound512 = _mm512_broadcast_i64x4(bound);
+    const __m512i mask512 = _mm512_set1_epi16(0xFFF);
+    const __m512i idx64 = _mm512_set_epi64(5, 4, 4, 3, 2, 1, 1, 0);
+    const __m512i idx8x2 = _mm512_broadcast_i64x4(idx8);
+    __m512i f0, f1, g0, g1;
+    __m128i f, t, pilo, pihi;
+
+    ctr = pos = 0;
+    /* 32 candidates per iteration; the accepted ones are packed with vpcompressd */
+    while (ctr <= KYBER_N - 32 && pos <= REJ_UNIFORM_AVX_BUFLEN - 48) {
+        f0 = _mm512_maskz_loadu_epi8(0xFFFFFFFFFFFF, &buf[pos]);
+        f0 = _mm512_permutexvar_epi64(idx64, f0);
+        f0 = _mm512_shuffle_epi8(f0, idx8x2);
+        f1 = _mm512_srli_epi16(f0, 4);
+        f0 = _mm512_mask_blend_epi16(0xAAAAAAAA, f0, f1);
+        f0 = _mm512_and_si512(f0, mask512);
+        pos += 48;
+
+        good = _mm512_cmpgt_epi16_mask(bound512, f0);
+
+        g0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(f0));
+        g1 = _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(f0, 1));
+        g0 = _mm512_maskz_compress_epi32(good & 0xFFFF, g0);
+        g1 = _mm512_maskz_compress_epi32(good >> 16, g1);
+
+        _mm256_storeu_si256((__m256i *)&r[ctr], _mm512_cvtepi32_epi16(g0));
+        ctr += _mm_popcnt_u32(good & 0xFFFF);
+        _mm256_storeu_si256((__m256i *)&r[ctr], _mm512_cvtepi32_epi16(g1));
+        ctr += _mm_popcnt_u32(good >> 16);
+    }
+
+    while (ctr <= KYBER_N - 8 && pos <= REJ_UNIFORM_AVX_BUFLEN - 12) {
+        f = _mm_loadu_si128((__m128i *)&buf[pos]);
+        f = _mm_shuffle_epi8(f, _mm256_castsi256_si128(idx8));
+        t = _mm_srli_epi16(f, 4);
+        f = _mm_blend_epi16(f, t, 0xAA);
+        f = _mm_and_si128(f, _mm256_castsi256_si128(mask));
+        pos += 12;
+
+        t = _mm_cmpgt_epi16(_mm256_castsi256_si128(bound), f);
+        good = _mm_movemask_epi8(t);
+
+        good &= 0x5555;
+        idx0 = _pdep_u64(good, 0x1111111111111111);
+        idx0 = (idx0 << 8) - idx0;
+        idx0 = _pext_u64(0x0E0C0A0806040200, idx0);
+        pilo = _mm_cvtsi64_si128(idx0);
+
+        pihi = _mm_add_epi8(pilo, _mm256_castsi256_si128(ones));
+        pilo = _mm_unpacklo_epi8(pilo, pihi);
+        f = _mm_shuffle_epi8(f, pilo);
+        _mm_storeu_si128((__m128i *)&r[ctr], f);
+        ctr += _mm_popcnt_u32(good);
+    }
+
+    while (ctr < KYBER_N && pos <= REJ_UNIFORM_AVX_BUFLEN - 3) {
+        val0 = ((buf[pos + 0] >> 0) | ((uint16_t)buf[pos + 1] << 8)) & 0xFFF;
+        val1 = ((buf[pos + 1] >> 4) | ((uint16_t)buf[pos + 2] << 4));
+        pos += 3;
+
+        if (val0 < KYBER_Q) {
+            r[ctr++] = val0;
+        }
+        if (val1 < KYBER_Q && ctr < KYBER_N) {
+            r[ctr++] = val1;
+        }
+    }
+
+    return ctr;
+}
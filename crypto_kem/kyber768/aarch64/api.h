@@ -8,10 +8,16 @@
 #define PQCLEAN_KYBER768_AARCH64_CRYPTO_PUBLICKEYBYTES  1184
 #define PQCLEAN_KYBER768_AARCH64_CRYPTO_CIPHERTEXTBYTES 1088
 #define PQCLEAN_KYBER768_AARCH64_CRYPTO_BYTES           32
+#define PQCLEAN_KYBER768_AARCH64_CRYPTO_KEYPAIRCOINBYTES 64
+#define PQCLEAN_KYBER768_AARCH64_CRYPTO_ENCCOINBYTES     32
 #define PQCLEAN_KYBER768_AARCH64_CRYPTO_ALGNAME "Kyber768"
 
+int PQCLEAN_KYBER768_AARCH64_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins);
+
 int PQCLEAN_KYBER768_AARCH64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
 
+int PQCLEAN_KYBER768_AARCH64_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *coins);
+
 int PQCLEAN_KYBER768_AARCH64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 
 int PQCLEAN_KYBER768_AARCH64_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
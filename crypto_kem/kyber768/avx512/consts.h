@@ -0,0 +1,10 @@
+#ifndef PQCLEAN_KYBER768_AVX512_CONSTS_H
+#define PQCLEAN_KYBER768_AVX512_CONSTS_H
+#include "align.h"
+#include "cdecl.h"
+
+
+typedef ALIGNED_INT16(640) qdata_t;
+extern const qdata_t PQCLEAN_KYBER768_AVX512_qdata;
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef PQCLEAN_KYBER768_AVX512_FIPS202X8_H
+#define PQCLEAN_KYBER768_AVX512_FIPS202X8_H
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    __m512i s[25];
+} keccakx8_state;
+
+void PQCLEAN_KYBER768_AVX512_shake128x8_absorb_once(keccakx8_state *state,
+        const uint8_t *const in[8],
+        size_t inlen);
+
+void PQCLEAN_KYBER768_AVX512_shake128x8_squeezeblocks(uint8_t *const out[8],
+        size_t nblocks,
+        keccakx8_state *state);
+
+#endif
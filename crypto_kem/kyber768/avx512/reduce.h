@@ -0,0 +1,9 @@
+#ifndef PQCLEAN_KYBER768_AVX512_REDUCE_H
+#define PQCLEAN_KYBER768_AVX512_REDUCE_H
+#include "params.h"
+#include <immintrin.h>
+
+void PQCLEAN_KYBER768_AVX512_reduce_avx(__m256i *r, const __m256i *PQCLEAN_KYBER768_AVX512_qdata);
+void PQCLEAN_KYBER768_AVX512_tomont_avx(__m256i *r, const __m256i *PQCLEAN_KYBER768_AVX512_qdata);
+
+#endif
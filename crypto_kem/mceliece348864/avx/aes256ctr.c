@@ -6,8 +6,7 @@ void PQCLEAN_MCELIECE348864_AVX_aes256ctr(
     const uint8_t nonce[AESCTR_NONCEBYTES],
     const uint8_t key[AES256_KEYBYTES]) {
 
-    aes256ctx state;
-    aes256_ctr_keyexp(&state, key);
-    aes256_ctr(out, outlen, nonce, &state);
-    aes256_ctx_release(&state);
+    aes256ctx_inline state;
+    aes256_ctr_keyexp_inline(&state, key);
+    aes256_ctr_inline(out, outlen, nonce, &state);
 }
@@ -14,16 +14,17 @@
 #include <stdint.h>
 #include <string.h>
 
-int PQCLEAN_MCELIECE348864_AVX_crypto_kem_enc(
+static int kem_enc(
     uint8_t *c,
     uint8_t *key,
-    const uint8_t *pk
+    const uint8_t *pk,
+    uint8_t *seed
 ) {
     uint8_t two_e[ 1 + SYS_N / 8 ] = {2};
     uint8_t *e = two_e + 1;
     uint8_t one_ec[ 1 + SYS_N / 8 + (SYND_BYTES + 32) ] = {1};
 
-    PQCLEAN_MCELIECE348864_AVX_encrypt(c, e, pk);
+    PQCLEAN_MCELIECE348864_AVX_encrypt(c, e, pk, seed);
 
     crypto_hash_32b(c + SYND_BYTES, two_e, sizeof(two_e));
 
@@ -35,6 +36,26 @@ int PQCLEAN_MCELIECE348864_AVX_crypto_kem_enc(
     return 0;
 }
 
+int PQCLEAN_MCELIECE348864_AVX_crypto_kem_enc_derand(
+    uint8_t *c,
+    uint8_t *key,
+    const uint8_t *pk,
+    const uint8_t *coins
+) {
+    uint8_t seed[ 32 ];
+
+    memcpy(seed, coins, sizeof(seed));
+    return kem_enc(c, key, pk, seed);
+}
+
+int PQCLEAN_MCELIECE348864_AVX_crypto_kem_enc(
+    uint8_t *c,
+    uint8_t *key,
+    const uint8_t *pk
+) {
+    return kem_enc(c, key, pk, NULL);
+}
+
 int PQCLEAN_MCELIECE348864_AVX_crypto_kem_dec(
     uint8_t *key,
     const uint8_t *c,
@@ -80,10 +101,11 @@ int PQCLEAN_MCELIECE348864_AVX_crypto_kem_dec(
     return 0;
 }
 
-int PQCLEAN_MCELIECE348864_AVX_crypto_kem_keypair
+int PQCLEAN_MCELIECE348864_AVX_crypto_kem_keypair_derand
 (
     uint8_t *pk,
-    uint8_t *sk
+    uint8_t *sk,
+    const uint8_t *coins
 ) {
     int i;
     uint8_t seed[ 32 ];
@@ -95,7 +117,7 @@ int PQCLEAN_MCELIECE348864_AVX_crypto_kem_keypair
     gf irr[ SYS_T ]; // Goppa polynomial
     uint32_t perm[ 1 << GFBITS ]; // random permutation
 
-    randombytes(seed, sizeof(seed));
+    memcpy(seed, coins, sizeof(seed));
 
     while (1) {
         rp = r;
@@ -134,3 +156,13 @@ int PQCLEAN_MCELIECE348864_AVX_crypto_kem_keypair
     return 0;
 }
 
+int PQCLEAN_MCELIECE348864_AVX_crypto_kem_keypair
+(
+    uint8_t *pk,
+    uint8_t *sk
+) {
+    uint8_t seed[ 32 ];
+
+    randombytes(seed, sizeof(seed));
+    return PQCLEAN_MCELIECE348864_AVX_crypto_kem_keypair_derand(pk, sk, seed);
+}
@@ -4,6 +4,7 @@
 
 #include "encrypt.h"
 
+#include "aes256ctr.h"
 #include "params.h"
 #include "randombytes.h"
 #include "util.h"
@@ -24,8 +25,24 @@ static inline uint8_t same_mask(uint16_t x, uint16_t y) {
     return (uint8_t)mask;
 }
 
+/* output of the system RNG, or of AES-256-CTR under seed when seed is */
+/* not NULL; seed is then replaced so that a retry gets fresh bytes   */
+static void gen_e_randombytes(uint8_t *out, size_t outlen, unsigned char *seed) {
+    const uint8_t nonce[ 16 ] = {0};
+    uint8_t r[ SYS_T * 4 + 32 ];
+
+    if (seed == NULL) {
+        randombytes(out, outlen);
+        return;
+    }
+
+    PQCLEAN_MCELIECE348864_CLEAN_aes256ctr(r, outlen + 32, nonce, seed);
+    memcpy(out, r, outlen);
+    memcpy(seed, r + outlen, 32);
+}
+
 /* output: e, an error vector of weight t */
-static void gen_e(unsigned char *e) {
+static void gen_e(unsigned char *e, unsigned char *seed) {
     size_t i, j;
     int eq, count;
 
@@ -36,7 +53,7 @@ static void gen_e(unsigned char *e) {
     unsigned char val[ SYS_T ];
 
     while (1) {
-        randombytes(ind_8, sizeof(ind_));
+        gen_e_randombytes(ind_8, sizeof(ind_), seed);
         // Copy to uint16_t ind_ in a little-endian way
         for (i = 0; i < sizeof(ind_); i += 2) {
             ind_[i / 2] = ((uint16_t)ind_8[i + 1]) << 8 | (uint16_t)ind_8[i];
@@ -130,8 +147,8 @@ static void syndrome(unsigned char *s, const unsigned char *pk, const unsigned c
     }
 }
 
-void PQCLEAN_MCELIECE348864_CLEAN_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk) {
-    gen_e(e);
+void PQCLEAN_MCELIECE348864_CLEAN_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk, unsigned char *seed) {
+    gen_e(e, seed);
 
     syndrome(s, pk, e);
 }
@@ -4,6 +4,7 @@
 
 #include "encrypt.h"
 
+#include "aes256ctr.h"
 #include "gf.h"
 #include "params.h"
 #include "randombytes.h"
@@ -18,8 +19,24 @@
 /* output: syndrome s */
 extern void PQCLEAN_MCELIECE348864_SSE_syndrome_asm(unsigned char *s, const unsigned char *pk, unsigned char *e);
 
+/* output of the system RNG, or of AES-256-CTR under seed when seed is */
+/* not NULL; seed is then replaced so that a retry gets fresh bytes   */
+static void gen_e_randombytes(uint8_t *out, size_t outlen, unsigned char *seed) {
+    const uint8_t nonce[ 16 ] = {0};
+    uint8_t r[ SYS_T * 4 + 32 ];
+
+    if (seed == NULL) {
+        randombytes(out, outlen);
+        return;
+    }
+
+    PQCLEAN_MCELIECE348864_SSE_aes256ctr(r, outlen + 32, nonce, seed);
+    memcpy(out, r, outlen);
+    memcpy(seed, r + outlen, 32);
+}
+
 /* output: e, an error vector of weight t */
-static void gen_e(unsigned char *e) {
+static void gen_e(unsigned char *e, unsigned char *seed) {
     size_t i, j;
     int eq, count;
 
@@ -31,7 +48,7 @@ static void gen_e(unsigned char *e) {
     uint64_t val[ SYS_T ];
 
     while (1) {
-        randombytes((uint8_t *)ind_, sizeof(ind_));
+        gen_e_randombytes((uint8_t *)ind_, sizeof(ind_), seed);
 
         for (i = 0; i < SYS_T * 2; i++) {
             ind_[i] &= GFMASK;
@@ -92,8 +109,8 @@ static void gen_e(unsigned char *e) {
     }
 }
 
-void PQCLEAN_MCELIECE348864_SSE_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk) {
-    gen_e(e);
+void PQCLEAN_MCELIECE348864_SSE_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk, unsigned char *seed) {
+    gen_e(e, seed);
     PQCLEAN_MCELIECE348864_SSE_syndrome_asm(s, pk, e);
 }
 
@@ -4,6 +4,7 @@
 
 #include "encrypt.h"
 
+#include "aes256ctr.h"
 #include "gf.h"
 #include "params.h"
 #include "randombytes.h"
@@ -12,8 +13,24 @@
 #include <stdint.h>
 #include <string.h>
 
+/* output of the system RNG, or of AES-256-CTR under seed when seed is */
+/* not NULL; seed is then replaced so that a retry gets fresh bytes   */
+static void gen_e_randombytes(uint8_t *out, size_t outlen, unsigned char *seed) {
+    const uint8_t nonce[ 16 ] = {0};
+    uint8_t r[ SYS_T * 4 + 32 ];
+
+    if (seed == NULL) {
+        randombytes(out, outlen);
+        return;
+    }
+
+    PQCLEAN_MCELIECE348864_VEC_aes256ctr(r, outlen + 32, nonce, seed);
+    memcpy(out, r, outlen);
+    memcpy(seed, r + outlen, 32);
+}
+
 /* output: e, an error vector of weight t */
-static void gen_e(unsigned char *e) {
+static void gen_e(unsigned char *e, unsigned char *seed) {
     size_t i, j;
     int eq, count;
 
@@ -26,7 +43,7 @@ static void gen_e(unsigned char *e) {
     uint64_t val[ SYS_T ];
 
     while (1) {
-        randombytes(ind_8, sizeof(ind_));
+        gen_e_randombytes(ind_8, sizeof(ind_), seed);
         for (i = 0; i < sizeof(ind_); i += 2) {
             ind_[i / 2] = (uint16_t)ind_8[i + 1] << 8 | ind_8[i];
         }
@@ -128,8 +145,8 @@ static void syndrome(unsigned char *s, const unsigned char *pk, const unsigned c
     }
 }
 
-void PQCLEAN_MCELIECE348864_VEC_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk) {
-    gen_e(e);
+void PQCLEAN_MCELIECE348864_VEC_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk, unsigned char *seed) {
+    gen_e(e, seed);
     syndrome(s, pk, e);
 }
 
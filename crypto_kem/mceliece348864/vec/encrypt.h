@@ -5,7 +5,7 @@
 */
 
 
-void PQCLEAN_MCELIECE348864_VEC_encrypt(unsigned char * /*s*/, unsigned char * /*e*/, const unsigned char * /*pk*/);
+void PQCLEAN_MCELIECE348864_VEC_encrypt(unsigned char * /*s*/, unsigned char * /*e*/, const unsigned char * /*pk*/, unsigned char * /*seed*/);
 
 #endif
 
@@ -8,6 +8,8 @@
 #define PQCLEAN_MCELIECE348864F_VEC_CRYPTO_SECRETKEYBYTES 6452
 #define PQCLEAN_MCELIECE348864F_VEC_CRYPTO_CIPHERTEXTBYTES 128
 #define PQCLEAN_MCELIECE348864F_VEC_CRYPTO_BYTES 32
+#define PQCLEAN_MCELIECE348864F_VEC_CRYPTO_KEYPAIRCOINBYTES 32
+#define PQCLEAN_MCELIECE348864F_VEC_CRYPTO_ENCCOINBYTES 32
 
 
 
@@ -17,6 +19,13 @@ int PQCLEAN_MCELIECE348864F_VEC_crypto_kem_enc(
     const uint8_t *pk
 );
 
+int PQCLEAN_MCELIECE348864F_VEC_crypto_kem_enc_derand(
+    uint8_t *c,
+    uint8_t *key,
+    const uint8_t *pk,
+    const uint8_t *coins
+);
+
 int PQCLEAN_MCELIECE348864F_VEC_crypto_kem_dec(
     uint8_t *key,
     const uint8_t *c,
@@ -29,5 +38,12 @@ int PQCLEAN_MCELIECE348864F_VEC_crypto_kem_keypair
     uint8_t *sk
 );
 
+int PQCLEAN_MCELIECE348864F_VEC_crypto_kem_keypair_derand
+(
+    uint8_t *pk,
+    uint8_t *sk,
+    const uint8_t *coins
+);
+
 #endif
 
@@ -8,6 +8,8 @@
 #define PQCLEAN_MCELIECE460896_CLEAN_CRYPTO_SECRETKEYBYTES 13568
 #define PQCLEAN_MCELIECE460896_CLEAN_CRYPTO_CIPHERTEXTBYTES 188
 #define PQCLEAN_MCELIECE460896_CLEAN_CRYPTO_BYTES 32
+#define PQCLEAN_MCELIECE460896_CLEAN_CRYPTO_KEYPAIRCOINBYTES 32
+#define PQCLEAN_MCELIECE460896_CLEAN_CRYPTO_ENCCOINBYTES 32
 
 int PQCLEAN_MCELIECE460896_CLEAN_crypto_kem_enc(
     uint8_t *c,
@@ -15,6 +17,13 @@ int PQCLEAN_MCELIECE460896_CLEAN_crypto_kem_enc(
     const uint8_t *pk
 );
 
+int PQCLEAN_MCELIECE460896_CLEAN_crypto_kem_enc_derand(
+    uint8_t *c,
+    uint8_t *key,
+    const uint8_t *pk,
+    const uint8_t *coins
+);
+
 int PQCLEAN_MCELIECE460896_CLEAN_crypto_kem_dec(
     uint8_t *key,
     const uint8_t *c,
@@ -27,5 +36,12 @@ int PQCLEAN_MCELIECE460896_CLEAN_crypto_kem_keypair
     uint8_t *sk
 );
 
+int PQCLEAN_MCELIECE460896_CLEAN_crypto_kem_keypair_derand
+(
+    uint8_t *pk,
+    uint8_t *sk,
+    const uint8_t *coins
+);
+
 #endif
 
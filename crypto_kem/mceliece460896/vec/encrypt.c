@@ -4,6 +4,7 @@
 
 #include "encrypt.h"
 
+#include "aes256ctr.h"
 #include "params.h"
 #include "randombytes.h"
 #include "util.h"
@@ -15,8 +16,24 @@
 
 #include "gf.h"
 
+/* output of the system RNG, or of AES-256-CTR under seed when seed is */
+/* not NULL; seed is then replaced so that a retry gets fresh bytes   */
+static void gen_e_randombytes(uint8_t *out, size_t outlen, unsigned char *seed) {
+    const uint8_t nonce[ 16 ] = {0};
+    uint8_t r[ SYS_T * 4 + 32 ];
+
+    if (seed == NULL) {
+        randombytes(out, outlen);
+        return;
+    }
+
+    PQCLEAN_MCELIECE460896_VEC_aes256ctr(r, outlen + 32, nonce, seed);
+    memcpy(out, r, outlen);
+    memcpy(seed, r + outlen, 32);
+}
+
 /* output: e, an error vector of weight t */
-static void gen_e(unsigned char *e) {
+static void gen_e(unsigned char *e, unsigned char *seed) {
     size_t i, j;
     int eq, count;
 
@@ -29,7 +46,7 @@ static void gen_e(unsigned char *e) {
     uint64_t val[ SYS_T ];
 
     while (1) {
-        randombytes(ind8, sizeof(ind));
+        gen_e_randombytes(ind8, sizeof(ind), seed);
         for (i = 0; i < sizeof(ind); i += 2) {
             ind[i / 2] = (uint16_t)ind8[i + 1] << 8 | ind8[i];
         }
@@ -131,8 +148,8 @@ static void syndrome(unsigned char *s, const unsigned char *pk, const unsigned c
 
 /* input: public key pk */
 /* output: error vector e, syndrome s */
-void PQCLEAN_MCELIECE460896_VEC_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk) {
-    gen_e(e);
+void PQCLEAN_MCELIECE460896_VEC_encrypt(unsigned char *s, unsigned char *e, const unsigned char *pk, unsigned char *seed) {
+    gen_e(e, seed);
     syndrome(s, pk, e);
 }
 
@@ -8,6 +8,8 @@
 #define PQCLEAN_MCELIECE6960119F_AVX_CRYPTO_SECRETKEYBYTES 13908
 #define PQCLEAN_MCELIECE6960119F_AVX_CRYPTO_CIPHERTEXTBYTES 226
 #define PQCLEAN_MCELIECE6960119F_AVX_CRYPTO_BYTES 32
+#define PQCLEAN_MCELIECE6960119F_AVX_CRYPTO_KEYPAIRCOINBYTES 32
+#define PQCLEAN_MCELIECE6960119F_AVX_CRYPTO_ENCCOINBYTES 32
 
 
 int PQCLEAN_MCELIECE6960119F_AVX_crypto_kem_enc(
@@ -16,6 +18,13 @@ int PQCLEAN_MCELIECE6960119F_AVX_crypto_kem_enc(
     const uint8_t *pk
 );
 
+int PQCLEAN_MCELIECE6960119F_AVX_crypto_kem_enc_derand(
+    uint8_t *c,
+    uint8_t *key,
+    const uint8_t *pk,
+    const uint8_t *coins
+);
+
 int PQCLEAN_MCELIECE6960119F_AVX_crypto_kem_dec(
     uint8_t *key,
     const uint8_t *c,
@@ -28,4 +37,11 @@ int PQCLEAN_MCELIECE6960119F_AVX_crypto_kem_keypair
     uint8_t *sk
 );
 
+int PQCLEAN_MCELIECE6960119F_AVX_crypto_kem_keypair_derand
+(
+    uint8_t *pk,
+    uint8_t *sk,
+    const uint8_t *coins
+);
+
 #endif
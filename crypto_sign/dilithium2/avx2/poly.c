@@ -646,12 +646,12 @@ void PQCLEAN_DILITHIUM2_AVX2_poly_challenge(poly *restrict c, const uint8_t seed
     unsigned int i, b, pos;
     uint64_t signs;
     ALIGNED_UINT8(SHAKE256_RATE) buf;
-    shake256incctx state;
+    shake256incctx_inline state;
 
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, seed, SEEDBYTES);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(buf.coeffs, SHAKE256_RATE, &state);
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, seed, SEEDBYTES);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(buf.coeffs, SHAKE256_RATE, &state);
 
     memcpy(&signs, buf.coeffs, 8);
     pos = 8;
@@ -660,7 +660,7 @@ void PQCLEAN_DILITHIUM2_AVX2_poly_challenge(poly *restrict c, const uint8_t seed
     for (i = N - TAU; i < N; ++i) {
         do {
             if (pos >= SHAKE256_RATE) {
-                shake256_inc_squeeze(buf.coeffs, SHAKE256_RATE, &state);
+                shake256_inc_squeeze_inline(buf.coeffs, SHAKE256_RATE, &state);
                 pos = 0;
             }
 
@@ -671,7 +671,6 @@ void PQCLEAN_DILITHIUM2_AVX2_poly_challenge(poly *restrict c, const uint8_t seed
         c->coeffs[b] = 1 - 2 * (signs & 1);
         signs >>= 1;
     }
-    shake256_inc_ctx_release(&state);
 }
 
 /*************************************************
@@ -1010,3 +1009,26 @@ void PQCLEAN_DILITHIUM2_AVX2_polyw1_pack(uint8_t *r, const poly *restrict a) {
 
     DBENCH_STOP(*tpack);
 }
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM2_AVX2_polyw1_unpack
+*
+* Description: Unpack polynomial w1 with coefficients in [0,15] or [0,43].
+*              Inverse of PQCLEAN_DILITHIUM2_AVX2_polyw1_pack.
+*
+* Arguments:   - poly *r: pointer to output polynomial
+*              - const uint8_t *a: byte array with bit-packed polynomial
+**************************************************/
+void PQCLEAN_DILITHIUM2_AVX2_polyw1_unpack(poly *r, const uint8_t *a) {
+    unsigned int i;
+    DBENCH_START();
+
+    for (i = 0; i < N / 4; ++i) {
+        r->coeffs[4 * i + 0] = a[3 * i + 0] & 0x3F;
+        r->coeffs[4 * i + 1] = ((a[3 * i + 0] >> 6) | (a[3 * i + 1] << 2)) & 0x3F;
+        r->coeffs[4 * i + 2] = ((a[3 * i + 1] >> 4) | (a[3 * i + 2] << 4)) & 0x3F;
+        r->coeffs[4 * i + 3] = a[3 * i + 2] >> 2;
+    }
+
+    DBENCH_STOP(*tpack);
+}
@@ -3,24 +3,24 @@
 #include "symmetric.h"
 #include <stdint.h>
 
-void PQCLEAN_DILITHIUM2_AVX2_dilithium_shake128_stream_init(shake128incctx *state, const uint8_t seed[SEEDBYTES], uint16_t nonce) {
+void PQCLEAN_DILITHIUM2_AVX2_dilithium_shake128_stream_init(shake128incctx_inline *state, const uint8_t seed[SEEDBYTES], uint16_t nonce) {
     uint8_t t[2];
     t[0] = (uint8_t) nonce;
     t[1] = (uint8_t) (nonce >> 8);
 
-    shake128_inc_init(state);
-    shake128_inc_absorb(state, seed, SEEDBYTES);
-    shake128_inc_absorb(state, t, 2);
-    shake128_inc_finalize(state);
+    shake128_inc_init_inline(state);
+    shake128_inc_absorb_inline(state, seed, SEEDBYTES);
+    shake128_inc_absorb_inline(state, t, 2);
+    shake128_inc_finalize_inline(state);
 }
 
-void PQCLEAN_DILITHIUM2_AVX2_dilithium_shake256_stream_init(shake256incctx *state, const uint8_t seed[CRHBYTES], uint16_t nonce) {
+void PQCLEAN_DILITHIUM2_AVX2_dilithium_shake256_stream_init(shake256incctx_inline *state, const uint8_t seed[CRHBYTES], uint16_t nonce) {
     uint8_t t[2];
     t[0] = (uint8_t) nonce;
     t[1] = (uint8_t) (nonce >> 8);
 
-    shake256_inc_init(state);
-    shake256_inc_absorb(state, seed, CRHBYTES);
-    shake256_inc_absorb(state, t, 2);
-    shake256_inc_finalize(state);
+    shake256_inc_init_inline(state);
+    shake256_inc_absorb_inline(state, seed, CRHBYTES);
+    shake256_inc_absorb_inline(state, t, 2);
+    shake256_inc_finalize_inline(state);
 }
@@ -10,10 +10,34 @@ void PQCLEAN_DILITHIUM2_CLEAN_challenge(poly *c, const uint8_t seed[SEEDBYTES]);
 
 int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_derand(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *sk, const uint8_t *coins);
+
 int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature(uint8_t *sig, size_t *siglen,
         const uint8_t *m, size_t mlen,
         const uint8_t *sk);
 
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_batch(uint8_t *const *sig, size_t *siglen,
+        const uint8_t *const *m, const size_t *mlen,
+        const uint8_t *sk, size_t n);
+
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_sk_expand(uint8_t *esk, const uint8_t *sk);
+
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_expanded_derand(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk, const uint8_t *coins);
+
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk);
+
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_precompute(uint8_t *pool, size_t npre, const uint8_t *esk);
+
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_signature_precomputed(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk, uint8_t *pool, size_t *npool);
+
 int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign(uint8_t *sm, size_t *smlen,
         const uint8_t *m, size_t mlen,
         const uint8_t *sk);
@@ -22,6 +46,17 @@ int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_verify(const uint8_t *sig, size_t sigle
         const uint8_t *m, size_t mlen,
         const uint8_t *pk);
 
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_pk_expand(uint8_t *epk, const uint8_t *pk);
+
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *epk);
+
+int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_verify_batch(int *results,
+        const uint8_t *const *sig, const size_t *siglen,
+        const uint8_t *const *m, const size_t *mlen,
+        const uint8_t *const *pk, size_t n);
+
 int PQCLEAN_DILITHIUM2_CLEAN_crypto_sign_open(uint8_t *m, size_t *mlen,
         const uint8_t *sm, size_t smlen,
         const uint8_t *pk);
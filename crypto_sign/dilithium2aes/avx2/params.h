@@ -10,6 +10,11 @@
 #define D 13
 #define ROOT_OF_UNITY 1753
 
+/* Signatures processed together by crypto_sign_verify_batch */
+#define VERIFY_BATCH 8
+/* Messages signed together by crypto_sign_signature_batch */
+#define SIGN_BATCH 4
+
 #define K 4
 #define L 4
 #define ETA 2
@@ -37,5 +42,8 @@
         + K*POLYETA_PACKEDBYTES \
         + K*POLYT0_PACKEDBYTES)
 #define PQCLEAN_DILITHIUM2AES_AVX2_CRYPTO_BYTES (SEEDBYTES + L*POLYZ_PACKEDBYTES + POLYVECH_PACKEDBYTES)
+#define PQCLEAN_DILITHIUM2AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES (2*SEEDBYTES + (K*L + L + 2*K)*N*4)
+#define PQCLEAN_DILITHIUM2AES_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES (SEEDBYTES + (K*L + K)*N*4)
+#define PQCLEAN_DILITHIUM2AES_AVX2_CRYPTO_PRECOMPUTEDBYTES ((L + K)*POLYZ_PACKEDBYTES + K*POLYW1_PACKEDBYTES + SEEDBYTES)
 
 #endif
@@ -48,4 +48,6 @@ void PQCLEAN_DILITHIUM2AES_AVX2_polyz_unpack(poly *r, const uint8_t *a);
 
 void PQCLEAN_DILITHIUM2AES_AVX2_polyw1_pack(uint8_t *r, const poly *a);
 
+void PQCLEAN_DILITHIUM2AES_AVX2_polyw1_unpack(poly *r, const uint8_t *a);
+
 #endif
@@ -566,12 +566,12 @@ void poly_challenge(poly *c, const uint8_t seed[SEEDBYTES]) {
     unsigned int i, b, pos;
     uint64_t signs;
     uint8_t buf[SHAKE256_RATE];
-    shake256incctx state;
+    shake256incctx_inline state;
 
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, seed, SEEDBYTES);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(buf, sizeof buf, &state);
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, seed, SEEDBYTES);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(buf, sizeof buf, &state);
 
     signs = 0;
     for (i = 0; i < 8; ++i) {
@@ -585,7 +585,7 @@ void poly_challenge(poly *c, const uint8_t seed[SEEDBYTES]) {
     for (i = N - TAU; i < N; ++i) {
         do {
             if (pos >= SHAKE256_RATE) {
-                shake256_inc_squeeze(buf, sizeof buf, &state);
+                shake256_inc_squeeze_inline(buf, sizeof buf, &state);
                 pos = 0;
             }
 
@@ -596,7 +596,6 @@ void poly_challenge(poly *c, const uint8_t seed[SEEDBYTES]) {
         c->coeffs[b] = 1 - 2 * (signs & 1);
         signs >>= 1;
     }
-    shake256_inc_ctx_release(&state);
 }
 
 /*************************************************
@@ -7,6 +7,7 @@
 #include "sign.h"
 #include "symmetric.h"
 #include <stdint.h>
+#include <string.h>
 
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_keypair
@@ -64,116 +65,904 @@ int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
     return 0;
 }
 
+/*************************************************
+* Name:        pack_poly_ntt
+*
+* Description: Store a polynomial with coefficients in (-Q, Q) as
+*              N 32-bit little-endian words.
+*
+* Arguments:   - uint8_t *r: pointer to output byte array (4*N bytes)
+*              - const poly *a: pointer to input polynomial
+**************************************************/
+static void pack_poly_ntt(uint8_t r[4 * N], const poly *a) {
+    unsigned int i;
+
+    for (i = 0; i < N; ++i) {
+        r[4 * i + 0] = (uint8_t)((uint32_t)a->coeffs[i] >> 0);
+        r[4 * i + 1] = (uint8_t)((uint32_t)a->coeffs[i] >> 8);
+        r[4 * i + 2] = (uint8_t)((uint32_t)a->coeffs[i] >> 16);
+        r[4 * i + 3] = (uint8_t)((uint32_t)a->coeffs[i] >> 24);
+    }
+}
+
+/*************************************************
+* Name:        unpack_poly_ntt
+*
+* Description: Inverse of pack_poly_ntt.
+*
+* Arguments:   - poly *r: pointer to output polynomial
+*              - const uint8_t *a: pointer to input byte array (4*N bytes)
+**************************************************/
+static void unpack_poly_ntt(poly *r, const uint8_t a[4 * N]) {
+    unsigned int i;
+
+    for (i = 0; i < N; ++i) {
+        r->coeffs[i] = (int32_t)((uint32_t)a[4 * i + 0]
+                                 | ((uint32_t)a[4 * i + 1] << 8)
+                                 | ((uint32_t)a[4 * i + 2] << 16)
+                                 | ((uint32_t)a[4 * i + 3] << 24));
+    }
+}
+
+/*************************************************
+* Name:        pack_expanded_sk
+*
+* Description: Store the NTT-domain matrix A and secret vectors s1, s2, t0,
+*              followed by tr and the signing seed, in an expanded secret key.
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*              - remaining arguments: components of the expanded key
+**************************************************/
+static void pack_expanded_sk(uint8_t esk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES],
+                             const uint8_t tr[SEEDBYTES],
+                             const uint8_t key[SEEDBYTES],
+                             const polyvecl mat[K],
+                             const polyvecl *s1,
+                             const polyveck *s2,
+                             const polyveck *t0) {
+    unsigned int i, j;
+
+    for (i = 0; i < K; ++i) {
+        for (j = 0; j < L; ++j) {
+            pack_poly_ntt(esk, &mat[i].vec[j]);
+            esk += 4 * N;
+        }
+    }
+    for (i = 0; i < L; ++i) {
+        pack_poly_ntt(esk, &s1->vec[i]);
+        esk += 4 * N;
+    }
+    for (i = 0; i < K; ++i) {
+        pack_poly_ntt(esk, &s2->vec[i]);
+        esk += 4 * N;
+    }
+    for (i = 0; i < K; ++i) {
+        pack_poly_ntt(esk, &t0->vec[i]);
+        esk += 4 * N;
+    }
+    for (i = 0; i < SEEDBYTES; ++i) {
+        esk[i] = tr[i];
+        esk[SEEDBYTES + i] = key[i];
+    }
+}
+
+/*************************************************
+* Name:        unpack_expanded_sk_matrix
+*
+* Description: Unpack only the matrix A from an expanded secret key.
+*
+* Arguments:   - polyvecl mat: output matrix A
+*              - const uint8_t *esk: pointer to input expanded secret key
+**************************************************/
+static void unpack_expanded_sk_matrix(polyvecl mat[K],
+                                      const uint8_t esk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES]) {
+    unsigned int i, j;
+
+    for (i = 0; i < K; ++i) {
+        for (j = 0; j < L; ++j) {
+            unpack_poly_ntt(&mat[i].vec[j], esk);
+            esk += 4 * N;
+        }
+    }
+}
+
+/*************************************************
+* Name:        unpack_expanded_sk_vectors
+*
+* Description: Unpack tr and the secret vectors s1, s2, t0 from an expanded
+*              secret key, skipping the matrix A.
+*
+* Arguments:   - remaining arguments: components of the expanded key
+*              - const uint8_t *esk: pointer to input expanded secret key
+**************************************************/
+static void unpack_expanded_sk_vectors(uint8_t tr[SEEDBYTES],
+                                       polyvecl *s1,
+                                       polyveck *s2,
+                                       polyveck *t0,
+                                       const uint8_t esk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES]) {
+    unsigned int i;
+
+    esk += K * L * 4 * N;
+    for (i = 0; i < L; ++i) {
+        unpack_poly_ntt(&s1->vec[i], esk);
+        esk += 4 * N;
+    }
+    for (i = 0; i < K; ++i) {
+        unpack_poly_ntt(&s2->vec[i], esk);
+        esk += 4 * N;
+    }
+    for (i = 0; i < K; ++i) {
+        unpack_poly_ntt(&t0->vec[i], esk);
+        esk += 4 * N;
+    }
+    for (i = 0; i < SEEDBYTES; ++i) {
+        tr[i] = esk[i];
+    }
+}
+
+/*************************************************
+* Name:        unpack_expanded_sk
+*
+* Description: Inverse of pack_expanded_sk.
+*
+* Arguments:   - remaining arguments: components of the expanded key
+*              - const uint8_t *esk: pointer to input expanded secret key
+**************************************************/
+static void unpack_expanded_sk(uint8_t tr[SEEDBYTES],
+                               uint8_t key[SEEDBYTES],
+                               polyvecl mat[K],
+                               polyvecl *s1,
+                               polyveck *s2,
+                               polyveck *t0,
+                               const uint8_t esk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES]) {
+    unsigned int i;
+
+    unpack_expanded_sk_matrix(mat, esk);
+    unpack_expanded_sk_vectors(tr, s1, s2, t0, esk);
+    esk += PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES - SEEDBYTES;
+    for (i = 0; i < SEEDBYTES; ++i) {
+        key[i] = esk[i];
+    }
+}
+
+/*************************************************
+* Name:        pack_precomputed
+*
+* Description: Store a precomputed commitment: y and w0 packed like z in
+*              a signature, w1 packed like the challenge input, and tr of
+*              the key the commitment was computed under.
+*
+* Arguments:   - uint8_t *pre: pointer to output byte array
+*                              (PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES bytes)
+*              - const uint8_t *tr: pointer to tr of the signing key
+*              - const polyvecl *y: pointer to masking vector
+*              - const polyveck *w0, *w1: pointers to low and high bits of Ay
+**************************************************/
+static void pack_precomputed(uint8_t pre[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES],
+                             const uint8_t tr[SEEDBYTES],
+                             const polyvecl *y,
+                             const polyveck *w0,
+                             const polyveck *w1) {
+    unsigned int i;
+
+    for (i = 0; i < L; ++i) {
+        PQCLEAN_DILITHIUM3_CLEAN_polyz_pack(pre, &y->vec[i]);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3_CLEAN_polyz_pack(pre, &w0->vec[i]);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3_CLEAN_polyw1_pack(pre, &w1->vec[i]);
+        pre += POLYW1_PACKEDBYTES;
+    }
+    for (i = 0; i < SEEDBYTES; ++i) {
+        pre[i] = tr[i];
+    }
+}
+
+/*************************************************
+* Name:        unpack_precomputed
+*
+* Description: Inverse of pack_precomputed, except for tr.
+*
+* Arguments:   - polyvecl *y: pointer to output masking vector
+*              - polyveck *w0, *w1: pointers to output low and high bits of Ay
+*              - const uint8_t *pre: pointer to input byte array
+**************************************************/
+static void unpack_precomputed(polyvecl *y,
+                               polyveck *w0,
+                               polyveck *w1,
+                               const uint8_t pre[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES]) {
+    unsigned int i;
+
+    for (i = 0; i < L; ++i) {
+        PQCLEAN_DILITHIUM3_CLEAN_polyz_unpack(&y->vec[i], pre);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3_CLEAN_polyz_unpack(&w0->vec[i], pre);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3_CLEAN_polyw1_unpack(&w1->vec[i], pre);
+        pre += POLYW1_PACKEDBYTES;
+    }
+}
+
+/*************************************************
+* Name:        pack_expanded_pk
+*
+* Description: Store the NTT-domain matrix A and t1*2^D, followed by
+*              tr = H(pk), in an expanded public key.
+*
+* Arguments:   - uint8_t *epk: pointer to output expanded public key
+*              - remaining arguments: components of the expanded key
+**************************************************/
+static void pack_expanded_pk(uint8_t epk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDPUBLICKEYBYTES],
+                             const uint8_t tr[SEEDBYTES],
+                             const polyvecl mat[K],
+                             const polyveck *t1) {
+    unsigned int i, j;
+
+    for (i = 0; i < K; ++i) {
+        for (j = 0; j < L; ++j) {
+            pack_poly_ntt(epk, &mat[i].vec[j]);
+            epk += 4 * N;
+        }
+    }
+    for (i = 0; i < K; ++i) {
+        pack_poly_ntt(epk, &t1->vec[i]);
+        epk += 4 * N;
+    }
+    for (i = 0; i < SEEDBYTES; ++i) {
+        epk[i] = tr[i];
+    }
+}
+
+/*************************************************
+* Name:        unpack_expanded_pk
+*
+* Description: Inverse of pack_expanded_pk.
+*
+* Arguments:   - remaining arguments: components of the expanded key
+*              - const uint8_t *epk: pointer to input expanded public key
+**************************************************/
+static void unpack_expanded_pk(uint8_t tr[SEEDBYTES],
+                               polyvecl mat[K],
+                               polyveck *t1,
+                               const uint8_t epk[PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDPUBLICKEYBYTES]) {
+    unsigned int i, j;
+
+    for (i = 0; i < K; ++i) {
+        for (j = 0; j < L; ++j) {
+            unpack_poly_ntt(&mat[i].vec[j], epk);
+            epk += 4 * N;
+        }
+    }
+    for (i = 0; i < K; ++i) {
+        unpack_poly_ntt(&t1->vec[i], epk);
+        epk += 4 * N;
+    }
+    for (i = 0; i < SEEDBYTES; ++i) {
+        tr[i] = epk[i];
+    }
+}
+
+/*************************************************
+* Name:        sign_commit
+*
+* Description: Message-independent part of a signing attempt: samples the
+*              masking vector y and computes the high and low bits w1, w0
+*              of w = Ay.
+*
+* Arguments:   - polyvecl *y: pointer to output masking vector
+*              - polyveck *w0: pointer to output low bits of w
+*              - polyveck *w1: pointer to output high bits of w
+*              - const polyvecl mat: expanded matrix A
+*              - const uint8_t *rhoprime: pointer to masking seed
+*              - uint16_t nonce: nonce for sampling y
+**************************************************/
+static void sign_commit(polyvecl *y,
+                        polyveck *w0,
+                        polyveck *w1,
+                        const polyvecl mat[K],
+                        const uint8_t rhoprime[CRHBYTES],
+                        uint16_t nonce) {
+    polyvecl z;
+
+    /* Sample intermediate vector y */
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_uniform_gamma1(y, rhoprime, nonce);
+
+    /* Matrix-vector multiplication */
+    z = *y;
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&z);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_pointwise_montgomery(w1, mat, &z);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(w1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(w1);
+
+    /* Decompose w */
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_caddq(w1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_decompose(w1, w0, w1);
+}
+
+/*************************************************
+* Name:        sign_finish
+*
+* Description: Completes a signing attempt whose challenge seed c~ has
+*              already been written to the start of sig: computes
+*              z = y + cs1 and the hints, and writes the rest of the
+*              signature unless a norm check rejects.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature starting with c~
+*              - const polyvecl *y: pointer to masking vector
+*              - polyveck *w0: pointer to low bits of w; overwritten
+*              - const polyveck *w1: pointer to high bits of w
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+*
+* Returns 0 if the signature was written and -1 if the attempt is rejected
+**************************************************/
+static int sign_finish(uint8_t *sig,
+                       const polyvecl *y,
+                       polyveck *w0,
+                       const polyveck *w1,
+                       const polyvecl *s1,
+                       const polyveck *s2,
+                       const polyveck *t0) {
+    unsigned int n;
+    polyvecl z;
+    polyveck h;
+    poly cp;
+
+    PQCLEAN_DILITHIUM3_CLEAN_poly_challenge(&cp, sig);
+    PQCLEAN_DILITHIUM3_CLEAN_poly_ntt(&cp);
+
+    /* Compute z, reject if it reveals secret */
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_pointwise_poly_montgomery(&z, &cp, s1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_invntt_tomont(&z);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_add(&z, &z, y);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_reduce(&z);
+    if (PQCLEAN_DILITHIUM3_CLEAN_polyvecl_chknorm(&z, GAMMA1 - BETA)) {
+        return -1;
+    }
+
+    /* Check that subtracting cs2 does not change high bits of w and low bits
+     * do not reveal secret information */
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pointwise_poly_montgomery(&h, &cp, s2);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(&h);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_sub(w0, w0, &h);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(w0);
+    if (PQCLEAN_DILITHIUM3_CLEAN_polyveck_chknorm(w0, GAMMA2 - BETA)) {
+        return -1;
+    }
+
+    /* Compute hints for w1 */
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pointwise_poly_montgomery(&h, &cp, t0);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(&h);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(&h);
+    if (PQCLEAN_DILITHIUM3_CLEAN_polyveck_chknorm(&h, GAMMA2)) {
+        return -1;
+    }
+
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_add(w0, w0, &h);
+    n = PQCLEAN_DILITHIUM3_CLEAN_polyveck_make_hint(&h, w0, w1);
+    if (n > OMEGA) {
+        return -1;
+    }
+
+    /* Write signature */
+    PQCLEAN_DILITHIUM3_CLEAN_pack_sig(sig, sig, &z, &h);
+    return 0;
+}
+
+/*************************************************
+* Name:        sign_respond
+*
+* Description: Message-dependent part of a signing attempt: derives the
+*              challenge from mu and w1, computes z = y + cs1 and the hints,
+*              and writes the signature unless a norm check rejects.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature
+*              - const uint8_t *mu: pointer to CRH(tr, msg)
+*              - const polyvecl *y: pointer to masking vector
+*              - polyveck *w0: pointer to low bits of w; overwritten
+*              - const polyveck *w1: pointer to high bits of w
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+*
+* Returns 0 if the signature was written and -1 if the attempt is rejected
+**************************************************/
+static int sign_respond(uint8_t *sig,
+                        const uint8_t mu[CRHBYTES],
+                        const polyvecl *y,
+                        polyveck *w0,
+                        const polyveck *w1,
+                        const polyvecl *s1,
+                        const polyveck *s2,
+                        const polyveck *t0) {
+    shake256incctx_inline state;
+
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pack_w1(sig, w1);
+
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, mu, CRHBYTES);
+    shake256_inc_absorb_inline(&state, sig, K * POLYW1_PACKEDBYTES);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(sig, SEEDBYTES, &state);
+    return sign_finish(sig, y, w0, w1, s1, s2, t0);
+}
+
+/*************************************************
+* Name:        signature_core
+*
+* Description: Signing loop shared by PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_derand
+*              and PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_expanded_derand.
+*              Expects the matrix A and the vectors s1, s2, t0 in NTT domain.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - const uint8_t *tr: pointer to H(rho, t1)
+*              - const uint8_t *key: pointer to signing seed K
+*              - const polyvecl mat: expanded matrix A
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+*              - const uint8_t *coins: pointer to CRHBYTES random bytes, or NULL
+*
+* Returns 0 (success)
+**************************************************/
+static int signature_core(uint8_t *sig,
+                          size_t *siglen,
+                          const uint8_t *m,
+                          size_t mlen,
+                          const uint8_t tr[SEEDBYTES],
+                          const uint8_t key[SEEDBYTES],
+                          const polyvecl mat[K],
+                          const polyvecl *s1,
+                          const polyveck *s2,
+                          const polyveck *t0,
+                          const uint8_t *coins) {
+    unsigned int n;
+    uint8_t seedbuf[SEEDBYTES + 2 * CRHBYTES];
+    uint8_t *mu, *rhoprime;
+    uint16_t nonce = 0;
+    polyvecl y;
+    polyveck w1, w0;
+    shake256incctx_inline state;
+
+    mu = seedbuf + SEEDBYTES;
+    rhoprime = mu + CRHBYTES;
+    for (n = 0; n < SEEDBYTES; n++) {
+        seedbuf[n] = key[n];
+    }
+
+    /* Compute CRH(tr, msg) */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, tr, SEEDBYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(mu, CRHBYTES, &state);
+
+    if (coins != NULL) {
+        for (n = 0; n < CRHBYTES; n++) {
+            rhoprime[n] = coins[n];
+        }
+    } else {
+        shake256(rhoprime, CRHBYTES, seedbuf, SEEDBYTES + CRHBYTES);
+    }
+
+rej:
+    sign_commit(&y, &w0, &w1, mat, rhoprime, nonce++);
+    if (sign_respond(sig, mu, &y, &w0, &w1, s1, s2, t0)) {
+        goto rej;
+    }
+
+    *siglen = PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES;
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_derand
+*
+* Description: Computes signature. With coins, the masking seed rhoprime
+*              is taken from the caller (randomized signing); otherwise it
+*              is derived from the secret key (deterministic signing).
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - uint8_t *sk:    pointer to bit-packed secret key
+*              - const uint8_t *coins: pointer to CRHBYTES random bytes, or NULL
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_derand(uint8_t *sig,
+        size_t *siglen,
+        const uint8_t *m,
+        size_t mlen,
+        const uint8_t *sk,
+        const uint8_t *coins) {
+    uint8_t rho[SEEDBYTES], tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    PQCLEAN_DILITHIUM3_CLEAN_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+
+    /* Expand matrix and transform vectors */
+    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&s1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&s2);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t0);
+
+    return signature_core(sig, siglen, m, mlen, tr, key, mat, &s1, &s2, &t0, coins);
+}
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature
 *
-* Description: Computes signature.
+* Description: Computes signature.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - uint8_t *sk:    pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature(uint8_t *sig,
+        size_t *siglen,
+        const uint8_t *m,
+        size_t mlen,
+        const uint8_t *sk) {
+    return PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_derand(sig, siglen, m, mlen, sk, NULL);
+}
+
+/*************************************************
+* Name:        sign_batch_group
+*
+* Description: Signs up to SIGN_BATCH messages under one expanded key.
+*              mu and rhoprime of all messages are computed together with
+*              the batched SHAKE256 API. The rejection loops then run in
+*              lock-step: every round makes one attempt per unfinished
+*              message and hashes all of their challenges together.
+*              Each message sees the same attempts as in
+*              PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature.
+*
+* Arguments:   - uint8_t *const *sig: pointers to the n output signatures
+*              - size_t *siglen: n output signature lengths
+*              - const uint8_t *const *m: pointers to the n messages
+*              - const size_t *mlen: lengths of the n messages
+*              - size_t n: number of messages, at most SIGN_BATCH
+*              - const uint8_t *tr: pointer to H(rho, t1)
+*              - const uint8_t *key: pointer to signing seed K
+*              - const polyvecl mat: expanded matrix A
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+**************************************************/
+static void sign_batch_group(uint8_t *const *sig,
+                             size_t *siglen,
+                             const uint8_t *const *m,
+                             const size_t *mlen,
+                             size_t n,
+                             const uint8_t tr[SEEDBYTES],
+                             const uint8_t key[SEEDBYTES],
+                             const polyvecl mat[K],
+                             const polyvecl *s1,
+                             const polyveck *s2,
+                             const polyveck *t0) {
+    size_t i, j, u, nact;
+    size_t act[SIGN_BATCH];
+    uint16_t nonce[SIGN_BATCH];
+    /* key || mu per message, the input of the rhoprime hash */
+    uint8_t seedbuf[SIGN_BATCH][SEEDBYTES + CRHBYTES];
+    uint8_t rhoprime[SIGN_BATCH][CRHBYTES];
+    /* mu || w1 per message, the input of the challenge hash */
+    uint8_t buf[SIGN_BATCH][CRHBYTES + K * POLYW1_PACKEDBYTES];
+    uint8_t *hout[SIGN_BATCH];
+    const uint8_t *hin[SIGN_BATCH];
+    const uint8_t *hpre[SIGN_BATCH];
+    size_t hinlen[SIGN_BATCH];
+    polyvecl y[SIGN_BATCH];
+    polyveck w0[SIGN_BATCH], w1[SIGN_BATCH];
+
+    /* Compute CRH(tr, msg) */
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < SEEDBYTES; ++j) {
+            seedbuf[i][j] = key[j];
+        }
+        hpre[i] = tr;
+        hout[i] = seedbuf[i] + SEEDBYTES;
+    }
+    shake256_batch_prefixed(hout, CRHBYTES, hpre, SEEDBYTES, m, mlen, n);
+
+    /* Derive rhoprime as in deterministic signing */
+    for (i = 0; i < n; ++i) {
+        hin[i] = seedbuf[i];
+        hinlen[i] = SEEDBYTES + CRHBYTES;
+        hout[i] = rhoprime[i];
+    }
+    shake256_batch(hout, CRHBYTES, hin, hinlen, n);
+
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < CRHBYTES; ++j) {
+            buf[i][j] = seedbuf[i][SEEDBYTES + j];
+        }
+        nonce[i] = 0;
+        act[i] = i;
+    }
+    nact = n;
+
+    while (nact > 0) {
+        for (u = 0; u < nact; ++u) {
+            i = act[u];
+            sign_commit(&y[i], &w0[i], &w1[i], mat, rhoprime[i], nonce[i]++);
+            PQCLEAN_DILITHIUM3_CLEAN_polyveck_pack_w1(buf[i] + CRHBYTES, &w1[i]);
+            hin[u] = buf[i];
+            hinlen[u] = CRHBYTES + K * POLYW1_PACKEDBYTES;
+            hout[u] = sig[i];
+        }
+
+        /* Call the random oracle for all unfinished messages */
+        shake256_batch(hout, SEEDBYTES, hin, hinlen, nact);
+
+        /* Keep the messages whose attempt was rejected */
+        j = 0;
+        for (u = 0; u < nact; ++u) {
+            i = act[u];
+            if (sign_finish(sig[i], &y[i], &w0[i], &w1[i], s1, s2, t0)) {
+                act[j++] = i;
+            } else {
+                siglen[i] = PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES;
+            }
+        }
+        nact = j;
+    }
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_batch
+*
+* Description: Computes signatures on n messages under one secret key.
+*              The key is unpacked and A expanded once for the whole batch.
+*              Output i equals that of PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature on m[i].
+*
+* Arguments:   - uint8_t *const *sig: pointers to the n output signatures
+*                                     (each of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
+*              - size_t *siglen: n output signature lengths
+*              - const uint8_t *const *m: pointers to the n messages
+*              - const size_t *mlen: lengths of the n messages
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*              - size_t n: number of messages
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_batch(uint8_t *const *sig,
+        size_t *siglen,
+        const uint8_t *const *m,
+        const size_t *mlen,
+        const uint8_t *sk,
+        size_t n) {
+    size_t i, cnt;
+    uint8_t rho[SEEDBYTES], tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    PQCLEAN_DILITHIUM3_CLEAN_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+
+    /* Expand matrix and transform vectors */
+    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&s1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&s2);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t0);
+
+    for (i = 0; i < n; i += cnt) {
+        cnt = n - i < SIGN_BATCH ? n - i : SIGN_BATCH;
+        sign_batch_group(sig + i, siglen + i, m + i, mlen + i, cnt, tr, key, mat, &s1, &s2, &t0);
+    }
+
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_sk_expand
+*
+* Description: Expands a secret key for repeated signing: unpacks it,
+*              samples the matrix A and transforms A, s1, s2 and t0 to the
+*              NTT domain once, so that signing with
+*              PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_expanded skips this work.
+*              The expanded key holds secret material and must be protected
+*              like the secret key itself.
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*                              (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_sk_expand(uint8_t *esk,
+        const uint8_t *sk) {
+    uint8_t rho[SEEDBYTES], tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    PQCLEAN_DILITHIUM3_CLEAN_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+
+    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&s1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&s2);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t0);
+
+    pack_expanded_sk(esk, tr, key, mat, &s1, &s2, &t0);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_expanded_derand
+*
+* Description: Computes signature from an expanded secret key. The output
+*              equals that of PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_derand
+*              on the secret key the expanded key was derived from.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *esk: pointer to expanded secret key
+*              - const uint8_t *coins: pointer to CRHBYTES random bytes, or NULL
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_expanded_derand(uint8_t *sig,
+        size_t *siglen,
+        const uint8_t *m,
+        size_t mlen,
+        const uint8_t *esk,
+        const uint8_t *coins) {
+    uint8_t tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    unpack_expanded_sk(tr, key, mat, &s1, &s2, &t0, esk);
+    return signature_core(sig, siglen, m, mlen, tr, key, mat, &s1, &s2, &t0, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_expanded
+*
+* Description: Computes signature from an expanded secret key.
 *
-* Arguments:   - uint8_t *sig:   pointer to output signature (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
 *              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m:     pointer to message to be signed
-*              - size_t mlen:    length of message
-*              - uint8_t *sk:    pointer to bit-packed secret key
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *esk: pointer to expanded secret key
 *
 * Returns 0 (success)
 **************************************************/
-int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature(uint8_t *sig,
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_expanded(uint8_t *sig,
         size_t *siglen,
         const uint8_t *m,
         size_t mlen,
-        const uint8_t *sk) {
-    unsigned int n;
-    uint8_t seedbuf[3 * SEEDBYTES + 2 * CRHBYTES];
-    uint8_t *rho, *tr, *key, *mu, *rhoprime;
-    uint16_t nonce = 0;
-    polyvecl mat[K], s1, y, z;
-    polyveck t0, s2, w1, w0, h;
-    poly cp;
-    shake256incctx state;
-
-    rho = seedbuf;
-    tr = rho + SEEDBYTES;
-    key = tr + SEEDBYTES;
-    mu = key + SEEDBYTES;
-    rhoprime = mu + CRHBYTES;
-    PQCLEAN_DILITHIUM3_CLEAN_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
-
-    /* Compute CRH(tr, msg) */
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, tr, SEEDBYTES);
-    shake256_inc_absorb(&state, m, mlen);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(mu, CRHBYTES, &state);
-    shake256_inc_ctx_release(&state);
-
-    shake256(rhoprime, CRHBYTES, key, SEEDBYTES + CRHBYTES);
-
-    /* Expand matrix and transform vectors */
-    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&s1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&s2);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t0);
+        const uint8_t *esk) {
+    return PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_expanded_derand(sig, siglen, m, mlen, esk, NULL);
+}
 
-rej:
-    /* Sample intermediate vector y */
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_precompute
+*
+* Description: Computes entries for the commitment pool consumed by
+*              PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_precomputed.
+*              Each entry holds a fresh random masking vector y and the
+*              high and low bits of Ay. None of this depends on the message,
+*              so the pool can be refilled off the latency-critical path.
+*              Entries must be kept as secret as the key: a masking vector
+*              answered under two different challenges reveals s1. Each
+*              entry also records tr of the key, so that it is only ever
+*              used with that key.
+*
+* Arguments:   - uint8_t *pool: pointer to output entries (npre entries of
+*                               PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES bytes each)
+*              - size_t npre: number of entries to compute
+*              - const uint8_t *esk: pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_precompute(uint8_t *pool,
+        size_t npre,
+        const uint8_t *esk) {
+    const uint8_t *tr = esk + PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES - 2 * SEEDBYTES;
+    uint8_t rhoprime[CRHBYTES];
+    polyvecl mat[K], y;
+    polyveck w0, w1;
 
-    /* Matrix-vector multiplication */
-    z = y;
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&z);
-    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(&w1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(&w1);
+    unpack_expanded_sk_matrix(mat, esk);
+    while (npre > 0) {
+        randombytes(rhoprime, CRHBYTES);
+        sign_commit(&y, &w0, &w1, mat, rhoprime, 0);
+        pack_precomputed(pool, tr, &y, &w0, &w1);
+        pool += PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES;
+        npre--;
+    }
+    return 0;
+}
 
-    /* Decompose w and call the random oracle */
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_caddq(&w1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_decompose(&w1, &w0, &w1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pack_w1(sig, &w1);
-
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, mu, CRHBYTES);
-    shake256_inc_absorb(&state, sig, K * POLYW1_PACKEDBYTES);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(sig, SEEDBYTES, &state);
-    shake256_inc_ctx_release(&state);
-    PQCLEAN_DILITHIUM3_CLEAN_poly_challenge(&cp, sig);
-    PQCLEAN_DILITHIUM3_CLEAN_poly_ntt(&cp);
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_precomputed
+*
+* Description: Computes a randomized signature from an expanded secret key,
+*              taking the commitments for the signing attempts from a pool
+*              filled by PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_precompute.
+*              Entries are taken from the end of the pool; every entry
+*              used, whether the attempt is accepted or rejected, is erased
+*              and *npool is decremented. If the pool runs empty the
+*              remaining attempts compute fresh commitments on the fly.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *esk: pointer to expanded secret key
+*              - uint8_t *pool: pointer to pool of precomputed commitments
+*              - size_t *npool: pointer to number of entries in the pool;
+*                               updated on return
+*
+* Returns 0 (success), or -1 if the next entry was computed under a
+* different key. No signature is written in that case; that entry and
+* the ones below it stay in the pool.
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_signature_precomputed(uint8_t *sig,
+        size_t *siglen,
+        const uint8_t *m,
+        size_t mlen,
+        const uint8_t *esk,
+        uint8_t *pool,
+        size_t *npool) {
+    unsigned int i;
+    uint8_t tr[SEEDBYTES], mu[CRHBYTES], rhoprime[CRHBYTES];
+    uint8_t *pre;
+    uint16_t nonce = 0;
+    polyvecl mat[K], s1, y;
+    polyveck s2, t0, w0, w1;
+    shake256incctx_inline state;
 
-    /* Compute z, reject if it reveals secret */
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_invntt_tomont(&z);
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_add(&z, &z, &y);
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_reduce(&z);
-    if (PQCLEAN_DILITHIUM3_CLEAN_polyvecl_chknorm(&z, GAMMA1 - BETA)) {
-        goto rej;
-    }
+    unpack_expanded_sk_vectors(tr, &s1, &s2, &t0, esk);
 
-    /* Check that subtracting cs2 does not change high bits of w and low bits
-     * do not reveal secret information */
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(&h);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_sub(&w0, &w0, &h);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(&w0);
-    if (PQCLEAN_DILITHIUM3_CLEAN_polyveck_chknorm(&w0, GAMMA2 - BETA)) {
-        goto rej;
-    }
+    /* Compute CRH(tr, msg) */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, tr, SEEDBYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(mu, CRHBYTES, &state);
 
-    /* Compute hints for w1 */
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(&h);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(&h);
-    if (PQCLEAN_DILITHIUM3_CLEAN_polyveck_chknorm(&h, GAMMA2)) {
-        goto rej;
+    /* Erase each entry before using it so that no masking vector
+     * is ever answered twice */
+    while (*npool > 0) {
+        pre = pool + (*npool - 1) * PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES;
+        /* An entry computed under another key cannot give a valid signature */
+        if (memcmp(pre + PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES - SEEDBYTES, tr, SEEDBYTES) != 0) {
+            return -1;
+        }
+        *npool -= 1;
+        unpack_precomputed(&y, &w0, &w1, pre);
+        for (i = 0; i < PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PRECOMPUTEDBYTES; ++i) {
+            pre[i] = 0;
+        }
+        if (!sign_respond(sig, mu, &y, &w0, &w1, &s1, &s2, &t0)) {
+            *siglen = PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES;
+            return 0;
+        }
     }
 
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_add(&w0, &w0, &h);
-    n = PQCLEAN_DILITHIUM3_CLEAN_polyveck_make_hint(&h, &w0, &w1);
-    if (n > OMEGA) {
+    /* Pool exhausted: continue with fresh commitments */
+    unpack_expanded_sk_matrix(mat, esk);
+    randombytes(rhoprime, CRHBYTES);
+rej:
+    sign_commit(&y, &w0, &w1, mat, rhoprime, nonce++);
+    if (sign_respond(sig, mu, &y, &w0, &w1, &s1, &s2, &t0)) {
         goto rej;
     }
 
-    /* Write signature */
-    PQCLEAN_DILITHIUM3_CLEAN_pack_sig(sig, sig, &z, &h);
     *siglen = PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES;
     return 0;
 }
@@ -209,6 +998,118 @@ int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign(uint8_t *sm,
     return 0;
 }
 
+/*************************************************
+* Name:        verify_w1
+*
+* Description: Unpacks a signature and recomputes w1' = UseHint(h, Az - c*t1*2^D)
+*              from it, with A and t1*2^D in NTT domain.
+*
+* Arguments:   - uint8_t *w1: pointer to output bit-packed w1'
+*                             (K*POLYW1_PACKEDBYTES bytes)
+*              - uint8_t *c: pointer to output challenge seed of the signature
+*              - const uint8_t *sig: pointer to input signature
+*              - const polyvecl mat: expanded matrix A
+*              - const polyveck *t1: pointer to NTT(t1*2^D)
+*
+* Returns 0 if the signature is well-formed and -1 otherwise
+**************************************************/
+static int verify_w1(uint8_t w1buf[K * POLYW1_PACKEDBYTES],
+                     uint8_t c[SEEDBYTES],
+                     const uint8_t *sig,
+                     const polyvecl mat[K],
+                     const polyveck *t1) {
+    poly cp;
+    polyvecl z;
+    polyveck ct1, w1, h;
+
+    if (PQCLEAN_DILITHIUM3_CLEAN_unpack_sig(c, &z, &h, sig)) {
+        return -1;
+    }
+    if (PQCLEAN_DILITHIUM3_CLEAN_polyvecl_chknorm(&z, GAMMA1 - BETA)) {
+        return -1;
+    }
+
+    /* Matrix-vector multiplication; compute Az - c2^dt1 */
+    PQCLEAN_DILITHIUM3_CLEAN_poly_challenge(&cp, c);
+
+    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&z);
+    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+
+    PQCLEAN_DILITHIUM3_CLEAN_poly_ntt(&cp);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pointwise_poly_montgomery(&ct1, &cp, t1);
+
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_sub(&w1, &w1, &ct1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(&w1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(&w1);
+
+    /* Reconstruct w1 */
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_caddq(&w1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_use_hint(&w1, &w1, &h);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pack_w1(w1buf, &w1);
+    return 0;
+}
+
+/*************************************************
+* Name:        verify_core
+*
+* Description: Verification shared by PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify
+*              and PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify_expanded.
+*              Expects the matrix A and t1*2^D in NTT domain.
+*
+* Arguments:   - uint8_t *sig: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *tr: pointer to H(rho, t1)
+*              - const polyvecl mat: expanded matrix A
+*              - const polyveck *t1: pointer to NTT(t1*2^D)
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+static int verify_core(const uint8_t *sig,
+                       size_t siglen,
+                       const uint8_t *m,
+                       size_t mlen,
+                       const uint8_t tr[SEEDBYTES],
+                       const polyvecl mat[K],
+                       const polyveck *t1) {
+    unsigned int i;
+    uint8_t buf[K * POLYW1_PACKEDBYTES];
+    uint8_t mu[CRHBYTES];
+    uint8_t c[SEEDBYTES];
+    uint8_t c2[SEEDBYTES];
+    shake256incctx_inline state;
+
+    if (siglen != PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES) {
+        return -1;
+    }
+
+    if (verify_w1(buf, c, sig, mat, t1)) {
+        return -1;
+    }
+
+    /* Compute CRH(H(rho, t1), msg) */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, tr, SEEDBYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(mu, CRHBYTES, &state);
+
+    /* Call random oracle and verify PQCLEAN_DILITHIUM3_CLEAN_challenge */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, mu, CRHBYTES);
+    shake256_inc_absorb_inline(&state, buf, K * POLYW1_PACKEDBYTES);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(c2, SEEDBYTES, &state);
+    for (i = 0; i < SEEDBYTES; ++i) {
+        if (c[i] != c2[i]) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify
 *
@@ -227,73 +1128,228 @@ int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify(const uint8_t *sig,
         const uint8_t *m,
         size_t mlen,
         const uint8_t *pk) {
-    unsigned int i;
-    uint8_t buf[K * POLYW1_PACKEDBYTES];
     uint8_t rho[SEEDBYTES];
-    uint8_t mu[CRHBYTES];
-    uint8_t c[SEEDBYTES];
-    uint8_t c2[SEEDBYTES];
-    poly cp;
-    polyvecl mat[K], z;
-    polyveck t1, w1, h;
-    shake256incctx state;
+    uint8_t tr[SEEDBYTES];
+    polyvecl mat[K];
+    polyveck t1;
 
     if (siglen != PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES) {
         return -1;
     }
 
     PQCLEAN_DILITHIUM3_CLEAN_unpack_pk(rho, &t1, pk);
-    if (PQCLEAN_DILITHIUM3_CLEAN_unpack_sig(c, &z, &h, sig)) {
+    shake256(tr, SEEDBYTES, pk, PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PUBLICKEYBYTES);
+
+    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_shiftl(&t1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t1);
+
+    return verify_core(sig, siglen, m, mlen, tr, mat, &t1);
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_pk_expand
+*
+* Description: Expands a public key for repeated verification: caches
+*              tr = H(pk), the matrix A and t1*2^D in NTT domain, so that
+*              PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify_expanded does not hash the
+*              public key, sample A or transform t1 again.
+*
+* Arguments:   - uint8_t *epk: pointer to output expanded public key
+*                              (of length PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_pk_expand(uint8_t *epk,
+        const uint8_t *pk) {
+    uint8_t rho[SEEDBYTES];
+    uint8_t tr[SEEDBYTES];
+    polyvecl mat[K];
+    polyveck t1;
+
+    PQCLEAN_DILITHIUM3_CLEAN_unpack_pk(rho, &t1, pk);
+    shake256(tr, SEEDBYTES, pk, PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PUBLICKEYBYTES);
+
+    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_shiftl(&t1);
+    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t1);
+
+    pack_expanded_pk(epk, tr, mat, &t1);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify_expanded
+*
+* Description: Verifies signature against an expanded public key.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify_expanded(const uint8_t *sig,
+        size_t siglen,
+        const uint8_t *m,
+        size_t mlen,
+        const uint8_t *epk) {
+    uint8_t tr[SEEDBYTES];
+    polyvecl mat[K];
+    polyveck t1;
+
+    if (siglen != PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES) {
         return -1;
     }
-    if (PQCLEAN_DILITHIUM3_CLEAN_polyvecl_chknorm(&z, GAMMA1 - BETA)) {
-        return -1;
+
+    unpack_expanded_pk(tr, mat, &t1, epk);
+    return verify_core(sig, siglen, m, mlen, tr, mat, &t1);
+}
+
+/*************************************************
+* Name:        verify_batch_group
+*
+* Description: Verifies up to VERIFY_BATCH signatures. H(pk), mu and the
+*              final challenge hash of all signatures are computed together
+*              with the batched SHAKE256 API; signatures under the same
+*              public key share one expansion of A and t1.
+*
+* Arguments:   as PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify_batch, with n <= VERIFY_BATCH
+*
+* Returns 0 if all signatures could be verified correctly and -1 otherwise
+**************************************************/
+static int verify_batch_group(int *results,
+                              const uint8_t *const *sig,
+                              const size_t *siglen,
+                              const uint8_t *const *m,
+                              const size_t *mlen,
+                              const uint8_t *const *pk,
+                              size_t n) {
+    size_t i, j, u, nkeys = 0, nsig = 0;
+    size_t key[VERIFY_BATCH];
+    int ok[VERIFY_BATCH];
+    int res = 0;
+    uint8_t rho[SEEDBYTES];
+    uint8_t tr[VERIFY_BATCH][SEEDBYTES];
+    uint8_t c[VERIFY_BATCH][SEEDBYTES];
+    uint8_t c2[VERIFY_BATCH][SEEDBYTES];
+    /* mu || w1' per signature, the input of the challenge hash */
+    uint8_t buf[VERIFY_BATCH][CRHBYTES + K * POLYW1_PACKEDBYTES];
+    uint8_t *hout[VERIFY_BATCH];
+    const uint8_t *hin[VERIFY_BATCH];
+    const uint8_t *hpre[VERIFY_BATCH];
+    size_t hinlen[VERIFY_BATCH];
+    size_t idx[VERIFY_BATCH];
+    polyvecl mat[K];
+    polyveck t1;
+
+    /* Find distinct public keys and hash them */
+    for (i = 0; i < n; ++i) {
+        ok[i] = siglen[i] == PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_BYTES;
+        for (j = 0; j < nkeys; ++j) {
+            if (pk[idx[j]] == pk[i] || memcmp(pk[idx[j]], pk[i], PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PUBLICKEYBYTES) == 0) {
+                break;
+            }
+        }
+        if (j == nkeys) {
+            idx[nkeys] = i;
+            hin[nkeys] = pk[i];
+            hinlen[nkeys] = PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PUBLICKEYBYTES;
+            hout[nkeys] = tr[nkeys];
+            nkeys++;
+        }
+        key[i] = j;
     }
+    shake256_batch(hout, SEEDBYTES, hin, hinlen, nkeys);
 
     /* Compute CRH(H(rho, t1), msg) */
-    shake256(mu, SEEDBYTES, pk, PQCLEAN_DILITHIUM3_CLEAN_CRYPTO_PUBLICKEYBYTES);
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, mu, SEEDBYTES);
-    shake256_inc_absorb(&state, m, mlen);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(mu, CRHBYTES, &state);
-    shake256_inc_ctx_release(&state);
+    for (i = 0; i < n; ++i) {
+        hpre[i] = tr[key[i]];
+        hout[i] = buf[i];
+    }
+    shake256_batch_prefixed(hout, CRHBYTES, hpre, SEEDBYTES, m, mlen, n);
 
-    /* Matrix-vector multiplication; compute Az - c2^dt1 */
-    PQCLEAN_DILITHIUM3_CLEAN_poly_challenge(&cp, c);
-    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
+    /* Recompute w1' once per public key */
+    for (u = 0; u < nkeys; ++u) {
+        PQCLEAN_DILITHIUM3_CLEAN_unpack_pk(rho, &t1, pk[idx[u]]);
+        PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_expand(mat, rho);
+        PQCLEAN_DILITHIUM3_CLEAN_polyveck_shiftl(&t1);
+        PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t1);
 
-    PQCLEAN_DILITHIUM3_CLEAN_polyvecl_ntt(&z);
-    PQCLEAN_DILITHIUM3_CLEAN_polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+        for (i = 0; i < n; ++i) {
+            if (key[i] == u && ok[i] && verify_w1(buf[i] + CRHBYTES, c[i], sig[i], mat, &t1)) {
+                ok[i] = 0;
+            }
+        }
+    }
 
-    PQCLEAN_DILITHIUM3_CLEAN_poly_ntt(&cp);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_shiftl(&t1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_ntt(&t1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pointwise_poly_montgomery(&t1, &cp, &t1);
+    /* Call random oracle on all well-formed signatures */
+    for (i = 0; i < n; ++i) {
+        if (ok[i]) {
+            hin[nsig] = buf[i];
+            hinlen[nsig] = CRHBYTES + K * POLYW1_PACKEDBYTES;
+            hout[nsig] = c2[i];
+            nsig++;
+        }
+    }
+    shake256_batch(hout, SEEDBYTES, hin, hinlen, nsig);
 
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_sub(&w1, &w1, &t1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_reduce(&w1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_invntt_tomont(&w1);
+    for (i = 0; i < n; ++i) {
+        if (ok[i]) {
+            for (j = 0; j < SEEDBYTES; ++j) {
+                if (c[i][j] != c2[i][j]) {
+                    ok[i] = 0;
+                }
+            }
+        }
+        results[i] = ok[i] ? 0 : -1;
+        if (!ok[i]) {
+            res = -1;
+        }
+    }
 
-    /* Reconstruct w1 */
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_caddq(&w1);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_use_hint(&w1, &w1, &h);
-    PQCLEAN_DILITHIUM3_CLEAN_polyveck_pack_w1(buf, &w1);
+    return res;
+}
 
-    /* Call random oracle and verify PQCLEAN_DILITHIUM3_CLEAN_challenge */
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, mu, CRHBYTES);
-    shake256_inc_absorb(&state, buf, K * POLYW1_PACKEDBYTES);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(c2, SEEDBYTES, &state);
-    shake256_inc_ctx_release(&state);
-    for (i = 0; i < SEEDBYTES; ++i) {
-        if (c[i] != c2[i]) {
-            return -1;
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify_batch
+*
+* Description: Verifies n independent signatures. The result for
+*              signature i is written to results[i].
+*
+* Arguments:   - int *results: pointer to n outputs, 0 if signature i
+*                              could be verified correctly and -1 otherwise
+*              - const uint8_t *const *sig: pointers to the n signatures
+*              - const size_t *siglen: lengths of the n signatures
+*              - const uint8_t *const *m: pointers to the n messages
+*              - const size_t *mlen: lengths of the n messages
+*              - const uint8_t *const *pk: pointers to the n bit-packed
+*                                          public keys; may repeat
+*              - size_t n: number of signatures
+*
+* Returns 0 if all signatures could be verified correctly and -1 otherwise
+**************************************************/
+int PQCLEAN_DILITHIUM3_CLEAN_crypto_sign_verify_batch(int *results,
+        const uint8_t *const *sig,
+        const size_t *siglen,
+        const uint8_t *const *m,
+        const size_t *mlen,
+        const uint8_t *const *pk,
+        size_t n) {
+    size_t i, cnt;
+    int res = 0;
+
+    for (i = 0; i < n; i += cnt) {
+        cnt = n - i < VERIFY_BATCH ? n - i : VERIFY_BATCH;
+        if (verify_batch_group(results + i, sig + i, siglen + i, m + i, mlen + i, pk + i, cnt)) {
+            res = -1;
         }
     }
 
-    return 0;
+    return res;
 }
 
 /*************************************************
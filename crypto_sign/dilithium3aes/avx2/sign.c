@@ -103,96 +103,215 @@ int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature
+* Name:        pack_expanded_sk
 *
-* Description: Computes signature.
+* Description: Store the NTT-domain matrix and secret vectors, followed by
+*              tr and the signing seed, in an expanded secret key. The
+*              polynomials are copied in their native in-memory layout so
+*              that they stay 32-byte aligned in an aligned buffer.
 *
-* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
-*              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m: pointer to message to be signed
-*              - size_t mlen: length of message
-*              - uint8_t *sk: pointer to bit-packed secret key
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*              - remaining arguments: components of the expanded key
+**************************************************/
+static void pack_expanded_sk(uint8_t esk[PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES],
+                             const uint8_t tr[SEEDBYTES], const uint8_t key[SEEDBYTES], const polyvecl mat[K],
+                             const polyvecl *s1, const polyveck *s2, const polyveck *t0) {
+    memcpy(esk, mat, K * sizeof(polyvecl));
+    esk += K * sizeof(polyvecl);
+    memcpy(esk, s1, sizeof(polyvecl));
+    esk += sizeof(polyvecl);
+    memcpy(esk, s2, sizeof(polyveck));
+    esk += sizeof(polyveck);
+    memcpy(esk, t0, sizeof(polyveck));
+    esk += sizeof(polyveck);
+    memcpy(esk, tr, SEEDBYTES);
+    memcpy(esk + SEEDBYTES, key, SEEDBYTES);
+}
+
+/*************************************************
+* Name:        unpack_expanded_sk_matrix
 *
-* Returns 0 (success)
+* Description: Unpack only the matrix A from an expanded secret key.
+*
+* Arguments:   - polyvecl mat: output matrix A
+*              - const uint8_t *esk: pointer to input expanded secret key
 **************************************************/
-int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk) {
-    unsigned int i, n, pos;
-    uint8_t seedbuf[3 * SEEDBYTES + 2 * CRHBYTES];
-    uint8_t *rho, *tr, *key, *mu, *rhoprime;
-    uint8_t hintbuf[N];
-    uint8_t *hint = sig + SEEDBYTES + L * POLYZ_PACKEDBYTES;
-    uint64_t nonce = 0;
-    polyvecl mat[K], s1, z;
-    polyveck t0, s2, w1;
-    poly c, tmp;
-    union {
-        polyvecl y;
-        polyveck w0;
-    } tmpv;
-    shake256incctx state;
+static void unpack_expanded_sk_matrix(polyvecl mat[K], const uint8_t esk[PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES]) {
+    memcpy(mat, esk, K * sizeof(polyvecl));
+}
 
-    rho = seedbuf;
-    tr = rho + SEEDBYTES;
-    key = tr + SEEDBYTES;
-    mu = key + SEEDBYTES;
-    rhoprime = mu + CRHBYTES;
-    PQCLEAN_DILITHIUM3AES_AVX2_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+/*************************************************
+* Name:        unpack_expanded_sk_vectors
+*
+* Description: Unpack tr and the secret vectors s1, s2, t0 from an expanded
+*              secret key, skipping the matrix A.
+*
+* Arguments:   - remaining arguments: components of the expanded key
+*              - const uint8_t *esk: pointer to input expanded secret key
+**************************************************/
+static void unpack_expanded_sk_vectors(uint8_t tr[SEEDBYTES], polyvecl *s1, polyveck *s2, polyveck *t0,
+                                       const uint8_t esk[PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES]) {
+    esk += K * sizeof(polyvecl);
+    memcpy(s1, esk, sizeof(polyvecl));
+    esk += sizeof(polyvecl);
+    memcpy(s2, esk, sizeof(polyveck));
+    esk += sizeof(polyveck);
+    memcpy(t0, esk, sizeof(polyveck));
+    esk += sizeof(polyveck);
+    memcpy(tr, esk, SEEDBYTES);
+}
 
-    /* Compute CRH(tr, msg) */
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, tr, SEEDBYTES);
-    shake256_inc_absorb(&state, m, mlen);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(mu, CRHBYTES, &state);
-    shake256_inc_ctx_release(&state);
+/*************************************************
+* Name:        unpack_expanded_sk
+*
+* Description: Inverse of pack_expanded_sk.
+*
+* Arguments:   - remaining arguments: components of the expanded key
+*              - const uint8_t *esk: pointer to input expanded secret key
+**************************************************/
+static void unpack_expanded_sk(uint8_t tr[SEEDBYTES], uint8_t key[SEEDBYTES], polyvecl mat[K],
+                               polyvecl *s1, polyveck *s2, polyveck *t0,
+                               const uint8_t esk[PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES]) {
+    unpack_expanded_sk_matrix(mat, esk);
+    unpack_expanded_sk_vectors(tr, s1, s2, t0, esk);
+    memcpy(key, esk + PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES - SEEDBYTES, SEEDBYTES);
+}
 
-    shake256(rhoprime, CRHBYTES, key, SEEDBYTES + CRHBYTES);
+/*************************************************
+* Name:        pack_precomputed
+*
+* Description: Store a precomputed commitment: y and w0 packed like z in
+*              a signature, w1 packed like the challenge input, and tr of
+*              the key the commitment was computed under. The fields are
+*              written in this order because polyw1_pack may store past
+*              the end of its output and polyz_unpack may read past the
+*              end of its input; both stay within the entry.
+*
+* Arguments:   - uint8_t *pre: pointer to output byte array
+*                              (PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES bytes)
+*              - const uint8_t *tr: pointer to tr of the signing key
+*              - const polyvecl *y: pointer to masking vector
+*              - const polyveck *w0, *w1: pointers to low and high bits of Ay
+**************************************************/
+static void pack_precomputed(uint8_t pre[PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES], const uint8_t tr[SEEDBYTES],
+                             const polyvecl *y, const polyveck *w0, const polyveck *w1) {
+    unsigned int i;
 
-    /* Expand matrix and transform vectors */
-    PQCLEAN_DILITHIUM3AES_AVX2_polyvec_matrix_expand(mat, rho);
-    PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_ntt(&s1);
-    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&s2);
-    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&t0);
+    for (i = 0; i < L; ++i) {
+        PQCLEAN_DILITHIUM3AES_AVX2_polyz_pack(pre, &y->vec[i]);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3AES_AVX2_polyz_pack(pre, &w0->vec[i]);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3AES_AVX2_polyw1_pack(pre, &w1->vec[i]);
+        pre += POLYW1_PACKEDBYTES;
+    }
+    memcpy(pre, tr, SEEDBYTES);
+}
+
+/*************************************************
+* Name:        unpack_precomputed
+*
+* Description: Inverse of pack_precomputed, except for tr.
+*
+* Arguments:   - polyvecl *y: pointer to output masking vector
+*              - polyveck *w0, *w1: pointers to output low and high bits of Ay
+*              - const uint8_t *pre: pointer to input byte array
+**************************************************/
+static void unpack_precomputed(polyvecl *y, polyveck *w0, polyveck *w1,
+                               const uint8_t pre[PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES]) {
+    unsigned int i;
+
+    for (i = 0; i < L; ++i) {
+        PQCLEAN_DILITHIUM3AES_AVX2_polyz_unpack(&y->vec[i], pre);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3AES_AVX2_polyz_unpack(&w0->vec[i], pre);
+        pre += POLYZ_PACKEDBYTES;
+    }
+    for (i = 0; i < K; ++i) {
+        PQCLEAN_DILITHIUM3AES_AVX2_polyw1_unpack(&w1->vec[i], pre);
+        pre += POLYW1_PACKEDBYTES;
+    }
+}
 
+/*************************************************
+* Name:        sign_commit
+*
+* Description: Message-independent part of a signing attempt: samples the
+*              masking vector y and computes the high and low bits w1, w0
+*              of w = Ay.
+*
+* Arguments:   - polyvecl *z: pointer to output masking vector y
+*              - polyveck *w0: pointer to output low bits of w
+*              - polyveck *w1: pointer to output high bits of w
+*              - const polyvecl mat: expanded matrix A
+*              - const uint8_t *rhoprime: pointer to masking seed
+*              - uint64_t nonce: nonce of the first polynomial of y
+**************************************************/
+static void sign_commit(polyvecl *z, polyveck *w0, polyveck *w1, const polyvecl mat[K], const uint8_t rhoprime[CRHBYTES], uint64_t nonce) {
+    unsigned int i;
+    polyvecl y;
     aes256ctr_ctx aesctx;
+
     PQCLEAN_DILITHIUM3AES_AVX2_aes256ctr_init(&aesctx, rhoprime, 0);
 
-rej:
     /* Sample intermediate vector y */
     for (i = 0; i < L; ++i) {
         aesctx.n = _mm_loadl_epi64((__m128i *)&nonce);
         nonce++;
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_uniform_gamma1_preinit(&z.vec[i], &aesctx);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_uniform_gamma1_preinit(&z->vec[i], &aesctx);
     }
 
     /* Matrix-vector product */
-    tmpv.y = z;
-    PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_ntt(&tmpv.y);
-    PQCLEAN_DILITHIUM3AES_AVX2_polyvec_matrix_pointwise_montgomery(&w1, mat, &tmpv.y);
-    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_invntt_tomont(&w1);
-
-    /* Decompose w and call the random oracle */
-    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_caddq(&w1);
-    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_decompose(&w1, &tmpv.w0, &w1);
-    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_pack_w1(sig, &w1);
-
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, mu, CRHBYTES);
-    shake256_inc_absorb(&state, sig, K * POLYW1_PACKEDBYTES);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(sig, SEEDBYTES, &state);
-    shake256_inc_ctx_release(&state);
+    y = *z;
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_ntt(&y);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvec_matrix_pointwise_montgomery(w1, mat, &y);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_invntt_tomont(w1);
+
+    /* Decompose w */
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_caddq(w1);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_decompose(w1, w0, w1);
+}
+
+/*************************************************
+* Name:        sign_finish
+*
+* Description: Completes a signing attempt whose challenge seed c~ has
+*              already been written to the start of sig: computes
+*              z = y + cs1 and the hints, and writes the rest of the
+*              signature unless a norm check rejects.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature starting with c~
+*              - polyvecl *z: pointer to masking vector y; overwritten with z
+*              - polyveck *w0: pointer to low bits of w; overwritten
+*              - const polyveck *w1: pointer to high bits of w
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+*
+* Returns 0 if the signature was written and -1 if the attempt is rejected
+**************************************************/
+static int sign_finish(uint8_t *sig, polyvecl *z, polyveck *w0, const polyveck *w1,
+                       const polyvecl *s1, const polyveck *s2, const polyveck *t0) {
+    unsigned int i, n, pos;
+    uint8_t hintbuf[N];
+    uint8_t *hint = sig + SEEDBYTES + L * POLYZ_PACKEDBYTES;
+    poly c, tmp;
+
     PQCLEAN_DILITHIUM3AES_AVX2_poly_challenge(&c, sig);
     PQCLEAN_DILITHIUM3AES_AVX2_poly_ntt(&c);
 
     /* Compute z, reject if it reveals secret */
     for (i = 0; i < L; i++) {
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&tmp, &c, &s1.vec[i]);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&tmp, &c, &s1->vec[i]);
         PQCLEAN_DILITHIUM3AES_AVX2_poly_invntt_tomont(&tmp);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_add(&z.vec[i], &z.vec[i], &tmp);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_reduce(&z.vec[i]);
-        if (PQCLEAN_DILITHIUM3AES_AVX2_poly_chknorm(&z.vec[i], GAMMA1 - BETA)) {
-            goto rej;
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_add(&z->vec[i], &z->vec[i], &tmp);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_reduce(&z->vec[i]);
+        if (PQCLEAN_DILITHIUM3AES_AVX2_poly_chknorm(&z->vec[i], GAMMA1 - BETA)) {
+            return -1;
         }
     }
 
@@ -203,26 +322,26 @@ rej:
     for (i = 0; i < K; i++) {
         /* Check that subtracting cs2 does not change high bits of w and low bits
          * do not reveal secret information */
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&tmp, &c, &s2.vec[i]);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&tmp, &c, &s2->vec[i]);
         PQCLEAN_DILITHIUM3AES_AVX2_poly_invntt_tomont(&tmp);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_sub(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_reduce(&tmpv.w0.vec[i]);
-        if (PQCLEAN_DILITHIUM3AES_AVX2_poly_chknorm(&tmpv.w0.vec[i], GAMMA2 - BETA)) {
-            goto rej;
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_sub(&w0->vec[i], &w0->vec[i], &tmp);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_reduce(&w0->vec[i]);
+        if (PQCLEAN_DILITHIUM3AES_AVX2_poly_chknorm(&w0->vec[i], GAMMA2 - BETA)) {
+            return -1;
         }
 
         /* Compute hints */
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&tmp, &c, &t0.vec[i]);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&tmp, &c, &t0->vec[i]);
         PQCLEAN_DILITHIUM3AES_AVX2_poly_invntt_tomont(&tmp);
         PQCLEAN_DILITHIUM3AES_AVX2_poly_reduce(&tmp);
         if (PQCLEAN_DILITHIUM3AES_AVX2_poly_chknorm(&tmp, GAMMA2)) {
-            goto rej;
+            return -1;
         }
 
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_add(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
-        n = PQCLEAN_DILITHIUM3AES_AVX2_poly_make_hint(hintbuf, &tmpv.w0.vec[i], &w1.vec[i]);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_add(&w0->vec[i], &w0->vec[i], &tmp);
+        n = PQCLEAN_DILITHIUM3AES_AVX2_poly_make_hint(hintbuf, &w0->vec[i], &w1->vec[i]);
         if (pos + n > OMEGA) {
-            goto rej;
+            return -1;
         }
 
         /* Store hints in signature */
@@ -232,7 +351,456 @@ rej:
 
     /* Pack z into signature */
     for (i = 0; i < L; i++) {
-        PQCLEAN_DILITHIUM3AES_AVX2_polyz_pack(sig + SEEDBYTES + i * POLYZ_PACKEDBYTES, &z.vec[i]);
+        PQCLEAN_DILITHIUM3AES_AVX2_polyz_pack(sig + SEEDBYTES + i * POLYZ_PACKEDBYTES, &z->vec[i]);
+    }
+
+    return 0;
+}
+
+/*************************************************
+* Name:        sign_respond
+*
+* Description: Message-dependent part of a signing attempt: derives the
+*              challenge from mu and w1, computes z = y + cs1 and the hints,
+*              and writes the signature unless a norm check rejects.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature
+*              - const uint8_t *mu: pointer to CRH(tr, msg)
+*              - polyvecl *z: pointer to masking vector y; overwritten with z
+*              - polyveck *w0: pointer to low bits of w; overwritten
+*              - const polyveck *w1: pointer to high bits of w
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+*
+* Returns 0 if the signature was written and -1 if the attempt is rejected
+**************************************************/
+static int sign_respond(uint8_t *sig, const uint8_t mu[CRHBYTES], polyvecl *z, polyveck *w0, const polyveck *w1,
+                        const polyvecl *s1, const polyveck *s2, const polyveck *t0) {
+    shake256incctx_inline state;
+
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_pack_w1(sig, w1);
+
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, mu, CRHBYTES);
+    shake256_inc_absorb_inline(&state, sig, K * POLYW1_PACKEDBYTES);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(sig, SEEDBYTES, &state);
+    return sign_finish(sig, z, w0, w1, s1, s2, t0);
+}
+
+/*************************************************
+* Name:        signature_core
+*
+* Description: Signing loop shared by PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_derand
+*              and PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_expanded_derand.
+*              Expects the matrix A and the vectors s1, s2, t0 in NTT domain.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - const uint8_t *tr: pointer to H(rho, t1)
+*              - const uint8_t *key: pointer to signing seed K
+*              - const polyvecl mat: expanded matrix A
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+*              - const uint8_t *coins: pointer to CRHBYTES random bytes, or NULL
+*
+* Returns 0 (success)
+**************************************************/
+static int signature_core(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t tr[SEEDBYTES], const uint8_t key[SEEDBYTES], const polyvecl mat[K], const polyvecl *s1, const polyveck *s2, const polyveck *t0, const uint8_t *coins) {
+    unsigned int n;
+    uint8_t seedbuf[SEEDBYTES + 2 * CRHBYTES];
+    uint8_t *mu, *rhoprime;
+    uint64_t nonce = 0;
+    polyvecl z;
+    polyveck w0, w1;
+    shake256incctx_inline state;
+
+    mu = seedbuf + SEEDBYTES;
+    rhoprime = mu + CRHBYTES;
+    memcpy(seedbuf, key, SEEDBYTES);
+
+    /* Compute CRH(tr, msg) */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, tr, SEEDBYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(mu, CRHBYTES, &state);
+
+    if (coins != NULL) {
+        for (n = 0; n < CRHBYTES; n++) {
+            rhoprime[n] = coins[n];
+        }
+    } else {
+        shake256(rhoprime, CRHBYTES, seedbuf, SEEDBYTES + CRHBYTES);
+    }
+
+rej:
+    sign_commit(&z, &w0, &w1, mat, rhoprime, nonce);
+    nonce += L;
+    if (sign_respond(sig, mu, &z, &w0, &w1, s1, s2, t0)) {
+        goto rej;
+    }
+
+    *siglen = PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES;
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_derand
+*
+* Description: Computes signature. With coins, the masking seed rhoprime
+*              is taken from the caller (randomized signing); otherwise it
+*              is derived from the secret key (deterministic signing).
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *sk: pointer to bit-packed secret key
+*              - const uint8_t *coins: pointer to CRHBYTES random bytes, or NULL
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_derand(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk, const uint8_t *coins) {
+    uint8_t rho[SEEDBYTES], tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    PQCLEAN_DILITHIUM3AES_AVX2_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+
+    /* Expand matrix and transform vectors */
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_ntt(&s1);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&s2);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&t0);
+
+    return signature_core(sig, siglen, m, mlen, tr, key, mat, &s1, &s2, &t0, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature
+*
+* Description: Computes signature.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    return PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_derand(sig, siglen, m, mlen, sk, NULL);
+}
+
+/*************************************************
+* Name:        sign_batch_group
+*
+* Description: Signs up to SIGN_BATCH messages under one expanded key.
+*              mu and rhoprime of all messages are computed together with
+*              the batched SHAKE256 API. The rejection loops then run in
+*              lock-step: every round makes one attempt per unfinished
+*              message and hashes all of their challenges together.
+*              Each message sees the same attempts as in
+*              PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature.
+*
+* Arguments:   - uint8_t *const *sig: pointers to the n output signatures
+*              - size_t *siglen: n output signature lengths
+*              - const uint8_t *const *m: pointers to the n messages
+*              - const size_t *mlen: lengths of the n messages
+*              - size_t n: number of messages, at most SIGN_BATCH
+*              - const uint8_t *tr: pointer to H(rho, t1)
+*              - const uint8_t *key: pointer to signing seed K
+*              - const polyvecl mat: expanded matrix A
+*              - const polyvecl *s1, *s2, *t0: pointers to secret vectors
+**************************************************/
+static void sign_batch_group(uint8_t *const *sig, size_t *siglen, const uint8_t *const *m, const size_t *mlen, size_t n,
+                             const uint8_t tr[SEEDBYTES], const uint8_t key[SEEDBYTES], const polyvecl mat[K],
+                             const polyvecl *s1, const polyveck *s2, const polyveck *t0) {
+    size_t i, j, u, nact;
+    size_t act[SIGN_BATCH];
+    uint64_t nonce[SIGN_BATCH];
+    /* key || mu per message, the input of the rhoprime hash */
+    uint8_t seedbuf[SIGN_BATCH][SEEDBYTES + CRHBYTES];
+    uint8_t rhoprime[SIGN_BATCH][CRHBYTES];
+    /* mu || w1 per message, the input of the challenge hash, padded for
+     * the vector stores of polyw1_pack */
+    ALIGNED_UINT8(CRHBYTES + K * POLYW1_PACKEDBYTES + 14) buf[SIGN_BATCH];
+    uint8_t *hout[SIGN_BATCH];
+    const uint8_t *hin[SIGN_BATCH];
+    const uint8_t *hpre[SIGN_BATCH];
+    size_t hinlen[SIGN_BATCH];
+    polyvecl z[SIGN_BATCH];
+    polyveck w0[SIGN_BATCH], w1[SIGN_BATCH];
+
+    /* Compute CRH(tr, msg) */
+    for (i = 0; i < n; ++i) {
+        memcpy(seedbuf[i], key, SEEDBYTES);
+        hpre[i] = tr;
+        hout[i] = seedbuf[i] + SEEDBYTES;
+    }
+    shake256_batch_prefixed(hout, CRHBYTES, hpre, SEEDBYTES, m, mlen, n);
+
+    /* Derive rhoprime as in deterministic signing */
+    for (i = 0; i < n; ++i) {
+        hin[i] = seedbuf[i];
+        hinlen[i] = SEEDBYTES + CRHBYTES;
+        hout[i] = rhoprime[i];
+    }
+    shake256_batch(hout, CRHBYTES, hin, hinlen, n);
+
+    for (i = 0; i < n; ++i) {
+        memcpy(buf[i].coeffs, seedbuf[i] + SEEDBYTES, CRHBYTES);
+        nonce[i] = 0;
+        act[i] = i;
+    }
+    nact = n;
+
+    while (nact > 0) {
+        for (u = 0; u < nact; ++u) {
+            i = act[u];
+            sign_commit(&z[i], &w0[i], &w1[i], mat, rhoprime[i], nonce[i]);
+            nonce[i] += L;
+            PQCLEAN_DILITHIUM3AES_AVX2_polyveck_pack_w1(buf[i].coeffs + CRHBYTES, &w1[i]);
+            hin[u] = buf[i].coeffs;
+            hinlen[u] = CRHBYTES + K * POLYW1_PACKEDBYTES;
+            hout[u] = sig[i];
+        }
+
+        /* Call the random oracle for all unfinished messages */
+        shake256_batch(hout, SEEDBYTES, hin, hinlen, nact);
+
+        /* Keep the messages whose attempt was rejected */
+        j = 0;
+        for (u = 0; u < nact; ++u) {
+            i = act[u];
+            if (sign_finish(sig[i], &z[i], &w0[i], &w1[i], s1, s2, t0)) {
+                act[j++] = i;
+            } else {
+                siglen[i] = PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES;
+            }
+        }
+        nact = j;
+    }
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_batch
+*
+* Description: Computes signatures on n messages under one secret key.
+*              The key is unpacked and A expanded once for the whole batch.
+*              Output i equals that of PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature on m[i].
+*
+* Arguments:   - uint8_t *const *sig: pointers to the n output signatures
+*                                     (each of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
+*              - size_t *siglen: n output signature lengths
+*              - const uint8_t *const *m: pointers to the n messages
+*              - const size_t *mlen: lengths of the n messages
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*              - size_t n: number of messages
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_batch(uint8_t *const *sig, size_t *siglen, const uint8_t *const *m, const size_t *mlen, const uint8_t *sk, size_t n) {
+    size_t i, cnt;
+    uint8_t rho[SEEDBYTES], tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    PQCLEAN_DILITHIUM3AES_AVX2_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+
+    /* Expand matrix and transform vectors */
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_ntt(&s1);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&s2);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&t0);
+
+    for (i = 0; i < n; i += cnt) {
+        cnt = n - i < SIGN_BATCH ? n - i : SIGN_BATCH;
+        sign_batch_group(sig + i, siglen + i, m + i, mlen + i, cnt, tr, key, mat, &s1, &s2, &t0);
+    }
+
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_sk_expand
+*
+* Description: Expands a secret key for repeated signing: unpacks it,
+*              samples the matrix A and transforms A, s1, s2 and t0 to the
+*              NTT domain once, so that signing with
+*              PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_expanded skips this work.
+*              The expanded key holds secret material and must be protected
+*              like the secret key itself.
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*                              (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_sk_expand(uint8_t *esk, const uint8_t *sk) {
+    uint8_t rho[SEEDBYTES], tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    PQCLEAN_DILITHIUM3AES_AVX2_unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_ntt(&s1);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&s2);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&t0);
+
+    pack_expanded_sk(esk, tr, key, mat, &s1, &s2, &t0);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_expanded_derand
+*
+* Description: Computes signature from an expanded secret key. The output
+*              equals that of PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_derand
+*              on the secret key the expanded key was derived from.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *esk: pointer to expanded secret key
+*              - const uint8_t *coins: pointer to CRHBYTES random bytes, or NULL
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_expanded_derand(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk, const uint8_t *coins) {
+    uint8_t tr[SEEDBYTES], key[SEEDBYTES];
+    polyvecl mat[K], s1;
+    polyveck t0, s2;
+
+    unpack_expanded_sk(tr, key, mat, &s1, &s2, &t0, esk);
+    return signature_core(sig, siglen, m, mlen, tr, key, mat, &s1, &s2, &t0, coins);
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_expanded
+*
+* Description: Computes signature from an expanded secret key.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *esk: pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk) {
+    return PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_expanded_derand(sig, siglen, m, mlen, esk, NULL);
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_precompute
+*
+* Description: Computes entries for the commitment pool consumed by
+*              PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_precomputed.
+*              Each entry holds a fresh random masking vector y and the
+*              high and low bits of Ay. None of this depends on the message,
+*              so the pool can be refilled off the latency-critical path.
+*              Entries must be kept as secret as the key: a masking vector
+*              answered under two different challenges reveals s1. Each
+*              entry also records tr of the key, so that it is only ever
+*              used with that key.
+*
+* Arguments:   - uint8_t *pool: pointer to output entries (npre entries of
+*                               PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES bytes each)
+*              - size_t npre: number of entries to compute
+*              - const uint8_t *esk: pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_precompute(uint8_t *pool, size_t npre, const uint8_t *esk) {
+    const uint8_t *tr = esk + PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES - 2 * SEEDBYTES;
+    uint8_t rhoprime[CRHBYTES];
+    polyvecl mat[K], z;
+    polyveck w0, w1;
+
+    unpack_expanded_sk_matrix(mat, esk);
+    while (npre > 0) {
+        randombytes(rhoprime, CRHBYTES);
+        sign_commit(&z, &w0, &w1, mat, rhoprime, 0);
+        pack_precomputed(pool, tr, &z, &w0, &w1);
+        pool += PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES;
+        npre--;
+    }
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_precomputed
+*
+* Description: Computes a randomized signature from an expanded secret key,
+*              taking the commitments for the signing attempts from a pool
+*              filled by PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_precompute.
+*              Entries are taken from the end of the pool; every entry
+*              used, whether the attempt is accepted or rejected, is erased
+*              and *npool is decremented. If the pool runs empty the
+*              remaining attempts compute fresh commitments on the fly.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *esk: pointer to expanded secret key
+*              - uint8_t *pool: pointer to pool of precomputed commitments
+*              - size_t *npool: pointer to number of entries in the pool;
+*                               updated on return
+*
+* Returns 0 (success), or -1 if the next entry was computed under a
+* different key. No signature is written in that case; that entry and
+* the ones below it stay in the pool.
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_signature_precomputed(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk, uint8_t *pool, size_t *npool) {
+    uint8_t tr[SEEDBYTES], mu[CRHBYTES], rhoprime[CRHBYTES];
+    uint8_t *pre;
+    uint64_t nonce = 0;
+    polyvecl mat[K], s1, z;
+    polyveck s2, t0, w0, w1;
+    shake256incctx_inline state;
+
+    unpack_expanded_sk_vectors(tr, &s1, &s2, &t0, esk);
+
+    /* Compute CRH(tr, msg) */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, tr, SEEDBYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(mu, CRHBYTES, &state);
+
+    /* Erase each entry before using it so that no masking vector
+     * is ever answered twice */
+    while (*npool > 0) {
+        pre = pool + (*npool - 1) * PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES;
+        /* An entry computed under another key cannot give a valid signature */
+        if (memcmp(pre + PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES - SEEDBYTES, tr, SEEDBYTES) != 0) {
+            return -1;
+        }
+        *npool -= 1;
+        unpack_precomputed(&z, &w0, &w1, pre);
+        memset(pre, 0, PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PRECOMPUTEDBYTES);
+        if (!sign_respond(sig, mu, &z, &w0, &w1, &s1, &s2, &t0)) {
+            *siglen = PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES;
+            return 0;
+        }
+    }
+
+    /* Pool exhausted: continue with fresh commitments */
+    unpack_expanded_sk_matrix(mat, esk);
+    randombytes(rhoprime, CRHBYTES);
+rej:
+    sign_commit(&z, &w0, &w1, mat, rhoprime, nonce);
+    nonce += L;
+    if (sign_respond(sig, mu, &z, &w0, &w1, &s1, &s2, &t0)) {
+        goto rej;
     }
 
     *siglen = PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES;
@@ -266,6 +834,58 @@ int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign(uint8_t *sm, size_t *smlen, const uin
     return 0;
 }
 
+/*************************************************
+* Name:        verify_row
+*
+* Description: Computes row i of w1' = UseHint(h, Az - c*t1*2^D) and
+*              bit-packs it, decoding the hints of row i on the way.
+*
+* Arguments:   - uint8_t *w1buf: pointer to output byte array with at least
+*                                POLYW1_PACKEDBYTES + 14 bytes
+*              - unsigned int *pos: pointer to number of hints consumed
+*              - const polyvecl *row: pointer to row i of A
+*              - const poly *t1: pointer to row i of NTT(t1*2^D)
+*              - const polyvecl *z: pointer to NTT(z)
+*              - const poly *c: pointer to NTT(c)
+*              - const uint8_t *hint: pointer to hints of the signature
+*              - unsigned int i: row index
+*
+* Returns 0 if the hints are well-formed and -1 otherwise
+**************************************************/
+static int verify_row(uint8_t *w1buf, unsigned int *pos, const polyvecl *row, const poly *t1,
+                      const polyvecl *z, const poly *c, const uint8_t *hint, unsigned int i) {
+    unsigned int j;
+    poly w1, h;
+
+    /* Compute i-th row of Az - c2^Dt1 */
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_pointwise_acc_montgomery(&w1, row, z);
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&h, c, t1);
+
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_sub(&w1, &w1, &h);
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_reduce(&w1);
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_invntt_tomont(&w1);
+
+    /* Get hint polynomial and reconstruct w1 */
+    memset(h.vec, 0, sizeof(poly));
+    if (hint[OMEGA + i] < *pos || hint[OMEGA + i] > OMEGA) {
+        return -1;
+    }
+
+    for (j = *pos; j < hint[OMEGA + i]; ++j) {
+        /* Coefficients are ordered for strong unforgeability */
+        if (j > *pos && hint[j] <= hint[j - 1]) {
+            return -1;
+        }
+        h.coeffs[hint[j]] = 1;
+    }
+    *pos = hint[OMEGA + i];
+
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_caddq(&w1);
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_use_hint(&w1, &w1, &h);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyw1_pack(w1buf, &w1);
+    return 0;
+}
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify
 *
@@ -290,8 +910,8 @@ int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify(const uint8_t *sig, size_t sig
     polyvecl rowbuf[1];
     polyvecl *row = rowbuf;
     polyvecl z;
-    poly c, w1, h;
-    shake256incctx state;
+    poly c, h;
+    shake256incctx_inline state;
 
     if (siglen != PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES) {
         return -1;
@@ -299,12 +919,11 @@ int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify(const uint8_t *sig, size_t sig
 
     /* Compute CRH(H(rho, t1), msg) */
     shake256(mu, SEEDBYTES, pk, PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PUBLICKEYBYTES);
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, mu, SEEDBYTES);
-    shake256_inc_absorb(&state, m, mlen);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(mu, CRHBYTES, &state);
-    shake256_inc_ctx_release(&state);
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, mu, SEEDBYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(mu, CRHBYTES, &state);
 
     /* Expand PQCLEAN_DILITHIUM3AES_AVX2_challenge */
     PQCLEAN_DILITHIUM3AES_AVX2_poly_challenge(&c, sig);
@@ -327,36 +946,123 @@ int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify(const uint8_t *sig, size_t sig
             PQCLEAN_DILITHIUM3AES_AVX2_poly_nttunpack(&row->vec[j]);
         }
 
-        /* Compute i-th row of Az - c2^Dt1 */
-        PQCLEAN_DILITHIUM3AES_AVX2_polyvecl_pointwise_acc_montgomery(&w1, row, &z);
-
         PQCLEAN_DILITHIUM3AES_AVX2_polyt1_unpack(&h, pk + SEEDBYTES + i * POLYT1_PACKEDBYTES);
         PQCLEAN_DILITHIUM3AES_AVX2_poly_shiftl(&h);
         PQCLEAN_DILITHIUM3AES_AVX2_poly_ntt(&h);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_pointwise_montgomery(&h, &c, &h);
 
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_sub(&w1, &w1, &h);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_reduce(&w1);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_invntt_tomont(&w1);
+        /* Compute i-th row of w1' */
+        if (verify_row(buf.coeffs + i * POLYW1_PACKEDBYTES, &pos, row, &h, &z, &c, hint, i)) {
+            return -1;
+        }
+    }
 
-        /* Get hint polynomial and reconstruct w1 */
-        memset(h.vec, 0, sizeof(poly));
-        if (hint[OMEGA + i] < pos || hint[OMEGA + i] > OMEGA) {
+    /* Extra indices are zero for strong unforgeability */
+    for (j = pos; j < OMEGA; ++j) {
+        if (hint[j]) {
             return -1;
         }
+    }
 
-        for (j = pos; j < hint[OMEGA + i]; ++j) {
-            /* Coefficients are ordered for strong unforgeability */
-            if (j > pos && hint[j] <= hint[j - 1]) {
-                return -1;
-            }
-            h.coeffs[hint[j]] = 1;
+    /* Call random oracle and verify PQCLEAN_DILITHIUM3AES_AVX2_challenge */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, mu, CRHBYTES);
+    shake256_inc_absorb_inline(&state, buf.coeffs, K * POLYW1_PACKEDBYTES);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(buf.coeffs, SEEDBYTES, &state);
+    for (i = 0; i < SEEDBYTES; ++i) {
+        if (buf.coeffs[i] != sig[i]) {
+            return -1;
         }
-        pos = hint[OMEGA + i];
+    }
+
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_pk_expand
+*
+* Description: Expands a public key for repeated verification: caches
+*              the matrix A and t1*2^D in NTT domain, followed by
+*              tr = H(pk), so that PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify_expanded
+*              does not hash the public key, sample A or transform t1 again.
+*
+* Arguments:   - uint8_t *epk: pointer to output expanded public key
+*                              (of length PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES)
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_pk_expand(uint8_t *epk, const uint8_t *pk) {
+    uint8_t rho[SEEDBYTES];
+    polyvecl mat[K];
+    polyveck t1;
+
+    PQCLEAN_DILITHIUM3AES_AVX2_unpack_pk(rho, &t1, pk);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyvec_matrix_expand(mat, rho);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_shiftl(&t1);
+    PQCLEAN_DILITHIUM3AES_AVX2_polyveck_ntt(&t1);
+
+    memcpy(epk, mat, K * sizeof(polyvecl));
+    memcpy(epk + K * sizeof(polyvecl), &t1, sizeof(polyveck));
+    shake256(epk + K * sizeof(polyvecl) + sizeof(polyveck), SEEDBYTES, pk, PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PUBLICKEYBYTES);
+    return 0;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify_expanded
+*
+* Description: Verifies signature against an expanded public key.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk) {
+    unsigned int i, j, pos = 0;
+    /* PQCLEAN_DILITHIUM3AES_AVX2_polyw1_pack writes additional 14 bytes */
+    ALIGNED_UINT8(K * POLYW1_PACKEDBYTES + 14) buf;
+    uint8_t mu[CRHBYTES];
+    const uint8_t *hint = sig + SEEDBYTES + L * POLYZ_PACKEDBYTES;
+    const uint8_t *t1 = epk + K * sizeof(polyvecl);
+    const uint8_t *tr = t1 + sizeof(polyveck);
+    polyvecl row, z;
+    poly c, h;
+    shake256incctx_inline state;
 
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_caddq(&w1);
-        PQCLEAN_DILITHIUM3AES_AVX2_poly_use_hint(&w1, &w1, &h);
-        PQCLEAN_DILITHIUM3AES_AVX2_polyw1_pack(buf.coeffs + i * POLYW1_PACKEDBYTES, &w1);
+    if (siglen != PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES) {
+        return -1;
+    }
+
+    /* Compute CRH(H(rho, t1), msg) */
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, tr, SEEDBYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(mu, CRHBYTES, &state);
+
+    /* Expand PQCLEAN_DILITHIUM3AES_AVX2_challenge */
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_challenge(&c, sig);
+    PQCLEAN_DILITHIUM3AES_AVX2_poly_ntt(&c);
+
+    /* Unpack z; shortness follows from unpacking */
+    for (i = 0; i < L; i++) {
+        PQCLEAN_DILITHIUM3AES_AVX2_polyz_unpack(&z.vec[i], sig + SEEDBYTES + i * POLYZ_PACKEDBYTES);
+        PQCLEAN_DILITHIUM3AES_AVX2_poly_ntt(&z.vec[i]);
+    }
+
+    for (i = 0; i < K; i++) {
+        /* Load matrix row and NTT(t1*2^D) from the expanded key */
+        memcpy(&row, epk + i * sizeof(polyvecl), sizeof(polyvecl));
+        memcpy(&h, t1 + i * sizeof(poly), sizeof(poly));
+
+        /* Compute i-th row of w1' */
+        if (verify_row(buf.coeffs + i * POLYW1_PACKEDBYTES, &pos, &row, &h, &z, &c, hint, i)) {
+            return -1;
+        }
     }
 
     /* Extra indices are zero for strong unforgeability */
@@ -367,12 +1073,11 @@ int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify(const uint8_t *sig, size_t sig
     }
 
     /* Call random oracle and verify PQCLEAN_DILITHIUM3AES_AVX2_challenge */
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, mu, CRHBYTES);
-    shake256_inc_absorb(&state, buf.coeffs, K * POLYW1_PACKEDBYTES);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(buf.coeffs, SEEDBYTES, &state);
-    shake256_inc_ctx_release(&state);
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, mu, CRHBYTES);
+    shake256_inc_absorb_inline(&state, buf.coeffs, K * POLYW1_PACKEDBYTES);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(buf.coeffs, SEEDBYTES, &state);
     for (i = 0; i < SEEDBYTES; ++i) {
         if (buf.coeffs[i] != sig[i]) {
             return -1;
@@ -382,6 +1087,186 @@ int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify(const uint8_t *sig, size_t sig
     return 0;
 }
 
+/*************************************************
+* Name:        verify_batch_group
+*
+* Description: Verifies up to VERIFY_BATCH signatures. H(pk), mu and the
+*              final challenge hash of all signatures are computed together
+*              with the batched SHAKE256 API; signatures under the same
+*              public key share one pass over the rows of A and t1.
+*
+* Arguments:   as PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify_batch, with n <= VERIFY_BATCH
+*
+* Returns 0 if all signatures could be verified correctly and -1 otherwise
+**************************************************/
+static int verify_batch_group(int *results, const uint8_t *const *sig, const size_t *siglen, const uint8_t *const *m,
+                              const size_t *mlen, const uint8_t *const *pk, size_t n) {
+    unsigned int r, pos[VERIFY_BATCH];
+    size_t i, j, u, nkeys = 0, nsig = 0;
+    size_t key[VERIFY_BATCH], idx[VERIFY_BATCH];
+    int ok[VERIFY_BATCH];
+    int used, res = 0;
+    const uint8_t *hint;
+    uint8_t tr[VERIFY_BATCH][SEEDBYTES];
+    uint8_t c2[VERIFY_BATCH][SEEDBYTES];
+    /* mu || w1' per signature; PQCLEAN_DILITHIUM3AES_AVX2_polyw1_pack writes additional 14 bytes */
+    ALIGNED_UINT8(CRHBYTES + K * POLYW1_PACKEDBYTES + 14) buf[VERIFY_BATCH];
+    uint8_t *hout[VERIFY_BATCH];
+    const uint8_t *hin[VERIFY_BATCH];
+    const uint8_t *hpre[VERIFY_BATCH];
+    size_t hinlen[VERIFY_BATCH];
+    uint64_t nonce;
+    aes256ctr_ctx aesctx;
+    polyvecl rowbuf[1];
+    polyvecl *row = rowbuf;
+    polyvecl z[VERIFY_BATCH];
+    poly c[VERIFY_BATCH], t1;
+
+    /* Find distinct public keys and hash them */
+    for (i = 0; i < n; ++i) {
+        ok[i] = siglen[i] == PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_BYTES;
+        for (j = 0; j < nkeys; ++j) {
+            if (pk[idx[j]] == pk[i] || memcmp(pk[idx[j]], pk[i], PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PUBLICKEYBYTES) == 0) {
+                break;
+            }
+        }
+        if (j == nkeys) {
+            idx[nkeys] = i;
+            hin[nkeys] = pk[i];
+            hinlen[nkeys] = PQCLEAN_DILITHIUM3AES_AVX2_CRYPTO_PUBLICKEYBYTES;
+            hout[nkeys] = tr[nkeys];
+            nkeys++;
+        }
+        key[i] = j;
+    }
+    shake256_batch(hout, SEEDBYTES, hin, hinlen, nkeys);
+
+    /* Compute CRH(H(rho, t1), msg) */
+    for (i = 0; i < n; ++i) {
+        hpre[i] = tr[key[i]];
+        hout[i] = buf[i].coeffs;
+    }
+    shake256_batch_prefixed(hout, CRHBYTES, hpre, SEEDBYTES, m, mlen, n);
+
+    /* Expand challenges and unpack z; shortness follows from unpacking */
+    for (i = 0; i < n; ++i) {
+        if (ok[i]) {
+            pos[i] = 0;
+            PQCLEAN_DILITHIUM3AES_AVX2_poly_challenge(&c[i], sig[i]);
+            PQCLEAN_DILITHIUM3AES_AVX2_poly_ntt(&c[i]);
+            for (j = 0; j < L; j++) {
+                PQCLEAN_DILITHIUM3AES_AVX2_polyz_unpack(&z[i].vec[j], sig[i] + SEEDBYTES + j * POLYZ_PACKEDBYTES);
+                PQCLEAN_DILITHIUM3AES_AVX2_poly_ntt(&z[i].vec[j]);
+            }
+        }
+    }
+
+    /* Stream the rows of A and t1 once per public key */
+    for (u = 0; u < nkeys; ++u) {
+        used = 0;
+        for (i = 0; i < n; ++i) {
+            used |= key[i] == u && ok[i];
+        }
+        if (!used) {
+            continue;
+        }
+
+        PQCLEAN_DILITHIUM3AES_AVX2_aes256ctr_init(&aesctx, pk[idx[u]], 0);
+
+        for (r = 0; r < K; r++) {
+            /* Expand matrix row */
+            for (j = 0; j < L; j++) {
+                nonce = (r << 8) + j;
+                aesctx.n = _mm_loadl_epi64((__m128i *)&nonce);
+                PQCLEAN_DILITHIUM3AES_AVX2_poly_uniform_preinit(&row->vec[j], &aesctx);
+                PQCLEAN_DILITHIUM3AES_AVX2_poly_nttunpack(&row->vec[j]);
+            }
+
+            PQCLEAN_DILITHIUM3AES_AVX2_polyt1_unpack(&t1, pk[idx[u]] + SEEDBYTES + r * POLYT1_PACKEDBYTES);
+            PQCLEAN_DILITHIUM3AES_AVX2_poly_shiftl(&t1);
+            PQCLEAN_DILITHIUM3AES_AVX2_poly_ntt(&t1);
+
+            for (i = 0; i < n; ++i) {
+                if (key[i] != u || !ok[i]) {
+                    continue;
+                }
+                hint = sig[i] + SEEDBYTES + L * POLYZ_PACKEDBYTES;
+                if (verify_row(buf[i].coeffs + CRHBYTES + r * POLYW1_PACKEDBYTES, &pos[i], row, &t1, &z[i], &c[i], hint, r)) {
+                    ok[i] = 0;
+                }
+            }
+        }
+    }
+
+    /* Extra indices are zero for strong unforgeability */
+    for (i = 0; i < n; ++i) {
+        if (!ok[i]) {
+            continue;
+        }
+        hint = sig[i] + SEEDBYTES + L * POLYZ_PACKEDBYTES;
+        for (j = pos[i]; j < OMEGA; ++j) {
+            if (hint[j]) {
+                ok[i] = 0;
+            }
+        }
+    }
+
+    /* Call random oracle on all well-formed signatures */
+    for (i = 0; i < n; ++i) {
+        if (ok[i]) {
+            hin[nsig] = buf[i].coeffs;
+            hinlen[nsig] = CRHBYTES + K * POLYW1_PACKEDBYTES;
+            hout[nsig] = c2[i];
+            nsig++;
+        }
+    }
+    shake256_batch(hout, SEEDBYTES, hin, hinlen, nsig);
+
+    for (i = 0; i < n; ++i) {
+        if (ok[i] && memcmp(c2[i], sig[i], SEEDBYTES) != 0) {
+            ok[i] = 0;
+        }
+        results[i] = ok[i] ? 0 : -1;
+        if (!ok[i]) {
+            res = -1;
+        }
+    }
+
+    return res;
+}
+
+/*************************************************
+* Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify_batch
+*
+* Description: Verifies n independent signatures. The result for
+*              signature i is written to results[i].
+*
+* Arguments:   - int *results: pointer to n outputs, 0 if signature i
+*                              could be verified correctly and -1 otherwise
+*              - const uint8_t *const *sig: pointers to the n signatures
+*              - const size_t *siglen: lengths of the n signatures
+*              - const uint8_t *const *m: pointers to the n messages
+*              - const size_t *mlen: lengths of the n messages
+*              - const uint8_t *const *pk: pointers to the n bit-packed
+*                                          public keys; may repeat
+*              - size_t n: number of signatures
+*
+* Returns 0 if all signatures could be verified correctly and -1 otherwise
+**************************************************/
+int PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_verify_batch(int *results, const uint8_t *const *sig, const size_t *siglen, const uint8_t *const *m, const size_t *mlen, const uint8_t *const *pk, size_t n) {
+    size_t i, cnt;
+    int res = 0;
+
+    for (i = 0; i < n; i += cnt) {
+        cnt = n - i < VERIFY_BATCH ? n - i : VERIFY_BATCH;
+        if (verify_batch_group(results + i, sig + i, siglen + i, m + i, mlen + i, pk + i, cnt)) {
+            res = -1;
+        }
+    }
+
+    return res;
+}
+
 /*************************************************
 * Name:        PQCLEAN_DILITHIUM3AES_AVX2_crypto_sign_open
 *
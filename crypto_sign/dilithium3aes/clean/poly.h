@@ -49,4 +49,6 @@ void PQCLEAN_DILITHIUM3AES_CLEAN_polyz_unpack(poly *r, const uint8_t *a);
 
 void PQCLEAN_DILITHIUM3AES_CLEAN_polyw1_pack(uint8_t *r, const poly *a);
 
+void PQCLEAN_DILITHIUM3AES_CLEAN_polyw1_unpack(poly *r, const uint8_t *a);
+
 #endif
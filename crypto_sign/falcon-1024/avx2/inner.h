@@ -113,12 +113,12 @@ set_fpu_cw(unsigned x) {
 
 
 
-#define inner_shake256_context                shake256incctx
-#define inner_shake256_init(sc)               shake256_inc_init(sc)
-#define inner_shake256_inject(sc, in, len)    shake256_inc_absorb(sc, in, len)
-#define inner_shake256_flip(sc)               shake256_inc_finalize(sc)
-#define inner_shake256_extract(sc, out, len)  shake256_inc_squeeze(out, len, sc)
-#define inner_shake256_ctx_release(sc)        shake256_inc_ctx_release(sc)
+#define inner_shake256_context                shake256incctx_inline
+#define inner_shake256_init(sc)               shake256_inc_init_inline(sc)
+#define inner_shake256_inject(sc, in, len)    shake256_inc_absorb_inline(sc, in, len)
+#define inner_shake256_flip(sc)               shake256_inc_finalize_inline(sc)
+#define inner_shake256_extract(sc, out, len)  shake256_inc_squeeze_inline(out, len, sc)
+#define inner_shake256_ctx_release(sc)
 
 
 /* ==================================================================== */
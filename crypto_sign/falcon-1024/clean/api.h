@@ -7,6 +7,7 @@
 #define PQCLEAN_FALCON1024_CLEAN_CRYPTO_SECRETKEYBYTES   2305
 #define PQCLEAN_FALCON1024_CLEAN_CRYPTO_PUBLICKEYBYTES   1793
 #define PQCLEAN_FALCON1024_CLEAN_CRYPTO_BYTES            1330
+#define PQCLEAN_FALCON1024_CLEAN_CRYPTO_SIGNCOINBYTES    88
 
 #define PQCLEAN_FALCON1024_CLEAN_CRYPTO_ALGNAME          "Falcon-1024"
 
@@ -35,6 +36,18 @@ int PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature(
     uint8_t *sig, size_t *siglen,
     const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+/*
+ * Same as PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature(), but the randomness is
+ * taken from coins[] (PQCLEAN_FALCON1024_CLEAN_CRYPTO_SIGNCOINBYTES bytes) instead
+ * of randombytes(). coins[] must not overlap sig[].
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_derand(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk,
+    const uint8_t *coins);
+
 /*
  * Verify a signature (sig, siglen) on a message (m, mlen) with a given
  * public key (pk).
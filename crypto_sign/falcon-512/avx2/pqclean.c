@@ -109,7 +109,9 @@ PQCLEAN_FALCON512_AVX2_crypto_sign_keypair(unsigned char *pk, unsigned char *sk)
 
 /*
  * Compute the signature. nonce[] receives the nonce and must have length
- * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
+ * NONCELEN bytes. coins[] holds the NONCELEN bytes of the nonce followed
+ * by the SEEDLEN bytes that seed the sampler RNG; it must not overlap
+ * nonce[]. sigbuf[] receives the signature value (without nonce
  * or header byte), with *sigbuflen providing the maximum value length and
  * receiving the actual value length.
  *
@@ -123,7 +125,8 @@ PQCLEAN_FALCON512_AVX2_crypto_sign_keypair(unsigned char *pk, unsigned char *sk)
  */
 static int
 do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
-        const uint8_t *m, size_t mlen, const uint8_t *sk) {
+        const uint8_t *m, size_t mlen, const uint8_t *sk,
+        const uint8_t *coins) {
     union {
         uint8_t b[72 * 512];
         uint64_t dummy_u64;
@@ -134,7 +137,6 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
         int16_t sig[512];
         uint16_t hm[512];
     } r;
-    unsigned char seed[SEEDLEN];
     inner_shake256_context sc;
     size_t u, v;
 
@@ -174,9 +176,9 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     }
 
     /*
-     * Create a random nonce (40 bytes).
+     * Copy the random nonce (40 bytes).
      */
-    randombytes(nonce, NONCELEN);
+    memcpy(nonce, coins, NONCELEN);
 
     /*
      * Hash message nonce + message into a vector.
@@ -191,9 +193,8 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     /*
      * Initialize a RNG.
      */
-    randombytes(seed, sizeof seed);
     inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, seed, sizeof seed);
+    inner_shake256_inject(&sc, coins + NONCELEN, SEEDLEN);
     inner_shake256_flip(&sc);
 
     /*
@@ -273,9 +274,10 @@ do_verify(
 
 /* see api.h */
 int
-PQCLEAN_FALCON512_AVX2_crypto_sign_signature(
+PQCLEAN_FALCON512_AVX2_crypto_sign_signature_derand(
     uint8_t *sig, size_t *siglen,
-    const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    const uint8_t *m, size_t mlen, const uint8_t *sk,
+    const uint8_t *coins) {
     /*
      * The PQCLEAN_FALCON512_AVX2_CRYPTO_BYTES constant is used for
      * the signed message object (as produced by PQCLEAN_FALCON512_AVX2_crypto_sign())
@@ -290,7 +292,7 @@ PQCLEAN_FALCON512_AVX2_crypto_sign_signature(
     size_t vlen;
 
     vlen = PQCLEAN_FALCON512_AVX2_CRYPTO_BYTES - NONCELEN - 3;
-    if (do_sign(sig + 1, sig + 1 + NONCELEN, &vlen, m, mlen, sk) < 0) {
+    if (do_sign(sig + 1, sig + 1 + NONCELEN, &vlen, m, mlen, sk, coins) < 0) {
         return -1;
     }
     sig[0] = 0x30 + 9;
@@ -298,6 +300,18 @@ PQCLEAN_FALCON512_AVX2_crypto_sign_signature(
     return 0;
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON512_AVX2_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    uint8_t coins[NONCELEN + SEEDLEN];
+
+    randombytes(coins, NONCELEN);
+    randombytes(coins + NONCELEN, SEEDLEN);
+    return PQCLEAN_FALCON512_AVX2_crypto_sign_signature_derand(sig, siglen, m, mlen, sk, coins);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AVX2_crypto_sign_verify(
@@ -320,6 +334,7 @@ PQCLEAN_FALCON512_AVX2_crypto_sign(
     const uint8_t *m, size_t mlen, const uint8_t *sk) {
     uint8_t *pm, *sigbuf;
     size_t sigbuflen;
+    uint8_t coins[NONCELEN + SEEDLEN];
 
     /*
      * Move the message to its final location; this is a memmove() so
@@ -329,7 +344,9 @@ PQCLEAN_FALCON512_AVX2_crypto_sign(
     pm = sm + 2 + NONCELEN;
     sigbuf = pm + 1 + mlen;
     sigbuflen = PQCLEAN_FALCON512_AVX2_CRYPTO_BYTES - NONCELEN - 3;
-    if (do_sign(sm + 2, sigbuf, &sigbuflen, pm, mlen, sk) < 0) {
+    randombytes(coins, NONCELEN);
+    randombytes(coins + NONCELEN, SEEDLEN);
+    if (do_sign(sm + 2, sigbuf, &sigbuflen, pm, mlen, sk, coins) < 0) {
         return -1;
     }
     pm[mlen] = 0x20 + 9;
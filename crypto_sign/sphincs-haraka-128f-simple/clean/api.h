@@ -12,6 +12,7 @@
 #define PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_CRYPTO_PUBLICKEYBYTES 32
 #define PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_CRYPTO_BYTES 17088
 #define PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_CRYPTO_SEEDBYTES 48
+#define PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_CRYPTO_SIGNCOINBYTES 16
 
 
 /*
@@ -50,6 +51,16 @@ int PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_crypto_sign_seed_keypair(
 int PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_crypto_sign_keypair(
     uint8_t *pk, uint8_t *sk);
 
+/**
+ * Returns an array containing a detached signature, using coins
+ * (PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_CRYPTO_SIGNCOINBYTES bytes)
+ * as the optional signing randomness.
+ */
+int PQCLEAN_SPHINCSHARAKA128FSIMPLE_CLEAN_crypto_sign_signature_derand(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk,
+    const uint8_t *coins);
+
 /**
  * Returns an array containing a detached signature.
  */
@@ -21,6 +21,6 @@
  */
 
 #include "sha2.h"
-#define hash_state sha256ctx
+#define hash_state sha256ctx_inline
 
 #endif
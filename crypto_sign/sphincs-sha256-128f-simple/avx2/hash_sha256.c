@@ -24,8 +24,9 @@ void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_initialize_hash_function(
 /**
  * Cleans up the hash function states
  */
-void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_destroy_hash_function(hash_state *hash_state_seeded) {
-    sha256_inc_ctx_release(&hash_state_seeded->x1);
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_destroy_hash_function(
+    hash_state *hash_state_seeded) { // NOLINT(readability-non-const-parameter)
+    (void)hash_state_seeded;
 }
 
 /*
@@ -58,7 +59,7 @@ void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_gen_message_random(
     const unsigned char *sk_prf, const unsigned char *optrand,
     const unsigned char *m, size_t mlen, const hash_state *hash_state_seeded) {
     unsigned char buf[PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_OUTPUT_BYTES];
-    sha256ctx state;
+    sha256ctx_inline state;
     int i;
 
     /* This implements HMAC-SHA256 */
@@ -67,25 +68,25 @@ void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_gen_message_random(
     }
     memset(buf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N, 0x36, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
 
-    sha256_inc_init(&state);
-    sha256_inc_blocks(&state, buf, 1);
+    sha256_inc_init_inline(&state);
+    sha256_inc_blocks_inline(&state, buf, 1);
 
     memcpy(buf, optrand, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
 
     /* If optrand + message cannot fill up an entire block */
     if (PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N + mlen < PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES) {
         memcpy(buf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N, m, mlen);
-        sha256_inc_finalize(buf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES, &state,
-                            buf, mlen + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
+        sha256_inc_finalize_inline(buf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES, &state,
+                                   buf, mlen + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
     }
     /* Otherwise first fill a block, so that finalize only uses the message */
     else {
         memcpy(buf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N, m, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
-        sha256_inc_blocks(&state, buf, 1);
+        sha256_inc_blocks_inline(&state, buf, 1);
 
         m += PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N;
         mlen -= PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N;
-        sha256_inc_finalize(buf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES, &state, m, mlen);
+        sha256_inc_finalize_inline(buf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES, &state, m, mlen);
     }
 
     for (i = 0; i < PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N; i++) {
@@ -124,9 +125,9 @@ void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_hash_message(
 
     unsigned char buf[PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_DGST_BYTES];
     unsigned char *bufp = buf;
-    sha256ctx state;
+    sha256ctx_inline state;
 
-    sha256_inc_init(&state);
+    sha256_inc_init_inline(&state);
 
     memcpy(inbuf, R, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
     memcpy(inbuf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N, pk, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES);
@@ -134,17 +135,17 @@ void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_hash_message(
     /* If R + pk + message cannot fill up an entire block */
     if (PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES + mlen < PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_INBLOCKS * PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES) {
         memcpy(inbuf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES, m, mlen);
-        sha256_inc_finalize(seed, &state, inbuf, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES + mlen);
+        sha256_inc_finalize_inline(seed, &state, inbuf, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES + mlen);
     }
     /* Otherwise first fill a block, so that finalize only uses the message */
     else {
         memcpy(inbuf + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES, m,
                PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_INBLOCKS * PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES);
-        sha256_inc_blocks(&state, inbuf, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_INBLOCKS);
+        sha256_inc_blocks_inline(&state, inbuf, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_INBLOCKS);
 
         m += PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_INBLOCKS * PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES;
         mlen -= PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_INBLOCKS * PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N - PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_PK_BYTES;
-        sha256_inc_finalize(seed, &state, m, mlen);
+        sha256_inc_finalize_inline(seed, &state, m, mlen);
     }
 
     /* By doing this in two steps, we prevent hashing the message twice;
@@ -126,17 +126,18 @@ int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_keypair(
 }
 
 /**
- * Returns an array containing a detached signature.
+ * Returns an array containing a detached signature, using the N bytes
+ * at coins as the optional signing randomness.
  */
-int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_signature(
+int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_signature_derand(
     uint8_t *sig, size_t *siglen,
-    const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    const uint8_t *m, size_t mlen, const uint8_t *sk,
+    const uint8_t *coins) {
     const unsigned char *sk_seed = sk;
     const unsigned char *sk_prf = sk + PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N;
     const unsigned char *pk = sk + 2 * PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N;
     const unsigned char *pub_seed = pk;
 
-    unsigned char optrand[PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N];
     unsigned char mhash[PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_FORS_MSG_BYTES];
     unsigned char root[PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N];
     uint32_t i;
@@ -158,13 +159,9 @@ int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_signature(
     PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_set_type(
         tree_addr, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_ADDR_TYPE_HASHTREE);
 
-    /* Optionally, signing can be made non-deterministic using optrand.
-       This can help counter side-channel attacks that would benefit from
-       getting a large number of traces when the signer uses the same nodes. */
-    randombytes(optrand, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
     /* Compute the digest randomization value. */
     PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_gen_message_random(
-        sig, sk_prf, optrand, m, mlen, &hash_state_seeded);
+        sig, sk_prf, coins, m, mlen, &hash_state_seeded);
 
     /* Derive the message digest and leaf index from R, PK and M. */
     PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_hash_message(
@@ -211,6 +208,21 @@ int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_signature(
     return 0;
 }
 
+/**
+ * Returns an array containing a detached signature.
+ */
+int PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_signature(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    unsigned char optrand[PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N];
+
+    /* Optionally, signing can be made non-deterministic using optrand.
+       This can help counter side-channel attacks that would benefit from
+       getting a large number of traces when the signer uses the same nodes. */
+    randombytes(optrand, PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_N);
+    return PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX2_crypto_sign_signature_derand(sig, siglen, m, mlen, sk, optrand);
+}
+
 /**
  * Verifies a detached signature and message under a given public key.
  */
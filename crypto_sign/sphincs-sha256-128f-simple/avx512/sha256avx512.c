@@ -0,0 +1,269 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "sha256avx512.h"
+
+// Transpose 16 vectors containing 32-bit values
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_transpose16(u512 s[16]) {
+    u512 tmp0[16];
+    u512 tmp1[16];
+    u512 tmp2[16];
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        tmp0[2 * i] = _mm512_unpacklo_epi32(s[2 * i], s[2 * i + 1]);
+        tmp0[2 * i + 1] = _mm512_unpackhi_epi32(s[2 * i], s[2 * i + 1]);
+    }
+    for (i = 0; i < 4; i++) {
+        tmp1[4 * i + 0] = _mm512_unpacklo_epi64(tmp0[4 * i + 0], tmp0[4 * i + 2]);
+        tmp1[4 * i + 1] = _mm512_unpackhi_epi64(tmp0[4 * i + 0], tmp0[4 * i + 2]);
+        tmp1[4 * i + 2] = _mm512_unpacklo_epi64(tmp0[4 * i + 1], tmp0[4 * i + 3]);
+        tmp1[4 * i + 3] = _mm512_unpackhi_epi64(tmp0[4 * i + 1], tmp0[4 * i + 3]);
+    }
+    /* Each 128-bit lane of tmp1[4 * i + j] now holds one column of the 4x4
+       block in rows 4i..4i+3; gather the four lanes of each column. */
+    for (i = 0; i < 4; i++) {
+        tmp2[i + 0] = _mm512_shuffle_i32x4(tmp1[i + 0], tmp1[i + 4], 0x88);
+        tmp2[i + 4] = _mm512_shuffle_i32x4(tmp1[i + 0], tmp1[i + 4], 0xdd);
+        tmp2[i + 8] = _mm512_shuffle_i32x4(tmp1[i + 8], tmp1[i + 12], 0x88);
+        tmp2[i + 12] = _mm512_shuffle_i32x4(tmp1[i + 8], tmp1[i + 12], 0xdd);
+    }
+    for (i = 0; i < 4; i++) {
+        s[i + 0] = _mm512_shuffle_i32x4(tmp2[i + 0], tmp2[i + 8], 0x88);
+        s[i + 4] = _mm512_shuffle_i32x4(tmp2[i + 4], tmp2[i + 12], 0x88);
+        s[i + 8] = _mm512_shuffle_i32x4(tmp2[i + 0], tmp2[i + 8], 0xdd);
+        s[i + 12] = _mm512_shuffle_i32x4(tmp2[i + 4], tmp2[i + 12], 0xdd);
+    }
+}
+
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_clone_statex16(sha256ctxx16 *outctx, const sha256ctxx16 *inctx) {
+    memcpy(outctx, inctx, sizeof(sha256ctxx16));
+}
+
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_init16x(sha256ctxx16 *ctx) {
+    ctx->s[0] = _mm512_set1_epi32((int)0x6a09e667);
+    ctx->s[1] = _mm512_set1_epi32((int)0xbb67ae85);
+    ctx->s[2] = _mm512_set1_epi32((int)0x3c6ef372);
+    ctx->s[3] = _mm512_set1_epi32((int)0xa54ff53a);
+    ctx->s[4] = _mm512_set1_epi32((int)0x510e527f);
+    ctx->s[5] = _mm512_set1_epi32((int)0x9b05688c);
+    ctx->s[6] = _mm512_set1_epi32((int)0x1f83d9ab);
+    ctx->s[7] = _mm512_set1_epi32((int)0x5be0cd19);
+
+    ctx->datalen = 0;
+    ctx->msglen = 0;
+}
+
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_update16x(sha256ctxx16 *ctx,
+        const unsigned char *const in[16],
+        unsigned long long len) {
+    size_t i = 0;
+    size_t bytes_to_copy;
+    unsigned int j;
+
+    while (i < len) {
+        bytes_to_copy = (size_t)len - i;
+        if (bytes_to_copy > 64 - ctx->datalen) {
+            bytes_to_copy = 64 - ctx->datalen;
+        }
+        for (j = 0; j < 16; j++) {
+            memcpy(&ctx->msgblocks[64 * j + ctx->datalen], in[j] + i, bytes_to_copy);
+        }
+        ctx->datalen += (unsigned int)bytes_to_copy;
+        i += bytes_to_copy;
+        if (ctx->datalen == 64) {
+            PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_transform16x(ctx, ctx->msgblocks);
+            ctx->msglen += 512;
+            ctx->datalen = 0;
+        }
+    }
+}
+
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_final16x(sha256ctxx16 *ctx,
+        unsigned char *const out[16]) {
+    u512 s[16];
+    unsigned int i, curlen;
+
+    // Padding
+    for (i = 0; i < 16; ++i) {
+        curlen = ctx->datalen;
+        ctx->msgblocks[64 * i + curlen++] = 0x80;
+        while (curlen < 64) {
+            ctx->msgblocks[64 * i + curlen++] = 0x00;
+        }
+    }
+    if (ctx->datalen >= 56) {
+        PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_transform16x(ctx, ctx->msgblocks);
+        memset(ctx->msgblocks, 0, 16 * 64);
+    }
+
+    // Add length of the message to each block
+    ctx->msglen += ctx->datalen * 8;
+    for (i = 0; i < 16; i++) {
+        ctx->msgblocks[64 * i + 63] = (unsigned char)ctx->msglen;
+        ctx->msgblocks[64 * i + 62] = (unsigned char)(ctx->msglen >> 8);
+        ctx->msgblocks[64 * i + 61] = (unsigned char)(ctx->msglen >> 16);
+        ctx->msgblocks[64 * i + 60] = (unsigned char)(ctx->msglen >> 24);
+        ctx->msgblocks[64 * i + 59] = (unsigned char)(ctx->msglen >> 32);
+        ctx->msgblocks[64 * i + 58] = (unsigned char)(ctx->msglen >> 40);
+        ctx->msgblocks[64 * i + 57] = (unsigned char)(ctx->msglen >> 48);
+        ctx->msgblocks[64 * i + 56] = (unsigned char)(ctx->msglen >> 56);
+    }
+    PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_transform16x(ctx, ctx->msgblocks);
+
+    // Compute final hash output; the upper half of each transposed row is unused
+    for (i = 0; i < 8; i++) {
+        s[i] = BYTESWAP(ctx->s[i]);
+        s[i + 8] = _mm512_setzero_si512();
+    }
+    PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_transpose16(s);
+
+    // Store Hash value
+    for (i = 0; i < 16; i++) {
+        _mm256_storeu_si256((__m256i *)out[i], _mm512_castsi512_si256(s[i]));
+    }
+}
+
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256_transform16x(sha256ctxx16 *ctx, const unsigned char *data) {
+    u512 s[8], w[64], T0, T1;
+    int i;
+
+    // Load words and transform data correctly
+    for (i = 0; i < 16; i++) {
+        w[i] = BYTESWAP(LOAD(data + 64 * i));
+    }
+    PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_transpose16(w);
+
+    // Initial State
+    s[0] = ctx->s[0];
+    s[1] = ctx->s[1];
+    s[2] = ctx->s[2];
+    s[3] = ctx->s[3];
+    s[4] = ctx->s[4];
+    s[5] = ctx->s[5];
+    s[6] = ctx->s[6];
+    s[7] = ctx->s[7];
+
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 0, w[0]);
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 1, w[1]);
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 2, w[2]);
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 3, w[3]);
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 4, w[4]);
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 5, w[5]);
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 6, w[6]);
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 7, w[7]);
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 8, w[8]);
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 9, w[9]);
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 10, w[10]);
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 11, w[11]);
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 12, w[12]);
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 13, w[13]);
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 14, w[14]);
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 15, w[15]);
+    w[16] = ADD4_32(WSIGMA1_AVX512(w[14]), w[0], w[9], WSIGMA0_AVX512(w[1]));
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 16, w[16]);
+    w[17] = ADD4_32(WSIGMA1_AVX512(w[15]), w[1], w[10], WSIGMA0_AVX512(w[2]));
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 17, w[17]);
+    w[18] = ADD4_32(WSIGMA1_AVX512(w[16]), w[2], w[11], WSIGMA0_AVX512(w[3]));
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 18, w[18]);
+    w[19] = ADD4_32(WSIGMA1_AVX512(w[17]), w[3], w[12], WSIGMA0_AVX512(w[4]));
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 19, w[19]);
+    w[20] = ADD4_32(WSIGMA1_AVX512(w[18]), w[4], w[13], WSIGMA0_AVX512(w[5]));
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 20, w[20]);
+    w[21] = ADD4_32(WSIGMA1_AVX512(w[19]), w[5], w[14], WSIGMA0_AVX512(w[6]));
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 21, w[21]);
+    w[22] = ADD4_32(WSIGMA1_AVX512(w[20]), w[6], w[15], WSIGMA0_AVX512(w[7]));
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 22, w[22]);
+    w[23] = ADD4_32(WSIGMA1_AVX512(w[21]), w[7], w[16], WSIGMA0_AVX512(w[8]));
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 23, w[23]);
+    w[24] = ADD4_32(WSIGMA1_AVX512(w[22]), w[8], w[17], WSIGMA0_AVX512(w[9]));
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 24, w[24]);
+    w[25] = ADD4_32(WSIGMA1_AVX512(w[23]), w[9], w[18], WSIGMA0_AVX512(w[10]));
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 25, w[25]);
+    w[26] = ADD4_32(WSIGMA1_AVX512(w[24]), w[10], w[19], WSIGMA0_AVX512(w[11]));
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 26, w[26]);
+    w[27] = ADD4_32(WSIGMA1_AVX512(w[25]), w[11], w[20], WSIGMA0_AVX512(w[12]));
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 27, w[27]);
+    w[28] = ADD4_32(WSIGMA1_AVX512(w[26]), w[12], w[21], WSIGMA0_AVX512(w[13]));
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 28, w[28]);
+    w[29] = ADD4_32(WSIGMA1_AVX512(w[27]), w[13], w[22], WSIGMA0_AVX512(w[14]));
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 29, w[29]);
+    w[30] = ADD4_32(WSIGMA1_AVX512(w[28]), w[14], w[23], WSIGMA0_AVX512(w[15]));
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 30, w[30]);
+    w[31] = ADD4_32(WSIGMA1_AVX512(w[29]), w[15], w[24], WSIGMA0_AVX512(w[16]));
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 31, w[31]);
+    w[32] = ADD4_32(WSIGMA1_AVX512(w[30]), w[16], w[25], WSIGMA0_AVX512(w[17]));
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 32, w[32]);
+    w[33] = ADD4_32(WSIGMA1_AVX512(w[31]), w[17], w[26], WSIGMA0_AVX512(w[18]));
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 33, w[33]);
+    w[34] = ADD4_32(WSIGMA1_AVX512(w[32]), w[18], w[27], WSIGMA0_AVX512(w[19]));
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 34, w[34]);
+    w[35] = ADD4_32(WSIGMA1_AVX512(w[33]), w[19], w[28], WSIGMA0_AVX512(w[20]));
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 35, w[35]);
+    w[36] = ADD4_32(WSIGMA1_AVX512(w[34]), w[20], w[29], WSIGMA0_AVX512(w[21]));
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 36, w[36]);
+    w[37] = ADD4_32(WSIGMA1_AVX512(w[35]), w[21], w[30], WSIGMA0_AVX512(w[22]));
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 37, w[37]);
+    w[38] = ADD4_32(WSIGMA1_AVX512(w[36]), w[22], w[31], WSIGMA0_AVX512(w[23]));
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 38, w[38]);
+    w[39] = ADD4_32(WSIGMA1_AVX512(w[37]), w[23], w[32], WSIGMA0_AVX512(w[24]));
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 39, w[39]);
+    w[40] = ADD4_32(WSIGMA1_AVX512(w[38]), w[24], w[33], WSIGMA0_AVX512(w[25]));
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 40, w[40]);
+    w[41] = ADD4_32(WSIGMA1_AVX512(w[39]), w[25], w[34], WSIGMA0_AVX512(w[26]));
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 41, w[41]);
+    w[42] = ADD4_32(WSIGMA1_AVX512(w[40]), w[26], w[35], WSIGMA0_AVX512(w[27]));
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 42, w[42]);
+    w[43] = ADD4_32(WSIGMA1_AVX512(w[41]), w[27], w[36], WSIGMA0_AVX512(w[28]));
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 43, w[43]);
+    w[44] = ADD4_32(WSIGMA1_AVX512(w[42]), w[28], w[37], WSIGMA0_AVX512(w[29]));
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 44, w[44]);
+    w[45] = ADD4_32(WSIGMA1_AVX512(w[43]), w[29], w[38], WSIGMA0_AVX512(w[30]));
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 45, w[45]);
+    w[46] = ADD4_32(WSIGMA1_AVX512(w[44]), w[30], w[39], WSIGMA0_AVX512(w[31]));
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 46, w[46]);
+    w[47] = ADD4_32(WSIGMA1_AVX512(w[45]), w[31], w[40], WSIGMA0_AVX512(w[32]));
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 47, w[47]);
+    w[48] = ADD4_32(WSIGMA1_AVX512(w[46]), w[32], w[41], WSIGMA0_AVX512(w[33]));
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 48, w[48]);
+    w[49] = ADD4_32(WSIGMA1_AVX512(w[47]), w[33], w[42], WSIGMA0_AVX512(w[34]));
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 49, w[49]);
+    w[50] = ADD4_32(WSIGMA1_AVX512(w[48]), w[34], w[43], WSIGMA0_AVX512(w[35]));
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 50, w[50]);
+    w[51] = ADD4_32(WSIGMA1_AVX512(w[49]), w[35], w[44], WSIGMA0_AVX512(w[36]));
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 51, w[51]);
+    w[52] = ADD4_32(WSIGMA1_AVX512(w[50]), w[36], w[45], WSIGMA0_AVX512(w[37]));
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 52, w[52]);
+    w[53] = ADD4_32(WSIGMA1_AVX512(w[51]), w[37], w[46], WSIGMA0_AVX512(w[38]));
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 53, w[53]);
+    w[54] = ADD4_32(WSIGMA1_AVX512(w[52]), w[38], w[47], WSIGMA0_AVX512(w[39]));
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 54, w[54]);
+    w[55] = ADD4_32(WSIGMA1_AVX512(w[53]), w[39], w[48], WSIGMA0_AVX512(w[40]));
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 55, w[55]);
+    w[56] = ADD4_32(WSIGMA1_AVX512(w[54]), w[40], w[49], WSIGMA0_AVX512(w[41]));
+    SHA256ROUND_AVX512(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], 56, w[56]);
+    w[57] = ADD4_32(WSIGMA1_AVX512(w[55]), w[41], w[50], WSIGMA0_AVX512(w[42]));
+    SHA256ROUND_AVX512(s[7], s[0], s[1], s[2], s[3], s[4], s[5], s[6], 57, w[57]);
+    w[58] = ADD4_32(WSIGMA1_AVX512(w[56]), w[42], w[51], WSIGMA0_AVX512(w[43]));
+    SHA256ROUND_AVX512(s[6], s[7], s[0], s[1], s[2], s[3], s[4], s[5], 58, w[58]);
+    w[59] = ADD4_32(WSIGMA1_AVX512(w[57]), w[43], w[52], WSIGMA0_AVX512(w[44]));
+    SHA256ROUND_AVX512(s[5], s[6], s[7], s[0], s[1], s[2], s[3], s[4], 59, w[59]);
+    w[60] = ADD4_32(WSIGMA1_AVX512(w[58]), w[44], w[53], WSIGMA0_AVX512(w[45]));
+    SHA256ROUND_AVX512(s[4], s[5], s[6], s[7], s[0], s[1], s[2], s[3], 60, w[60]);
+    w[61] = ADD4_32(WSIGMA1_AVX512(w[59]), w[45], w[54], WSIGMA0_AVX512(w[46]));
+    SHA256ROUND_AVX512(s[3], s[4], s[5], s[6], s[7], s[0], s[1], s[2], 61, w[61]);
+    w[62] = ADD4_32(WSIGMA1_AVX512(w[60]), w[46], w[55], WSIGMA0_AVX512(w[47]));
+    SHA256ROUND_AVX512(s[2], s[3], s[4], s[5], s[6], s[7], s[0], s[1], 62, w[62]);
+    w[63] = ADD4_32(WSIGMA1_AVX512(w[61]), w[47], w[56], WSIGMA0_AVX512(w[48]));
+    SHA256ROUND_AVX512(s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[0], 63, w[63]);
+
+    // Feed Forward
+    ctx->s[0] = ADD32(s[0], ctx->s[0]);
+    ctx->s[1] = ADD32(s[1], ctx->s[1]);
+    ctx->s[2] = ADD32(s[2], ctx->s[2]);
+    ctx->s[3] = ADD32(s[3], ctx->s[3]);
+    ctx->s[4] = ADD32(s[4], ctx->s[4]);
+    ctx->s[5] = ADD32(s[5], ctx->s[5]);
+    ctx->s[6] = ADD32(s[6], ctx->s[6]);
+    ctx->s[7] = ADD32(s[7], ctx->s[7]);
+}
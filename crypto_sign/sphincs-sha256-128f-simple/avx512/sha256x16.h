@@ -0,0 +1,23 @@
+#ifndef PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_SHA256X16_H
+#define PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_SHA256X16_H
+
+#include "sha256avx512.h"
+
+#define PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_SHA256_BLOCK_BYTES 64
+#define PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_SHA256_OUTPUT_BYTES 32  /* This does not necessarily equal PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_N */
+
+/* This provides a wrapper around the internals of 16x parallel SHA256 */
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_sha256x16(unsigned char *const out[16],
+        const unsigned char *const in[16], unsigned long long inlen);
+
+/**
+ * Note that inlen should be sufficiently small that it still allows for
+ * an array to be allocated on the stack. Typically 'in' is merely a seed.
+ * Outputs outlen number of bytes for each of the 16 inputs, consecutively
+ */
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_mgf1x16(unsigned char *outx16, unsigned long outlen,
+        const unsigned char *const in[16],
+        unsigned long inlen);
+
+void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_seed_statex16(sha256ctxx16 *ctx, const unsigned char *pub_seed);
+#endif
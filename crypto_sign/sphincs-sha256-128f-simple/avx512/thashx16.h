@@ -0,0 +1,25 @@
+#ifndef PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_THASHX16_H
+#define PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_THASHX16_H
+
+#include <stdint.h>
+
+#include "hash_state.h"
+#include "sha256avx512.h"
+
+
+#define thashx16_variant(name)                   \
+    void PQCLEAN_SPHINCSSHA256128FSIMPLE_AVX512_thashx16_##name(                    \
+            unsigned char *const out[16],        \
+            const unsigned char *const in[16],   \
+            const unsigned char *pub_seed,       \
+            uint32_t addrx16[16*8],              \
+            const hash_state *state_seeded)
+
+
+thashx16_variant(1);
+thashx16_variant(2);
+thashx16_variant(WOTS_LEN);
+thashx16_variant(FORS_TREES);
+
+#undef thashx16_variant
+#endif
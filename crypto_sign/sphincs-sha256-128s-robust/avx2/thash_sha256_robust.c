@@ -19,7 +19,7 @@ static void thash(
 
     unsigned char outbuf[PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_SHA256_OUTPUT_BYTES];
     unsigned char *bitmask = buf + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_SHA256_ADDR_BYTES + 4;
-    sha256ctx sha2_state;
+    sha256ctx_inline sha2_state;
     unsigned int i;
 
     memcpy(buf, pub_seed, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N);
@@ -28,14 +28,14 @@ static void thash(
     PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_mgf1(bitmask, inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N, buf, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_SHA256_ADDR_BYTES);
 
     /* Retrieve precomputed state containing pub_seed */
-    sha256_inc_ctx_clone(&sha2_state, &hash_state_seeded->x1);
+    sha256_inc_ctx_clone_inline(&sha2_state, &hash_state_seeded->x1);
 
     for (i = 0; i < inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N; i++) {
         buf[PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_SHA256_ADDR_BYTES + i] = in[i] ^ bitmask[i];
     }
 
-    sha256_inc_finalize(outbuf, &sha2_state, buf + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
-                        PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N);
+    sha256_inc_finalize_inline(outbuf, &sha2_state, buf + PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N,
+                               PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N);
     memcpy(out, outbuf, PQCLEAN_SPHINCSSHA256128SROBUST_AVX2_N);
 }
 
@@ -0,0 +1,38 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "address.h"
+#include "hashx16.h"
+#include "params.h"
+#include "sha256.h"
+#include "sha256avx512.h"
+#include "sha256x16.h"
+#include "utils.h"
+
+/*
+ * 16-way parallel version of prf_addr; takes 16x as much input and output
+ */
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_prf_addrx16(unsigned char *outx16,
+        const unsigned char *key,
+        const uint32_t addrx16[16 * 8]) {
+    unsigned char bufx16[16 * (PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_ADDR_BYTES)];
+    unsigned char outbufx16[16 * PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_OUTPUT_BYTES];
+    const unsigned char *inptrs[16];
+    unsigned char *outptrs[16];
+    unsigned int j;
+
+    for (j = 0; j < 16; j++) {
+        memcpy(bufx16 + j * (PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_ADDR_BYTES), key, PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N);
+        PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_compress_address(bufx16 + PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N + j * (PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_ADDR_BYTES),
+                addrx16 + j * 8);
+        inptrs[j] = bufx16 + j * (PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_ADDR_BYTES);
+        outptrs[j] = outbufx16 + j * PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_OUTPUT_BYTES;
+    }
+
+    PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_sha256x16(outptrs, inptrs,
+            PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_ADDR_BYTES);
+
+    for (j = 0; j < 16; j++) {
+        memcpy(outx16 + j * PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N, outbufx16 + j * PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256_OUTPUT_BYTES, PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_N);
+    }
+}
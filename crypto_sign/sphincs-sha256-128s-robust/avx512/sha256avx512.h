@@ -0,0 +1,79 @@
+#ifndef PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256AVX512_H
+#define PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_SHA256AVX512_H
+
+#include <immintrin.h>
+#include <stdint.h>
+
+static const unsigned int RC[] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define u512 __m512i
+
+#define ADD32 _mm512_add_epi32
+
+#define LOAD(src) _mm512_loadu_si512((const void *)(src))
+#define STORE(dest,src) _mm512_storeu_si512((void *)(dest),src)
+
+#define BYTESWAP(x) _mm512_shuffle_epi8(x, _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203))
+
+#define ROTR32(x, y) _mm512_ror_epi32(x, y)
+#define SHIFTR32(x, y) _mm512_srli_epi32(x, y)
+
+/* vpternlogd truth tables: 0x96 = a ^ b ^ c, 0xe8 = maj(a, b, c), 0xca = a ? b : c */
+#define XOR3(a, b, c) _mm512_ternarylogic_epi32(a, b, c, 0x96)
+#define MAJ_AVX512(a, b, c) _mm512_ternarylogic_epi32(a, b, c, 0xe8)
+#define CH_AVX512(a, b, c) _mm512_ternarylogic_epi32(a, b, c, 0xca)
+
+#define ADD4_32(a, b, c, d) ADD32(ADD32(a, b), ADD32(c, d))
+#define ADD5_32(a, b, c, d, e) ADD32(ADD32(ADD32(a, b), ADD32(c, d)), e)
+
+#define SIGMA1_AVX512(x) XOR3(ROTR32(x, 6), ROTR32(x, 11), ROTR32(x, 25))
+#define SIGMA0_AVX512(x) XOR3(ROTR32(x, 2), ROTR32(x, 13), ROTR32(x, 22))
+
+#define WSIGMA1_AVX512(x) XOR3(ROTR32(x, 17), ROTR32(x, 19), SHIFTR32(x, 10))
+#define WSIGMA0_AVX512(x) XOR3(ROTR32(x, 7), ROTR32(x, 18), SHIFTR32(x, 3))
+
+#define SHA256ROUND_AVX512(a, b, c, d, e, f, g, h, rc, w) \
+    T0 = ADD5_32(h, SIGMA1_AVX512(e), CH_AVX512(e, f, g), _mm512_set1_epi32((int)RC[rc]), w); \
+    (d) = ADD32(d, T0); \
+    T1 = ADD32(SIGMA0_AVX512(a), MAJ_AVX512(a, b, c)); \
+    (h) = ADD32(T0, T1);
+
+typedef struct SHA256statex16 {
+    u512 s[8];
+    uint8_t msgblocks[16 * 64];
+    unsigned int datalen;
+    uint64_t msglen;
+} sha256ctxx16;
+
+
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_transpose16(u512 s[16]);
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_sha256_init16x(sha256ctxx16 *ctx);
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_sha256_update16x(sha256ctxx16 *ctx,
+        const unsigned char *const in[16],
+        unsigned long long len);
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_sha256_final16x(sha256ctxx16 *ctx,
+        unsigned char *const out[16]);
+
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_sha256_transform16x(sha256ctxx16 *ctx, const unsigned char *data);
+
+void PQCLEAN_SPHINCSSHA256128SROBUST_AVX512_sha256_clone_statex16(sha256ctxx16 *outctx, const sha256ctxx16 *inctx);
+
+
+#endif
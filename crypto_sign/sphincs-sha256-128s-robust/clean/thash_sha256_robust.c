@@ -15,11 +15,11 @@ static void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash(
     unsigned char *out, unsigned char *buf,
     const unsigned char *in, unsigned int inblocks,
     const unsigned char *pub_seed, uint32_t addr[8],
-    const sha256ctx *hash_state_seeded) {
+    const sha256ctx_inline *hash_state_seeded) {
 
     unsigned char outbuf[PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_OUTPUT_BYTES];
     unsigned char *bitmask = buf + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + 4;
-    sha256ctx sha2_state;
+    sha256ctx_inline sha2_state;
     unsigned int i;
 
     memcpy(buf, pub_seed, PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N);
@@ -28,14 +28,14 @@ static void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash(
     PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_mgf1(bitmask, inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N, buf, PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES);
 
     /* Retrieve precomputed state containing pub_seed */
-    sha256_inc_ctx_clone(&sha2_state, hash_state_seeded);
+    sha256_inc_ctx_clone_inline(&sha2_state, hash_state_seeded);
 
     for (i = 0; i < inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N; i++) {
         buf[PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + i] = in[i] ^ bitmask[i];
     }
 
-    sha256_inc_finalize(outbuf, &sha2_state, buf + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N,
-                        PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N);
+    sha256_inc_finalize_inline(outbuf, &sha2_state, buf + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N,
+                               PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N);
     memcpy(out, outbuf, PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N);
 }
 
@@ -44,7 +44,7 @@ static void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash(
 void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash_1(
     unsigned char *out, const unsigned char *in,
     const unsigned char *pub_seed, uint32_t addr[8],
-    const sha256ctx *hash_state_seeded) {
+    const sha256ctx_inline *hash_state_seeded) {
 
     unsigned char buf[PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + 4 + 1 * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N];
     PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash(
@@ -54,7 +54,7 @@ void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash_1(
 void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash_2(
     unsigned char *out, const unsigned char *in,
     const unsigned char *pub_seed, uint32_t addr[8],
-    const sha256ctx *hash_state_seeded) {
+    const sha256ctx_inline *hash_state_seeded) {
 
     unsigned char buf[PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + 4 + 2 * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N];
     PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash(
@@ -64,7 +64,7 @@ void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash_2(
 void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash_WOTS_LEN(
     unsigned char *out, const unsigned char *in,
     const unsigned char *pub_seed, uint32_t addr[8],
-    const sha256ctx *hash_state_seeded) {
+    const sha256ctx_inline *hash_state_seeded) {
 
     unsigned char buf[PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + 4 + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_WOTS_LEN * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N];
     PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash(
@@ -74,7 +74,7 @@ void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash_WOTS_LEN(
 void PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash_FORS_TREES(
     unsigned char *out, const unsigned char *in,
     const unsigned char *pub_seed, uint32_t addr[8],
-    const sha256ctx *hash_state_seeded) {
+    const sha256ctx_inline *hash_state_seeded) {
 
     unsigned char buf[PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_SHA256_ADDR_BYTES + 4 + PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_FORS_TREES * PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_N];
     PQCLEAN_SPHINCSSHA256128SROBUST_CLEAN_thash(
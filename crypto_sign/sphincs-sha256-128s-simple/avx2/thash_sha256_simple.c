@@ -18,17 +18,17 @@ static void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_thash(
     const hash_state *hash_state_seeded) {
 
     unsigned char outbuf[PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_SHA256_OUTPUT_BYTES];
-    sha256ctx sha2_state;
+    sha256ctx_inline sha2_state;
 
     (void)pub_seed; /* Suppress an 'unused parameter' warning. */
 
     /* Retrieve precomputed state containing pub_seed */
-    sha256_inc_ctx_clone(&sha2_state, &hash_state_seeded->x1);
+    sha256_inc_ctx_clone_inline(&sha2_state, &hash_state_seeded->x1);
 
     PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_compress_address(buf, addr);
     memcpy(buf + PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_SHA256_ADDR_BYTES, in, inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_N);
 
-    sha256_inc_finalize(outbuf, &sha2_state, buf, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_N);
+    sha256_inc_finalize_inline(outbuf, &sha2_state, buf, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_N);
     memcpy(out, outbuf, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX2_N);
 }
 
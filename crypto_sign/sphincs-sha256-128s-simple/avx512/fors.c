@@ -0,0 +1,178 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "address.h"
+#include "fors.h"
+#include "hash.h"
+#include "hashx16.h"
+#include "thash.h"
+#include "thashx16.h"
+#include "utils.h"
+#include "utilsx16.h"
+
+static void fors_gen_skx16(unsigned char *skx16, const unsigned char *sk_seed,
+                           uint32_t fors_leaf_addrx16[16 * 8]) {
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_prf_addrx16(skx16, sk_seed, fors_leaf_addrx16);
+}
+
+static void fors_sk_to_leaf(unsigned char *leaf, const unsigned char *sk,
+                            const unsigned char *pub_seed,
+                            uint32_t fors_leaf_addr[8],
+                            const hash_state *state_seeded) {
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_thash_1(leaf, sk, pub_seed, fors_leaf_addr, state_seeded);
+}
+
+static void fors_gen_leafx16(unsigned char *const leaf[16],
+                             const unsigned char *sk_seed,
+                             const unsigned char *pub_seed,
+                             const uint32_t addr_idx[16],
+                             const uint32_t fors_tree_addr[8],
+                             const hash_state *state_seeded) {
+    uint32_t fors_leaf_addrx16[16 * 8] = {0};
+    unsigned char skx16[16 * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N];
+    const unsigned char *sk[16];
+    unsigned int j;
+
+    /* Only copy the parts that must be kept in fors_leaf_addrx16. */
+    for (j = 0; j < 16; j++) {
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_copy_keypair_addr(fors_leaf_addrx16 + j * 8, fors_tree_addr);
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_type(fors_leaf_addrx16 + j * 8, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ADDR_TYPE_FORSTREE);
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_tree_index(fors_leaf_addrx16 + j * 8, addr_idx[j]);
+        sk[j] = skx16 + j * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N;
+    }
+
+    fors_gen_skx16(skx16, sk_seed, fors_leaf_addrx16);
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_thashx16_1(leaf, sk, pub_seed, fors_leaf_addrx16, state_seeded);
+}
+
+/**
+ * Interprets m as PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT-bit unsigned integers.
+ * Assumes m contains at least PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES bits.
+ * Assumes indices has space for PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES integers.
+ */
+static void message_to_indices(uint32_t *indices, const unsigned char *m) {
+    unsigned int i, j;
+    unsigned int offset = 0;
+
+    for (i = 0; i < PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES; i++) {
+        indices[i] = 0;
+        for (j = 0; j < PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT; j++) {
+            indices[i] ^= (((uint32_t)m[offset >> 3] >> (offset & 0x7)) & 0x1) << j;
+            offset++;
+        }
+    }
+}
+
+/**
+ * Signs a message m, deriving the secret key from sk_seed and the FTS address.
+ * Assumes m contains at least PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES bits.
+ */
+void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_fors_sign(
+    unsigned char *sig, unsigned char *pk,
+    const unsigned char *m,
+    const unsigned char *sk_seed, const unsigned char *pub_seed,
+    const uint32_t fors_addr[8],
+    const hash_state *state_seeded) {
+    /* Round up to multiple of 16 to prevent out-of-bounds for x16 parallelism */
+    uint32_t indices[(PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES + 15) & ~15] = {0};
+    unsigned char roots[((PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES + 15) & ~15) * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N];
+    /* Sign to a buffer, since we may not have a nice multiple of 16 and would
+       otherwise overrun the signature. */
+    unsigned char sigbufx16[16 * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N * (1 + PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT)];
+    uint32_t fors_tree_addrx16[16 * 8] = {0};
+    uint32_t fors_pk_addr[8] = {0};
+    uint32_t idx_offset[16] = {0};
+    unsigned int i, j;
+
+    for (j = 0; j < 16; j++) {
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_copy_keypair_addr(fors_tree_addrx16 + j * 8, fors_addr);
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_type(fors_tree_addrx16 + j * 8, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ADDR_TYPE_FORSTREE);
+    }
+
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_copy_keypair_addr(fors_pk_addr, fors_addr);
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_type(fors_pk_addr, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ADDR_TYPE_FORSPK);
+
+    message_to_indices(indices, m);
+
+    for (i = 0; i < ((PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES + 15) & ~0xf); i += 16) {
+        for (j = 0; j < 16; j++) {
+            if (i + j < PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES) {
+                idx_offset[j] = (i + j) * (1 << PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT);
+
+                PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_tree_height(fors_tree_addrx16 + j * 8, 0);
+                PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_tree_index(fors_tree_addrx16 + j * 8,
+                        indices[i + j] + idx_offset[j]);
+            }
+        }
+
+        /* Include the secret key part that produces the selected leaf nodes. */
+        fors_gen_skx16(sigbufx16, sk_seed, fors_tree_addrx16);
+
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_treehashx16_FORS_HEIGHT(
+            roots + i * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, sigbufx16 + 16 * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, sk_seed, pub_seed,
+            &indices[i], idx_offset, fors_gen_leafx16, fors_tree_addrx16,
+            state_seeded);
+
+        for (j = 0; j < 16; j++) {
+            if (i + j < PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES) {
+                memcpy(sig, sigbufx16 + j * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+                memcpy(sig + PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N,
+                       sigbufx16 + 16 * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N + j * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT,
+                       PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT);
+                sig += PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N * (1 + PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT);
+            }
+        }
+    }
+
+    /* Hash horizontally across all tree roots to derive the public key. */
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_thash_FORS_TREES(pk, roots, pub_seed, fors_pk_addr, state_seeded);
+}
+
+/**
+ * Derives the FORS public key from a signature.
+ * This can be used for verification by comparing to a known public key, or to
+ * subsequently verify a signature on the derived public key. The latter is the
+ * typical use-case when used as an FTS below an OTS in a hypertree.
+ * Assumes m contains at least PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES bits.
+ */
+void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_fors_pk_from_sig(unsigned char *pk,
+        const unsigned char *sig, const unsigned char *m,
+        const unsigned char *pub_seed,
+        const uint32_t fors_addr[8],
+        const hash_state *state_seeded) {
+    uint32_t indices[PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES];
+    unsigned char roots[PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N];
+    unsigned char leaf[PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N];
+    uint32_t fors_tree_addr[8] = {0};
+    uint32_t fors_pk_addr[8] = {0};
+    uint32_t idx_offset;
+    unsigned int i;
+
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_copy_keypair_addr(fors_tree_addr, fors_addr);
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_copy_keypair_addr(fors_pk_addr, fors_addr);
+
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_type(fors_tree_addr, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ADDR_TYPE_FORSTREE);
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_type(fors_pk_addr, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ADDR_TYPE_FORSPK);
+
+    message_to_indices(indices, m);
+
+    for (i = 0; i < PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES; i++) {
+        idx_offset = i * (1 << PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT);
+
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_tree_height(fors_tree_addr, 0);
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_tree_index(fors_tree_addr, indices[i] + idx_offset);
+
+        /* Derive the leaf from the included secret key part. */
+        fors_sk_to_leaf(leaf, sig, pub_seed, fors_tree_addr, state_seeded);
+        sig += PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N;
+
+        /* Derive the corresponding root node of this tree. */
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_compute_root(roots + i * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, leaf, indices[i], idx_offset,
+                sig, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT, pub_seed, fors_tree_addr, state_seeded);
+        sig += PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT;
+    }
+
+    /* Hash horizontally across all tree roots to derive the public key. */
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_thash_FORS_TREES(pk, roots, pub_seed, fors_pk_addr, state_seeded);
+}
@@ -0,0 +1,81 @@
+#include <string.h>
+
+#include "sha256.h"
+#include "sha256avx512.h"
+#include "sha256x16.h"
+#include "utils.h"
+
+void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_seed_statex16(sha256ctxx16 *ctx, const unsigned char *pub_seed) {
+    uint8_t block[PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_BLOCK_BYTES];
+    const unsigned char *blocks[16];
+    size_t i;
+
+    for (i = 0; i < PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N; ++i) {
+        block[i] = pub_seed[i];
+    }
+    for (i = PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N; i < PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_BLOCK_BYTES; ++i) {
+        block[i] = 0;
+    }
+    for (i = 0; i < 16; ++i) {
+        blocks[i] = block;
+    }
+
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_init16x(ctx);
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_update16x(ctx, blocks, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_BLOCK_BYTES);
+
+}
+
+/* This provides a wrapper around the internals of 16x parallel SHA256 */
+void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256x16(unsigned char *const out[16],
+        const unsigned char *const in[16], unsigned long long inlen) {
+    sha256ctxx16 ctx;
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_init16x(&ctx);
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_update16x(&ctx, in, inlen);
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_final16x(&ctx, out);
+}
+
+/**
+ * Note that inlen should be sufficiently small that it still allows for
+ * an array to be allocated on the stack. Typically 'in' is merely a seed.
+ * Outputs outlen number of bytes for each of the 16 inputs, consecutively
+ */
+void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_mgf1x16(
+    unsigned char *outx16,
+    unsigned long outlen,
+    const unsigned char *const in[16],
+    unsigned long inlen) {
+    unsigned char inbufx16[16 * ((PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N + PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_ADDR_BYTES) + 4)];
+    unsigned char outbufx16[16 * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES];
+    const unsigned char *inptrs[16];
+    unsigned char *outptrs[16];
+    unsigned long i;
+    unsigned int j;
+
+    for (j = 0; j < 16; j++) {
+        memcpy(inbufx16 + j * (inlen + 4), in[j], inlen);
+        inptrs[j] = inbufx16 + j * (inlen + 4);
+    }
+
+    /* While we can fit in at least another full block of SHA256 output.. */
+    for (i = 0; (i + 1)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES <= outlen; i++) {
+        for (j = 0; j < 16; j++) {
+            PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ull_to_bytes(inbufx16 + inlen + j * (inlen + 4), 4, i);
+            outptrs[j] = outx16 + j * outlen;
+        }
+
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256x16(outptrs, inptrs, inlen + 4);
+        outx16 += PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES;
+    }
+    /* Until we cannot anymore, and we fill the remainder. */
+    for (j = 0; j < 16; j++) {
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ull_to_bytes(inbufx16 + inlen + j * (inlen + 4), 4, i);
+        outptrs[j] = outbufx16 + j * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES;
+    }
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256x16(outptrs, inptrs, inlen + 4);
+
+    for (j = 0; j < 16; j++) {
+        memcpy(outx16 + j * outlen,
+               outbufx16 + j * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES,
+               outlen - i * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES);
+    }
+}
@@ -0,0 +1,67 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "address.h"
+#include "hash_state.h"
+#include "params.h"
+#include "sha256.h"
+#include "sha256avx512.h"
+#include "sha256x16.h"
+#include "thashx16.h"
+#include "utils.h"
+
+/**
+ * 16-way parallel version of thash; takes 16x as much input and output
+ */
+static void thashx16(unsigned char *const out[16],
+                     const unsigned char *const in[16], unsigned int inblocks,
+                     const unsigned char *pub_seed, uint32_t addrx16[16 * 8],
+                     uint8_t *bufx16,
+                     const hash_state *state_seeded) {
+    unsigned char outbufx16[16 * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES];
+    const unsigned char *inptrs[16];
+    unsigned char *outptrs[16];
+    unsigned int i;
+    sha256ctxx16 ctx;
+
+    (void)pub_seed; /* Suppress an 'unused parameter' warning. */
+
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_clone_statex16(&ctx, &state_seeded->x16);
+
+    for (i = 0; i < 16; i++) {
+        PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_compress_address(bufx16 + i * (PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N),
+                addrx16 + i * 8);
+        memcpy(bufx16 + PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_ADDR_BYTES +
+               i * (PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N), in[i], inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+        inptrs[i] = bufx16 + i * (PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+        outptrs[i] = outbufx16 + i * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES;
+    }
+
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_update16x(&ctx, inptrs,
+            PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+
+    PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_sha256_final16x(&ctx, outptrs);
+
+    for (i = 0; i < 16; i++) {
+        memcpy(out[i], outbufx16 + i * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_OUTPUT_BYTES, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+    }
+}
+
+#define thashx16_variant_impl(name, size)                                     \
+    void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_thashx16_##name(unsigned char *const out[16],                     \
+            const unsigned char *const in[16],                         \
+            const unsigned char *pub_seed,                             \
+            uint32_t addrx16[16*8],                                    \
+            const hash_state *state_seeded)                            \
+    {                                                                         \
+        const unsigned int inblocks = (size);                                 \
+        uint8_t bufx16[16*(PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_SHA256_ADDR_BYTES + (size)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N)];           \
+        thashx16(out, in, inblocks, pub_seed, addrx16, bufx16, state_seeded); \
+    }
+
+thashx16_variant_impl(1, 1)
+thashx16_variant_impl(2, 2)
+thashx16_variant_impl(WOTS_LEN, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_WOTS_LEN)
+thashx16_variant_impl(FORS_TREES, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_TREES)
+
+#undef thashx16_variant_impl
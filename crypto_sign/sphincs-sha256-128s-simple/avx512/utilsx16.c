@@ -0,0 +1,119 @@
+#include <string.h>
+
+#include "address.h"
+#include "params.h"
+#include "thashx16.h"
+#include "utils.h"
+
+#include "utilsx16.h"
+
+/**
+ * For a given leaf index, computes the authentication path and the resulting
+ * root node using Merkle's TreeHash algorithm.
+ * Expects the layer and tree parts of the tree_addr to be set, as well as the
+ * tree type (i.e. PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ADDR_TYPE_HASHTREE or PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_ADDR_TYPE_FORSTREE).
+ * Applies the offset idx_offset to indices before building addresses, so that
+ * it is possible to continue counting indices across trees.
+ */
+static void treehashx16(unsigned char *rootx16, unsigned char *auth_pathx16,
+                        unsigned char *stackx16, unsigned int *heights,
+                        const unsigned char *sk_seed, const unsigned char *pub_seed,
+                        const uint32_t leaf_idx[16], uint32_t idx_offset[16],
+                        uint32_t tree_height,
+                        void (*gen_leafx16)(
+                            unsigned char *const [16] /* leaf */,
+                            const unsigned char * /* sk_seed */,
+                            const unsigned char * /* pub_seed */,
+                            const uint32_t[16] /* addr_idx */,
+                            const uint32_t[8] /* tree_addr */,
+                            const hash_state * /* state_seeded */),
+                        uint32_t tree_addrx16[16 * 8],
+                        const hash_state *state_seeded) {
+    unsigned char *nodes[16];
+    const unsigned char *pairs[16];
+    uint32_t addr_idx[16];
+    unsigned int offset = 0;
+    uint32_t idx;
+    uint32_t tree_idx;
+    unsigned int j;
+
+    for (idx = 0; idx < (uint32_t)(1 << tree_height); idx++) {
+        /* Add the next leaf node to the stack. */
+        for (j = 0; j < 16; j++) {
+            nodes[j] = stackx16 + j * (tree_height + 1) * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N + offset * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N;
+            addr_idx[j] = idx + idx_offset[j];
+        }
+        gen_leafx16(nodes, sk_seed, pub_seed, addr_idx, tree_addrx16, state_seeded);
+        offset++;
+        heights[offset - 1] = 0;
+
+        /* If this is a node we need for the auth path.. */
+        for (j = 0; j < 16; j++) {
+            if ((leaf_idx[j] ^ 0x1) == idx) {
+                memcpy(auth_pathx16 + j * tree_height * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N,
+                       stackx16 + j * (tree_height + 1)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N + (offset - 1)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+            }
+        }
+
+        /* While the top-most nodes are of equal height.. */
+        while (offset >= 2 && heights[offset - 1] == heights[offset - 2]) {
+            /* Compute index of the new node, in the next layer. */
+            tree_idx = (idx >> (heights[offset - 1] + 1));
+
+            /* Set the address of the node we're creating. */
+            for (j = 0; j < 16; j++) {
+                PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_tree_height(tree_addrx16 + j * 8, heights[offset - 1] + 1);
+                PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_set_tree_index(tree_addrx16 + j * 8,
+                        tree_idx + (idx_offset[j] >> (heights[offset - 1] + 1)));
+                nodes[j] = stackx16 + j * (tree_height + 1) * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N + (offset - 2) * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N;
+                pairs[j] = nodes[j];
+            }
+            /* Hash the top-most nodes from the stack together. */
+            PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_thashx16_2(nodes, pairs, pub_seed, tree_addrx16, state_seeded);
+            offset--;
+            /* Note that the top-most node is now one layer higher. */
+            heights[offset - 1]++;
+
+            /* If this is a node we need for the auth path.. */
+            for (j = 0; j < 16; j++) {
+                if (((leaf_idx[j] >> heights[offset - 1]) ^ 0x1) == tree_idx) {
+                    memcpy(auth_pathx16 + j * tree_height * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N + heights[offset - 1]*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N,
+                           stackx16 + j * (tree_height + 1)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N + (offset - 1)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+                }
+            }
+        }
+    }
+
+    for (j = 0; j < 16; j++) {
+        memcpy(rootx16 + j * PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, stackx16 + j * (tree_height + 1)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N);
+    }
+}
+
+/* The wrappers below ensure we used fixed-size buffers on the stack (no VLAs) */
+
+
+#define treehashx16_variant(name, size)                                                             \
+    void PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_treehashx16_##name(                                                                    \
+            unsigned char *rootx16, unsigned char *auth_pathx16,                            \
+            const unsigned char *sk_seed, const unsigned char *pub_seed,                    \
+            const uint32_t leaf_idx[16], uint32_t idx_offset[16],                           \
+            void (*gen_leafx16)(                                                            \
+                    unsigned char *const [16] /* leaf */,                                        \
+                    const unsigned char* /* sk_seed */,                                          \
+                    const unsigned char* /* pub_seed */,                                         \
+                    const uint32_t[16] /* addr_idx */,                                           \
+                    const uint32_t[8] /* tree_addr */,                                           \
+                    const hash_state* /* state_seeded */),                                       \
+            uint32_t tree_addrx16[16*8],                                                    \
+            const hash_state *state_seeded)                                                 \
+    {                                                                                               \
+        const uint32_t tree_height = (size);                                                        \
+        unsigned char stackx16[16*((size) + 1)*PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_N];                                            \
+        unsigned int heights[(size) + 1];                                                           \
+        treehashx16(rootx16, auth_pathx16, stackx16, heights, sk_seed, pub_seed,                    \
+                    leaf_idx, idx_offset, tree_height, gen_leafx16, tree_addrx16, state_seeded);    \
+    }
+
+treehashx16_variant(FORS_HEIGHT, PQCLEAN_SPHINCSSHA256128SSIMPLE_AVX512_FORS_HEIGHT)
+
+#undef treehashx16_variant
@@ -0,0 +1,32 @@
+#ifndef PQCLEAN_SPHINCSSHA256192FROBUST_AVX512_UTILSX16_H
+#define PQCLEAN_SPHINCSSHA256192FROBUST_AVX512_UTILSX16_H
+
+#include <stdint.h>
+
+#include "hash_state.h"
+#include "params.h"
+
+/**
+ * For a given leaf index, computes the authentication path and the resulting
+ * root node using Merkle's TreeHash algorithm.
+ * Expects the layer and tree parts of the tree_addr to be set, as well as the
+ * tree type (i.e. PQCLEAN_SPHINCSSHA256192FROBUST_AVX512_ADDR_TYPE_HASHTREE or PQCLEAN_SPHINCSSHA256192FROBUST_AVX512_ADDR_TYPE_FORSTREE).
+ * Applies the offset idx_offset to indices before building addresses, so that
+ * it is possible to continue counting indices across trees.
+ */
+
+void PQCLEAN_SPHINCSSHA256192FROBUST_AVX512_treehashx16_FORS_HEIGHT(
+    unsigned char *rootx16, unsigned char *auth_pathx16,
+    const unsigned char *sk_seed, const unsigned char *pub_seed,
+    const uint32_t leaf_idx[16], uint32_t idx_offset[16],
+    void (*gen_leafx16)(
+        unsigned char *const [16] /* leaf */,
+        const unsigned char * /* sk_seed */,
+        const unsigned char * /* pub_seed */,
+        const uint32_t[16] /* addr_idx */,
+        const uint32_t[8] /* tree_addr */,
+        const hash_state * /* state_seeded */),
+    uint32_t tree_addrx16[16 * 8],
+    const hash_state *state_seeded);
+
+#endif
@@ -19,8 +19,9 @@ void PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_initialize_hash_function(
 }
 
 /* Clean up hash state */
-void PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_destroy_hash_function(hash_state *hash_state_seeded) {
-    sha256_inc_ctx_release(hash_state_seeded);
+void PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_destroy_hash_function(
+    hash_state *hash_state_seeded) { // NOLINT(readability-non-const-parameter)
+    (void)hash_state_seeded;
 }
 
 /*
@@ -54,7 +55,7 @@ void PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_gen_message_random(
     const unsigned char *sk_prf, const unsigned char *optrand,
     const unsigned char *m, size_t mlen, const hash_state *hash_state_seeded) {
     unsigned char buf[PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_OUTPUT_BYTES];
-    sha256ctx state;
+    sha256ctx_inline state;
     int i;
 
     /* This implements HMAC-SHA256 */
@@ -63,25 +64,25 @@ void PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_gen_message_random(
     }
     memset(buf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N, 0x36, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N);
 
-    sha256_inc_init(&state);
-    sha256_inc_blocks(&state, buf, 1);
+    sha256_inc_init_inline(&state);
+    sha256_inc_blocks_inline(&state, buf, 1);
 
     memcpy(buf, optrand, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N);
 
     /* If optrand + message cannot fill up an entire block */
     if (PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N + mlen < PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES) {
         memcpy(buf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N, m, mlen);
-        sha256_inc_finalize(buf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES, &state,
-                            buf, mlen + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N);
+        sha256_inc_finalize_inline(buf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES, &state,
+                                   buf, mlen + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N);
     }
     /* Otherwise first fill a block, so that finalize only uses the message */
     else {
         memcpy(buf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N, m, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N);
-        sha256_inc_blocks(&state, buf, 1);
+        sha256_inc_blocks_inline(&state, buf, 1);
 
         m += PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N;
         mlen -= PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N;
-        sha256_inc_finalize(buf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES, &state, m, mlen);
+        sha256_inc_finalize_inline(buf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES, &state, m, mlen);
     }
 
     for (i = 0; i < PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N; i++) {
@@ -120,9 +121,9 @@ void PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_hash_message(
 
     unsigned char buf[PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_DGST_BYTES];
     unsigned char *bufp = buf;
-    sha256ctx state;
+    sha256ctx_inline state;
 
-    sha256_inc_init(&state);
+    sha256_inc_init_inline(&state);
 
     memcpy(inbuf, R, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N);
     memcpy(inbuf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N, pk, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES);
@@ -130,17 +131,17 @@ void PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_hash_message(
     /* If R + pk + message cannot fill up an entire block */
     if (PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES + mlen < PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_INBLOCKS * PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES) {
         memcpy(inbuf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES, m, mlen);
-        sha256_inc_finalize(seed, &state, inbuf, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES + mlen);
+        sha256_inc_finalize_inline(seed, &state, inbuf, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES + mlen);
     }
     /* Otherwise first fill a block, so that finalize only uses the message */
     else {
         memcpy(inbuf + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N + PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES, m,
                PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_INBLOCKS * PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES);
-        sha256_inc_blocks(&state, inbuf, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_INBLOCKS);
+        sha256_inc_blocks_inline(&state, inbuf, PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_INBLOCKS);
 
         m += PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_INBLOCKS * PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES;
         mlen -= PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_INBLOCKS * PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_SHA256_BLOCK_BYTES - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_N - PQCLEAN_SPHINCSSHA256192FROBUST_CLEAN_PK_BYTES;
-        sha256_inc_finalize(seed, &state, m, mlen);
+        sha256_inc_finalize_inline(seed, &state, m, mlen);
     }
 
     /* By doing this in two steps, we prevent hashing the message twice;
@@ -0,0 +1,15 @@
+#ifndef PQCLEAN_SPHINCSSHA256192SROBUST_AVX512_HASHX16_H
+#define PQCLEAN_SPHINCSSHA256192SROBUST_AVX512_HASHX16_H
+
+#include <stdint.h>
+
+#include "params.h"
+
+/*
+ * Writes the 16 outputs consecutively, PQCLEAN_SPHINCSSHA256192SROBUST_AVX512_N bytes apart, to outx16.
+ */
+void PQCLEAN_SPHINCSSHA256192SROBUST_AVX512_prf_addrx16(unsigned char *outx16,
+        const unsigned char *key,
+        const uint32_t addrx16[16 * 8]);
+
+#endif
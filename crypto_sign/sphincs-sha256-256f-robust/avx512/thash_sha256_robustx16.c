@@ -0,0 +1,81 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "address.h"
+#include "params.h"
+#include "sha256.h"
+#include "sha256avx512.h"
+#include "sha256x16.h"
+#include "thashx16.h"
+#include "utils.h"
+
+/**
+ * 16-way parallel version of thash; takes 16x as much input and output
+ */
+static void thashx16(unsigned char *const out[16],
+                     const unsigned char *const in[16],
+                     unsigned int inblocks,
+                     const unsigned char *pub_seed,
+                     uint32_t addrx16[16 * 8],
+                     uint8_t *bufx16,
+                     uint8_t *bitmaskx16,
+                     const hash_state *state_seeded) {
+    unsigned char outbufx16[16 * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_OUTPUT_BYTES];
+    const unsigned char *inptrs[16];
+    unsigned char *outptrs[16];
+    unsigned int i, j;
+    sha256ctxx16 ctx;
+
+    for (i = 0; i < 16; i++) {
+        memcpy(bufx16 + i * (PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N),
+               pub_seed, PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N);
+        PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_compress_address(bufx16 + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N +
+                i * (PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N),
+                addrx16 + i * 8);
+        inptrs[i] = bufx16 + i * (PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N);
+    }
+
+    PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_mgf1x16(bitmaskx16, inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N, inptrs,
+            PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES);
+
+    PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_sha256_clone_statex16(&ctx, &state_seeded->x16);
+
+    for (i = 0; i < 16; i++) {
+        for (j = 0; j < inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N; j++) {
+            bufx16[PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + j +
+                   i * (PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N)] =
+                       in[i][j] ^ bitmaskx16[j + i * (inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N)];
+        }
+        inptrs[i] = bufx16 + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + i * (PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N);
+        outptrs[i] = outbufx16 + i * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_OUTPUT_BYTES;
+    }
+
+    PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_sha256_update16x(&ctx, inptrs,
+            PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + inblocks * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N);
+
+    PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_sha256_final16x(&ctx, outptrs);
+
+    for (i = 0; i < 16; i++) {
+        memcpy(out[i], outbufx16 + i * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_OUTPUT_BYTES, PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N);
+    }
+}
+
+#define thash_size_variant(name, size) \
+    void PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_thashx16_##name(unsigned char *const out[16],                      \
+            const unsigned char *const in[16],                    \
+            const unsigned char *pub_seed,                        \
+            uint32_t addrx16[16*8],                               \
+            const hash_state *state_seeded) {                     \
+        const unsigned int inblocks = (size);                                    \
+        uint8_t bufx16[16*(PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N + PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_SHA256_ADDR_BYTES + (size)*PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N)];         \
+        uint8_t bitmaskx16[16*((size) * PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_N)];                                   \
+        thashx16(out, in, inblocks,                                              \
+                 pub_seed, addrx16, bufx16, bitmaskx16, state_seeded);           \
+    }
+
+thash_size_variant(1, 1)
+thash_size_variant(2, 2)
+thash_size_variant(WOTS_LEN, PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_WOTS_LEN)
+thash_size_variant(FORS_TREES, PQCLEAN_SPHINCSSHA256256FROBUST_AVX512_FORS_TREES)
+
+#undef thash_size_variant
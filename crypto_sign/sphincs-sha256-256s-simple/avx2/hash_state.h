@@ -26,7 +26,7 @@
 #include "sha256avx.h"
 
 typedef struct {
-    sha256ctx x1;
+    sha256ctx_inline x1;
     sha256ctxx8 x8;
 } hash_state;
 
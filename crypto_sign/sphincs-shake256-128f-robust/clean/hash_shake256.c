@@ -49,15 +49,14 @@ void PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_gen_message_random(
     const unsigned char *sk_prf, const unsigned char *optrand,
     const unsigned char *m, size_t mlen,
     const hash_state *hash_state_seeded) {
-    shake256incctx state;
+    shake256incctx_inline state;
 
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, sk_prf, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N);
-    shake256_inc_absorb(&state, optrand, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N);
-    shake256_inc_absorb(&state, m, mlen);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(R, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N, &state);
-    shake256_inc_ctx_release(&state);
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, sk_prf, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N);
+    shake256_inc_absorb_inline(&state, optrand, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(R, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N, &state);
 
     (void)hash_state_seeded; /* Prevent unused parameter warning. */
 }
@@ -80,15 +79,14 @@ void PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_hash_message(
 
     unsigned char buf[PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_DGST_BYTES];
     unsigned char *bufp = buf;
-    shake256incctx state;
-
-    shake256_inc_init(&state);
-    shake256_inc_absorb(&state, R, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N);
-    shake256_inc_absorb(&state, pk, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_PK_BYTES);
-    shake256_inc_absorb(&state, m, mlen);
-    shake256_inc_finalize(&state);
-    shake256_inc_squeeze(buf, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_DGST_BYTES, &state);
-    shake256_inc_ctx_release(&state);
+    shake256incctx_inline state;
+
+    shake256_inc_init_inline(&state);
+    shake256_inc_absorb_inline(&state, R, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_N);
+    shake256_inc_absorb_inline(&state, pk, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_PK_BYTES);
+    shake256_inc_absorb_inline(&state, m, mlen);
+    shake256_inc_finalize_inline(&state);
+    shake256_inc_squeeze_inline(buf, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_DGST_BYTES, &state);
 
     memcpy(digest, bufp, PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_FORS_MSG_BYTES);
     bufp += PQCLEAN_SPHINCSSHAKE256128FROBUST_CLEAN_FORS_MSG_BYTES;
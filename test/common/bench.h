@@ -0,0 +1,87 @@
+#ifndef PQCLEAN_TEST_BENCH_H
+#define PQCLEAN_TEST_BENCH_H
+
+/*
+ * Timing helpers shared by the crypto_kem and crypto_sign benchmarks.
+ *
+ * On x86 the time stamp counter is read with serializing fences around it
+ * and results are reported in cycles; elsewhere we fall back to a
+ * monotonic clock and report nanoseconds.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define BENCH_UNIT "cycles"
+static uint64_t bench_start(void) {
+    _mm_lfence();
+    return __rdtsc();
+}
+static uint64_t bench_stop(void) {
+    unsigned int aux;
+    uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+}
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BENCH_UNIT "cycles"
+static uint64_t bench_start(void) {
+    uint32_t lo, hi;
+    __asm__ __volatile__ ("lfence\n\trdtsc" : "=a" (lo), "=d" (hi) :: "memory");
+    return ((uint64_t)hi << 32) | lo;
+}
+static uint64_t bench_stop(void) {
+    uint32_t lo, hi;
+    __asm__ __volatile__ ("rdtscp\n\tlfence" : "=a" (lo), "=d" (hi) :: "rcx", "memory");
+    return ((uint64_t)hi << 32) | lo;
+}
+#elif defined(_WIN32)
+#define BENCH_UNIT "ns"
+static uint64_t bench_start(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#define bench_stop bench_start
+#else
+#define BENCH_UNIT "ns"
+static uint64_t bench_start(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#define bench_stop bench_start
+#endif
+
+static int bench_cmp(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Sorts t[0..n-1] and prints one JSON member "name": {...} for it. */
+static void bench_report(const char *name, uint64_t *t, size_t n, int last) {
+    qsort(t, n, sizeof(uint64_t), bench_cmp);
+    printf("    \"%s\": {\"median\": %llu, \"p90\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu}%s\n",
+           name,
+           (unsigned long long)t[n / 2],
+           (unsigned long long)t[(n * 90) / 100],
+           (unsigned long long)t[(n * 99) / 100],
+           (unsigned long long)t[(n * 999) / 1000],
+           (unsigned long long)t[n - 1],
+           last ? "" : ",");
+}
+
+static uint64_t *bench_alloc(size_t n) {
+    uint64_t *t = malloc(n * sizeof(uint64_t));
+    if (t == NULL) {
+        perror("Malloc failed!");
+        exit(1);
+    }
+    return t;
+}
+
+#endif
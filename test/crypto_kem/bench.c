@@ -0,0 +1,387 @@
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "api.h"
+#include "../common/bench.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 1000
+#endif
+
+inline static void* malloc_s(size_t size) {
+    void *ptr = malloc(size);
+    if (ptr == NULL) {
+        perror("Malloc failed!");
+        exit(1);
+    }
+    return ptr;
+}
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+#define CRYPTO_BYTES           NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_PUBLICKEYBYTES  NAMESPACE(CRYPTO_PUBLICKEYBYTES)
+#define CRYPTO_SECRETKEYBYTES  NAMESPACE(CRYPTO_SECRETKEYBYTES)
+#define CRYPTO_CIPHERTEXTBYTES NAMESPACE(CRYPTO_CIPHERTEXTBYTES)
+#define CRYPTO_ALGNAME NAMESPACE(CRYPTO_ALGNAME)
+
+#define crypto_kem_keypair NAMESPACE(crypto_kem_keypair)
+#define crypto_kem_enc NAMESPACE(crypto_kem_enc)
+#define crypto_kem_dec NAMESPACE(crypto_kem_dec)
+
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+#define CRYPTO_EXPANDEDPUBLICKEYBYTES NAMESPACE(CRYPTO_EXPANDEDPUBLICKEYBYTES)
+#define crypto_kem_pk_expand NAMESPACE(crypto_kem_pk_expand)
+#define crypto_kem_enc_expanded NAMESPACE(crypto_kem_enc_expanded)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+#define CRYPTO_EXPANDEDSECRETKEYBYTES NAMESPACE(CRYPTO_EXPANDEDSECRETKEYBYTES)
+#define crypto_kem_sk_expand NAMESPACE(crypto_kem_sk_expand)
+#define crypto_kem_dec_expanded NAMESPACE(crypto_kem_dec_expanded)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+#define CRYPTO_KEYPAIRCOINBYTES NAMESPACE(CRYPTO_KEYPAIRCOINBYTES)
+#define crypto_kem_keypair_derand NAMESPACE(crypto_kem_keypair_derand)
+#define crypto_kem_sk_expand_from_seed NAMESPACE(crypto_kem_sk_expand_from_seed)
+#define crypto_kem_dec_from_seed NAMESPACE(crypto_kem_dec_from_seed)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+#define crypto_kem_keypair_batch NAMESPACE(crypto_kem_keypair_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+#define crypto_kem_enc_batch NAMESPACE(crypto_kem_enc_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+#define crypto_kem_dec_batch NAMESPACE(crypto_kem_dec_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+#define CRYPTO_MKEMSEEDBYTES NAMESPACE(CRYPTO_MKEMSEEDBYTES)
+#define CRYPTO_MKEMSHAREDBYTES NAMESPACE(CRYPTO_MKEMSHAREDBYTES)
+#define CRYPTO_MKEMRECIPIENTBYTES NAMESPACE(CRYPTO_MKEMRECIPIENTBYTES)
+#define crypto_kem_mkem_keypair NAMESPACE(crypto_kem_mkem_keypair)
+#define crypto_kem_mkem_enc NAMESPACE(crypto_kem_mkem_enc)
+#define crypto_kem_mkem_dec NAMESPACE(crypto_kem_mkem_dec)
+#endif
+
+// Batched operations are timed over this many items and reported per item
+#define BENCH_BATCH 8
+
+/*
+ * Usage: bench [iterations]
+ *
+ * Times every operation separately and prints the median, 90th, 99th and
+ * 99.9th percentile and maximum as JSON on stdout.
+ */
+int main(int argc, char **argv) {
+    size_t iterations = BENCH_ITERATIONS;
+    size_t i;
+    uint64_t t0;
+    int res = 0;
+
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 10);
+    }
+    if (iterations == 0) {
+        fprintf(stderr, "ERROR iteration count must be positive\n");
+        return 1;
+    }
+
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *ct = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(CRYPTO_BYTES);
+    uint64_t *t_keypair = bench_alloc(iterations);
+    uint64_t *t_enc = bench_alloc(iterations);
+    uint64_t *t_dec = bench_alloc(iterations);
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+    uint8_t *expanded = malloc_s(CRYPTO_EXPANDEDPUBLICKEYBYTES);
+    uint64_t *t_pk_expand = bench_alloc(iterations);
+    uint64_t *t_enc_expanded = bench_alloc(iterations);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+    uint8_t *expanded_sk = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES);
+    uint64_t *t_sk_expand = bench_alloc(iterations);
+    uint64_t *t_dec_expanded = bench_alloc(iterations);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+    uint8_t *pk_kbatch = malloc_s(BENCH_BATCH * CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk_kbatch = malloc_s(BENCH_BATCH * CRYPTO_SECRETKEYBYTES);
+    uint8_t *pkk[BENCH_BATCH], *skk[BENCH_BATCH];
+    uint64_t *t_keypair_batch = bench_alloc(iterations);
+    for (i = 0; i < BENCH_BATCH; i++) {
+        pkk[i] = pk_kbatch + i * CRYPTO_PUBLICKEYBYTES;
+        skk[i] = sk_kbatch + i * CRYPTO_SECRETKEYBYTES;
+    }
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+    uint8_t *ct_batch = malloc_s(BENCH_BATCH * CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *ss_batch = malloc_s(BENCH_BATCH * CRYPTO_BYTES);
+    uint8_t *cts[BENCH_BATCH], *sss[BENCH_BATCH];
+    const uint8_t *pks[BENCH_BATCH];
+    uint64_t *t_enc_batch = bench_alloc(iterations);
+    for (i = 0; i < BENCH_BATCH; i++) {
+        cts[i] = ct_batch + i * CRYPTO_CIPHERTEXTBYTES;
+        sss[i] = ss_batch + i * CRYPTO_BYTES;
+        pks[i] = pk;
+    }
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+    uint8_t *ss_dec_batch = malloc_s(BENCH_BATCH * CRYPTO_BYTES);
+    uint8_t *ssd[BENCH_BATCH];
+    const uint8_t *ctd[BENCH_BATCH];
+    uint64_t *t_dec_batch = bench_alloc(iterations);
+    for (i = 0; i < BENCH_BATCH; i++) {
+        ssd[i] = ss_dec_batch + i * CRYPTO_BYTES;
+        ctd[i] = ct;
+    }
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+    uint8_t seed[CRYPTO_KEYPAIRCOINBYTES];
+    uint8_t *expanded_seed = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES);
+    uint64_t *t_sk_expand_from_seed = bench_alloc(iterations);
+    uint64_t *t_dec_from_seed = bench_alloc(iterations);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+    uint8_t matrixseed[CRYPTO_MKEMSEEDBYTES] = {0};
+    uint8_t *pk_mkem = malloc_s(BENCH_BATCH * CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk_mkem = malloc_s(BENCH_BATCH * CRYPTO_SECRETKEYBYTES);
+    uint8_t *ct_mkem_shared = malloc_s(CRYPTO_MKEMSHAREDBYTES);
+    uint8_t *ct_mkem = malloc_s(BENCH_BATCH * CRYPTO_MKEMRECIPIENTBYTES);
+    uint8_t *ctm[BENCH_BATCH];
+    const uint8_t *pkm[BENCH_BATCH];
+    uint64_t *t_mkem_enc = bench_alloc(iterations);
+    uint64_t *t_mkem_dec = bench_alloc(iterations);
+    for (i = 0; i < BENCH_BATCH; i++) {
+        ctm[i] = ct_mkem + i * CRYPTO_MKEMRECIPIENTBYTES;
+        pkm[i] = pk_mkem + i * CRYPTO_PUBLICKEYBYTES;
+        res |= crypto_kem_mkem_keypair(pk_mkem + i * CRYPTO_PUBLICKEYBYTES, sk_mkem + i * CRYPTO_SECRETKEYBYTES, matrixseed);
+    }
+#endif
+
+    for (i = 0; i < iterations; i++) {
+        t0 = bench_start();
+        res |= crypto_kem_keypair(pk, sk);
+        t_keypair[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_kem_enc(ct, key_b, pk);
+        t_enc[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_kem_dec(key_a, ct, sk);
+        t_dec[i] = bench_stop() - t0;
+
+        if (res != 0 || memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR KEYS\n");
+            res = 1;
+            goto end;
+        }
+
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+        t0 = bench_start();
+        res |= crypto_kem_pk_expand(expanded, pk);
+        t_pk_expand[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_kem_enc_expanded(ct, key_b, expanded);
+        t_enc_expanded[i] = bench_stop() - t0;
+
+        res |= crypto_kem_dec(key_a, ct, sk);
+        if (res != 0 || memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR expanded KEYS\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+        t0 = bench_start();
+        res |= crypto_kem_sk_expand(expanded_sk, sk);
+        t_sk_expand[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_kem_dec_expanded(key_a, ct, expanded_sk);
+        t_dec_expanded[i] = bench_stop() - t0;
+
+        if (res != 0 || memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR expanded sk KEYS\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+        t0 = bench_start();
+        res |= crypto_kem_enc_batch(cts, sss, pks, BENCH_BATCH);
+        t_enc_batch[i] = (bench_stop() - t0) / BENCH_BATCH;
+
+        res |= crypto_kem_dec(key_a, cts[BENCH_BATCH - 1], sk);
+        if (res != 0 || memcmp(key_a, sss[BENCH_BATCH - 1], CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR batch KEYS\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+        t0 = bench_start();
+        res |= crypto_kem_dec_batch(ssd, ctd, sk, BENCH_BATCH);
+        t_dec_batch[i] = (bench_stop() - t0) / BENCH_BATCH;
+
+        if (res != 0 || memcmp(key_b, ssd[BENCH_BATCH - 1], CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR dec batch KEYS\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+        // Replaces the key pair of this iteration by one derived from a seed
+        memset(seed, (int)i, sizeof(seed));
+        res |= crypto_kem_keypair_derand(pk, sk, seed);
+        res |= crypto_kem_enc(ct, key_b, pk);
+
+        t0 = bench_start();
+        res |= crypto_kem_sk_expand_from_seed(expanded_seed, seed);
+        t_sk_expand_from_seed[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_kem_dec_from_seed(key_a, ct, seed);
+        t_dec_from_seed[i] = bench_stop() - t0;
+
+        if (res != 0 || memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR from seed KEYS\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+        t0 = bench_start();
+        res |= crypto_kem_mkem_enc(ct_mkem_shared, ctm, key_b, pkm, BENCH_BATCH);
+        t_mkem_enc[i] = (bench_stop() - t0) / BENCH_BATCH;
+
+        t0 = bench_start();
+        res |= crypto_kem_mkem_dec(key_a, ct_mkem_shared, ctm[BENCH_BATCH - 1], sk_mkem + (BENCH_BATCH - 1) * CRYPTO_SECRETKEYBYTES);
+        t_mkem_dec[i] = bench_stop() - t0;
+
+        if (res != 0 || memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR mkem KEYS\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+        t0 = bench_start();
+        res |= crypto_kem_keypair_batch(pkk, skk, BENCH_BATCH);
+        t_keypair_batch[i] = (bench_stop() - t0) / BENCH_BATCH;
+
+        res |= crypto_kem_enc(ct, key_b, pkk[BENCH_BATCH - 1]);
+        res |= crypto_kem_dec(key_a, ct, skk[BENCH_BATCH - 1]);
+        if (res != 0 || memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            fprintf(stderr, "ERROR batch keypair KEYS\n");
+            res = 1;
+            goto end;
+        }
+#endif
+    }
+
+    printf("{\n");
+    printf("  \"scheme\": \"%s\",\n", CRYPTO_ALGNAME);
+    printf("  \"implementation\": \"%s\",\n", STR(PQCLEAN_NAMESPACE));
+    printf("  \"unit\": \"%s\",\n", BENCH_UNIT);
+    printf("  \"iterations\": %llu,\n", (unsigned long long)iterations);
+    printf("  \"operations\": {\n");
+    bench_report("keypair", t_keypair, iterations, 0);
+    bench_report("enc", t_enc, iterations, 0);
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+    bench_report("pk_expand", t_pk_expand, iterations, 0);
+    bench_report("enc_expanded", t_enc_expanded, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+    bench_report("sk_expand", t_sk_expand, iterations, 0);
+    bench_report("dec_expanded", t_dec_expanded, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+    bench_report("keypair_batch", t_keypair_batch, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+    bench_report("enc_batch", t_enc_batch, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+    bench_report("dec_batch", t_dec_batch, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+    bench_report("sk_expand_from_seed", t_sk_expand_from_seed, iterations, 0);
+    bench_report("dec_from_seed", t_dec_from_seed, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+    bench_report("mkem_enc", t_mkem_enc, iterations, 0);
+    bench_report("mkem_dec", t_mkem_dec, iterations, 0);
+#endif
+    bench_report("dec", t_dec, iterations, 1);
+    printf("  }\n");
+    printf("}\n");
+
+end:
+    free(pk);
+    free(sk);
+    free(ct);
+    free(key_a);
+    free(key_b);
+    free(t_keypair);
+    free(t_enc);
+    free(t_dec);
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+    free(expanded);
+    free(t_pk_expand);
+    free(t_enc_expanded);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+    free(expanded_sk);
+    free(t_sk_expand);
+    free(t_dec_expanded);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+    free(pk_kbatch);
+    free(sk_kbatch);
+    free(t_keypair_batch);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+    free(ct_batch);
+    free(ss_batch);
+    free(t_enc_batch);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+    free(ss_dec_batch);
+    free(t_dec_batch);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+    free(expanded_seed);
+    free(t_sk_expand_from_seed);
+    free(t_dec_from_seed);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+    free(pk_mkem);
+    free(sk_mkem);
+    free(ct_mkem_shared);
+    free(ct_mkem);
+    free(t_mkem_enc);
+    free(t_mkem_dec);
+#endif
+
+    return res;
+}
@@ -50,11 +50,52 @@ inline static void* malloc_s(size_t size) {
 #define CRYPTO_PUBLICKEYBYTES  NAMESPACE(CRYPTO_PUBLICKEYBYTES)
 #define CRYPTO_SECRETKEYBYTES  NAMESPACE(CRYPTO_SECRETKEYBYTES)
 #define CRYPTO_CIPHERTEXTBYTES NAMESPACE(CRYPTO_CIPHERTEXTBYTES)
+#define CRYPTO_KEYPAIRCOINBYTES NAMESPACE(CRYPTO_KEYPAIRCOINBYTES)
+#define CRYPTO_ENCCOINBYTES    NAMESPACE(CRYPTO_ENCCOINBYTES)
 #define CRYPTO_ALGNAME NAMESPACE(CRYPTO_ALGNAME)
 
 #define crypto_kem_keypair NAMESPACE(crypto_kem_keypair)
 #define crypto_kem_enc NAMESPACE(crypto_kem_enc)
 #define crypto_kem_dec NAMESPACE(crypto_kem_dec)
+#define crypto_kem_keypair_derand NAMESPACE(crypto_kem_keypair_derand)
+#define crypto_kem_enc_derand NAMESPACE(crypto_kem_enc_derand)
+
+// Optional functions are announced by the Makefile as PQCLEAN_HAVE_<name>
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+#define CRYPTO_EXPANDEDPUBLICKEYBYTES NAMESPACE(CRYPTO_EXPANDEDPUBLICKEYBYTES)
+#define crypto_kem_pk_expand NAMESPACE(crypto_kem_pk_expand)
+#define crypto_kem_enc_expanded NAMESPACE(crypto_kem_enc_expanded)
+#define crypto_kem_enc_expanded_derand NAMESPACE(crypto_kem_enc_expanded_derand)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+#define CRYPTO_EXPANDEDSECRETKEYBYTES NAMESPACE(CRYPTO_EXPANDEDSECRETKEYBYTES)
+#define crypto_kem_sk_expand NAMESPACE(crypto_kem_sk_expand)
+#define crypto_kem_dec_expanded NAMESPACE(crypto_kem_dec_expanded)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+#define crypto_kem_sk_expand_from_seed NAMESPACE(crypto_kem_sk_expand_from_seed)
+#define crypto_kem_dec_from_seed NAMESPACE(crypto_kem_dec_from_seed)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+#define crypto_kem_keypair_batch NAMESPACE(crypto_kem_keypair_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+#define crypto_kem_enc_batch NAMESPACE(crypto_kem_enc_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+#define crypto_kem_dec_batch NAMESPACE(crypto_kem_dec_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+#define CRYPTO_MKEMSEEDBYTES NAMESPACE(CRYPTO_MKEMSEEDBYTES)
+#define CRYPTO_MKEMSHAREDBYTES NAMESPACE(CRYPTO_MKEMSHAREDBYTES)
+#define CRYPTO_MKEMRECIPIENTBYTES NAMESPACE(CRYPTO_MKEMRECIPIENTBYTES)
+#define crypto_kem_mkem_keypair NAMESPACE(crypto_kem_mkem_keypair)
+#define crypto_kem_mkem_enc NAMESPACE(crypto_kem_mkem_enc)
+#define crypto_kem_mkem_dec NAMESPACE(crypto_kem_mkem_dec)
+#endif
+
+// Number of operations for the batch tests, enough to cover a partial final batch
+#define NBATCH 11
 
 #define RETURNS_ZERO(f)                           \
     if ((f) != 0) {                               \
@@ -247,6 +288,509 @@ end:
     return res;
 }
 
+static int test_derand(void) {
+    uint8_t *sk_a = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *sk_b = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk_a = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *pk_b = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sendb_a = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *sendb_b = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_c = malloc_s(CRYPTO_BYTES);
+    // One spare byte so that neither array has length zero
+    uint8_t keypair_coins[CRYPTO_KEYPAIRCOINBYTES + 1];
+    uint8_t enc_coins[CRYPTO_ENCCOINBYTES + 1];
+    int i;
+    int res = 0;
+
+    for (i = 0; i < NTESTS; i++) {
+        randombytes(keypair_coins, sizeof(keypair_coins));
+        randombytes(enc_coins, sizeof(enc_coins));
+
+        // The same coins must give the same outputs
+        RETURNS_ZERO(crypto_kem_keypair_derand(pk_a, sk_a, keypair_coins));
+        RETURNS_ZERO(crypto_kem_keypair_derand(pk_b, sk_b, keypair_coins));
+        RETURNS_ZERO(crypto_kem_enc_derand(sendb_a, key_a, pk_a, enc_coins));
+        RETURNS_ZERO(crypto_kem_enc_derand(sendb_b, key_b, pk_a, enc_coins));
+
+        if (memcmp(pk_a, pk_b, CRYPTO_PUBLICKEYBYTES) != 0 ||
+                memcmp(sk_a, sk_b, CRYPTO_SECRETKEYBYTES) != 0) {
+            printf("ERROR crypto_kem_keypair_derand is not deterministic\n");
+            res = 1;
+            goto end;
+        }
+        if (memcmp(sendb_a, sendb_b, CRYPTO_CIPHERTEXTBYTES) != 0 ||
+                memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            printf("ERROR crypto_kem_enc_derand is not deterministic\n");
+            res = 1;
+            goto end;
+        }
+
+        RETURNS_ZERO(crypto_kem_dec(key_c, sendb_a, sk_a));
+        if (memcmp(key_a, key_c, CRYPTO_BYTES) != 0) {
+            printf("ERROR derand KEYS\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    free(sk_a);
+    free(sk_b);
+    free(pk_a);
+    free(pk_b);
+    free(sendb_a);
+    free(sendb_b);
+    free(key_a);
+    free(key_b);
+    free(key_c);
+
+    return res;
+}
+
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+static int test_expanded(void) {
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *expanded = malloc_s(CRYPTO_EXPANDEDPUBLICKEYBYTES + 16);
+    uint8_t *sendb_a = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *sendb_b = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(CRYPTO_BYTES);
+    uint8_t enc_coins[CRYPTO_ENCCOINBYTES + 1];
+    int i;
+    int res = 0;
+
+    for (i = 0; i < NTESTS; i++) {
+        RETURNS_ZERO(crypto_kem_keypair(pk, sk));
+
+        write_canary(expanded);
+        write_canary(expanded + CRYPTO_EXPANDEDPUBLICKEYBYTES + 8);
+        RETURNS_ZERO(crypto_kem_pk_expand(expanded + 8, pk));
+        if (check_canary(expanded) || check_canary(expanded + CRYPTO_EXPANDEDPUBLICKEYBYTES + 8)) {
+            printf("ERROR canary overwritten by crypto_kem_pk_expand\n");
+            res = 1;
+            goto end;
+        }
+
+        // Encapsulating to the expanded key must match the plain one
+        randombytes(enc_coins, sizeof(enc_coins));
+        RETURNS_ZERO(crypto_kem_enc_derand(sendb_a, key_a, pk, enc_coins));
+        RETURNS_ZERO(crypto_kem_enc_expanded_derand(sendb_b, key_b, expanded + 8, enc_coins));
+        if (memcmp(sendb_a, sendb_b, CRYPTO_CIPHERTEXTBYTES) != 0 ||
+                memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            printf("ERROR crypto_kem_enc_expanded_derand differs from crypto_kem_enc_derand\n");
+            res = 1;
+            goto end;
+        }
+
+        RETURNS_ZERO(crypto_kem_enc_expanded(sendb_a, key_a, expanded + 8));
+        RETURNS_ZERO(crypto_kem_dec(key_b, sendb_a, sk));
+        if (memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            printf("ERROR expanded KEYS\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    free(sk);
+    free(pk);
+    free(expanded);
+    free(sendb_a);
+    free(sendb_b);
+    free(key_a);
+    free(key_b);
+
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+static int test_expanded_sk(void) {
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *expanded = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES + 16);
+    uint8_t *sendb = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_c = malloc_s(CRYPTO_BYTES);
+    int i;
+    int res = 0;
+
+    for (i = 0; i < NTESTS; i++) {
+        RETURNS_ZERO(crypto_kem_keypair(pk, sk));
+
+        write_canary(expanded);
+        write_canary(expanded + CRYPTO_EXPANDEDSECRETKEYBYTES + 8);
+        RETURNS_ZERO(crypto_kem_sk_expand(expanded + 8, sk));
+        if (check_canary(expanded) || check_canary(expanded + CRYPTO_EXPANDEDSECRETKEYBYTES + 8)) {
+            printf("ERROR canary overwritten by crypto_kem_sk_expand\n");
+            res = 1;
+            goto end;
+        }
+
+        RETURNS_ZERO(crypto_kem_enc(sendb, key_a, pk));
+        RETURNS_ZERO(crypto_kem_dec_expanded(key_b, sendb, expanded + 8));
+        if (memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            printf("ERROR expanded sk KEYS\n");
+            res = 1;
+            goto end;
+        }
+
+        // Implicit rejection must also give the same result
+        sendb[0] ^= 1;
+        RETURNS_ZERO(crypto_kem_dec(key_b, sendb, sk));
+        RETURNS_ZERO(crypto_kem_dec_expanded(key_c, sendb, expanded + 8));
+        if (memcmp(key_b, key_c, CRYPTO_BYTES) != 0) {
+            printf("ERROR crypto_kem_dec_expanded differs from crypto_kem_dec on invalid ciphertext\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    free(sk);
+    free(pk);
+    free(expanded);
+    free(sendb);
+    free(key_a);
+    free(key_b);
+    free(key_c);
+
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+static int test_from_seed(void) {
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *expanded_a = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES);
+    uint8_t *expanded_b = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES + 16);
+    uint8_t *sendb = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(CRYPTO_BYTES);
+    uint8_t seed[CRYPTO_KEYPAIRCOINBYTES];
+    int i;
+    int res = 0;
+
+    for (i = 0; i < NTESTS; i++) {
+        randombytes(seed, sizeof(seed));
+        RETURNS_ZERO(crypto_kem_keypair_derand(pk, sk, seed));
+
+        // Expanding from the seed must match expanding the secret key
+        RETURNS_ZERO(crypto_kem_sk_expand(expanded_a, sk));
+        write_canary(expanded_b);
+        write_canary(expanded_b + CRYPTO_EXPANDEDSECRETKEYBYTES + 8);
+        RETURNS_ZERO(crypto_kem_sk_expand_from_seed(expanded_b + 8, seed));
+        if (check_canary(expanded_b) || check_canary(expanded_b + CRYPTO_EXPANDEDSECRETKEYBYTES + 8)) {
+            printf("ERROR canary overwritten by crypto_kem_sk_expand_from_seed\n");
+            res = 1;
+            goto end;
+        }
+        if (memcmp(expanded_a, expanded_b + 8, CRYPTO_EXPANDEDSECRETKEYBYTES) != 0) {
+            printf("ERROR crypto_kem_sk_expand_from_seed differs from crypto_kem_sk_expand\n");
+            res = 1;
+            goto end;
+        }
+
+        RETURNS_ZERO(crypto_kem_enc(sendb, key_a, pk));
+        RETURNS_ZERO(crypto_kem_dec_from_seed(key_b, sendb, seed));
+        if (memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            printf("ERROR from seed KEYS\n");
+            res = 1;
+            goto end;
+        }
+
+        // Implicit rejection must also give the same result
+        sendb[0] ^= 1;
+        RETURNS_ZERO(crypto_kem_dec(key_a, sendb, sk));
+        RETURNS_ZERO(crypto_kem_dec_from_seed(key_b, sendb, seed));
+        if (memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            printf("ERROR crypto_kem_dec_from_seed differs from crypto_kem_dec on invalid ciphertext\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    free(sk);
+    free(pk);
+    free(expanded_a);
+    free(expanded_b);
+    free(sendb);
+    free(key_a);
+    free(key_b);
+
+    return res;
+}
+#endif
+
+#if defined(PQCLEAN_HAVE_crypto_kem_keypair_batch) || defined(PQCLEAN_HAVE_crypto_kem_enc_batch)
+// Deterministic randombytes() replacement, so that batched and sequential
+// calls can be compared under the same randomness
+static int counter_randombytes(void *ctx, uint8_t *output, size_t n) {
+    uint32_t *state = ctx;
+    size_t i;
+    for (i = 0; i < n; i++) {
+        *state = *state * 1103515245 + 12345;
+        output[i] = (uint8_t)(*state >> 16);
+    }
+    return 0;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+static int test_keypair_batch(void) {
+    uint8_t *pk_a = malloc_s(NBATCH * CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk_a = malloc_s(NBATCH * CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk_b = malloc_s(NBATCH * CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk_b = malloc_s(NBATCH * CRYPTO_SECRETKEYBYTES);
+    uint8_t *sendb = malloc_s(CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(CRYPTO_BYTES);
+    uint8_t *pks[NBATCH], *sks[NBATCH];
+    uint32_t state;
+    int i, n;
+    int res = 0;
+
+    for (i = 0; i < NBATCH; i++) {
+        pks[i] = pk_a + i * CRYPTO_PUBLICKEYBYTES;
+        sks[i] = sk_a + i * CRYPTO_SECRETKEYBYTES;
+    }
+
+    // Every batch size up to NBATCH, to cover partially filled lanes
+    for (n = 1; n <= NBATCH; n++) {
+        state = (uint32_t)n;
+        randombytes_set_provider(counter_randombytes, &state);
+        RETURNS_ZERO(crypto_kem_keypair_batch(pks, sks, (size_t)n));
+        state = (uint32_t)n;
+        for (i = 0; i < n; i++) {
+            RETURNS_ZERO(crypto_kem_keypair(pk_b + i * CRYPTO_PUBLICKEYBYTES, sk_b + i * CRYPTO_SECRETKEYBYTES));
+        }
+        randombytes_set_provider(NULL, NULL);
+
+        if (memcmp(pk_a, pk_b, n * CRYPTO_PUBLICKEYBYTES) != 0 ||
+                memcmp(sk_a, sk_b, n * CRYPTO_SECRETKEYBYTES) != 0) {
+            printf("ERROR crypto_kem_keypair_batch differs from crypto_kem_keypair\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+    for (i = 0; i < NBATCH; i++) {
+        RETURNS_ZERO(crypto_kem_enc(sendb, key_b, pks[i]));
+        RETURNS_ZERO(crypto_kem_dec(key_a, sendb, sks[i]));
+        if (memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+            printf("ERROR batch keypair KEYS\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    randombytes_set_provider(NULL, NULL);
+    free(pk_a);
+    free(sk_a);
+    free(pk_b);
+    free(sk_b);
+    free(sendb);
+    free(key_a);
+    free(key_b);
+
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+static int test_enc_batch(void) {
+    uint8_t *sk = malloc_s(NBATCH * CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk = malloc_s(NBATCH * CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sendb_a = malloc_s(NBATCH * CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *sendb_b = malloc_s(NBATCH * CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(NBATCH * CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(NBATCH * CRYPTO_BYTES);
+    uint8_t *ct[NBATCH], *ss[NBATCH];
+    const uint8_t *pks[NBATCH];
+    uint32_t state;
+    int i;
+    int res = 0;
+
+    for (i = 0; i < NBATCH; i++) {
+        RETURNS_ZERO(crypto_kem_keypair(pk + i * CRYPTO_PUBLICKEYBYTES, sk + i * CRYPTO_SECRETKEYBYTES));
+        ct[i] = sendb_a + i * CRYPTO_CIPHERTEXTBYTES;
+        ss[i] = key_a + i * CRYPTO_BYTES;
+        pks[i] = pk + i * CRYPTO_PUBLICKEYBYTES;
+    }
+
+    state = 1;
+    randombytes_set_provider(counter_randombytes, &state);
+    RETURNS_ZERO(crypto_kem_enc_batch(ct, ss, pks, NBATCH));
+    state = 1;
+    for (i = 0; i < NBATCH; i++) {
+        RETURNS_ZERO(crypto_kem_enc(sendb_b + i * CRYPTO_CIPHERTEXTBYTES, key_b + i * CRYPTO_BYTES, pks[i]));
+    }
+    randombytes_set_provider(NULL, NULL);
+
+    if (memcmp(sendb_a, sendb_b, NBATCH * CRYPTO_CIPHERTEXTBYTES) != 0 ||
+            memcmp(key_a, key_b, NBATCH * CRYPTO_BYTES) != 0) {
+        printf("ERROR crypto_kem_enc_batch differs from crypto_kem_enc\n");
+        res = 1;
+        goto end;
+    }
+    for (i = 0; i < NBATCH; i++) {
+        RETURNS_ZERO(crypto_kem_dec(key_b, ct[i], sk + i * CRYPTO_SECRETKEYBYTES));
+        if (memcmp(key_b, ss[i], CRYPTO_BYTES) != 0) {
+            printf("ERROR batch KEYS\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    randombytes_set_provider(NULL, NULL);
+    free(sk);
+    free(pk);
+    free(sendb_a);
+    free(sendb_b);
+    free(key_a);
+    free(key_b);
+
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+static int test_dec_batch(void) {
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sendb = malloc_s(NBATCH * CRYPTO_CIPHERTEXTBYTES);
+    uint8_t *key_a = malloc_s(NBATCH * CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(NBATCH * CRYPTO_BYTES);
+    uint8_t *key_c = malloc_s(NBATCH * CRYPTO_BYTES);
+    const uint8_t *ct[NBATCH];
+    uint8_t *ss[NBATCH];
+    int i;
+    int res = 0;
+
+    RETURNS_ZERO(crypto_kem_keypair(pk, sk));
+    for (i = 0; i < NBATCH; i++) {
+        RETURNS_ZERO(crypto_kem_enc(sendb + i * CRYPTO_CIPHERTEXTBYTES, key_a + i * CRYPTO_BYTES, pk));
+        ct[i] = sendb + i * CRYPTO_CIPHERTEXTBYTES;
+        ss[i] = key_b + i * CRYPTO_BYTES;
+    }
+    // Corrupt every third ciphertext to exercise the implicit rejection path
+    for (i = 0; i < NBATCH; i += 3) {
+        sendb[i * CRYPTO_CIPHERTEXTBYTES + i] ^= 1;
+    }
+
+    RETURNS_ZERO(crypto_kem_dec_batch(ss, ct, sk, NBATCH));
+    for (i = 0; i < NBATCH; i++) {
+        RETURNS_ZERO(crypto_kem_dec(key_c + i * CRYPTO_BYTES, ct[i], sk));
+    }
+
+    if (memcmp(key_b, key_c, NBATCH * CRYPTO_BYTES) != 0) {
+        printf("ERROR crypto_kem_dec_batch differs from crypto_kem_dec\n");
+        res = 1;
+        goto end;
+    }
+    for (i = 0; i < NBATCH; i++) {
+        if ((memcmp(key_a + i * CRYPTO_BYTES, key_b + i * CRYPTO_BYTES, CRYPTO_BYTES) == 0) != (i % 3 != 0)) {
+            printf("ERROR batch KEYS\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    free(sk);
+    free(pk);
+    free(sendb);
+    free(key_a);
+    free(key_b);
+    free(key_c);
+
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+static int test_mkem(void) {
+    uint8_t *pk = malloc_s(NBATCH * CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(NBATCH * CRYPTO_SECRETKEYBYTES);
+    uint8_t *ct_shared = malloc_s(CRYPTO_MKEMSHAREDBYTES);
+    uint8_t *ct = malloc_s(NBATCH * CRYPTO_MKEMRECIPIENTBYTES);
+    uint8_t *key_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *key_b = malloc_s(CRYPTO_BYTES);
+    uint8_t matrixseed[CRYPTO_MKEMSEEDBYTES];
+    const uint8_t *pks[NBATCH];
+    uint8_t *cts[NBATCH];
+    int i, j;
+    int res = 0;
+
+    for (j = 0; j < NBATCH; j++) {
+        pks[j] = pk + j * CRYPTO_PUBLICKEYBYTES;
+        cts[j] = ct + j * CRYPTO_MKEMRECIPIENTBYTES;
+    }
+
+    for (i = 0; i < NTESTS; i++) {
+        randombytes(matrixseed, sizeof(matrixseed));
+        for (j = 0; j < NBATCH; j++) {
+            RETURNS_ZERO(crypto_kem_mkem_keypair(pk + j * CRYPTO_PUBLICKEYBYTES, sk + j * CRYPTO_SECRETKEYBYTES, matrixseed));
+        }
+
+        RETURNS_ZERO(crypto_kem_mkem_enc(ct_shared, cts, key_a, pks, NBATCH));
+        for (j = 0; j < NBATCH; j++) {
+            RETURNS_ZERO(crypto_kem_mkem_dec(key_b, ct_shared, cts[j], sk + j * CRYPTO_SECRETKEYBYTES));
+            if (memcmp(key_a, key_b, CRYPTO_BYTES) != 0) {
+                printf("ERROR mkem KEYS for recipient %d\n", j);
+                res = 1;
+                goto end;
+            }
+        }
+
+        // A modified recipient component must be rejected
+        cts[0][0] ^= 1;
+        RETURNS_ZERO(crypto_kem_mkem_dec(key_b, ct_shared, cts[0], sk));
+        if (memcmp(key_a, key_b, CRYPTO_BYTES) == 0) {
+            printf("ERROR invalid mkem recipient component\n");
+            res = 1;
+            goto end;
+        }
+
+        // The rejection key must depend on the recipient component
+        cts[0][0] ^= 1;
+        cts[0][1] ^= 1;
+        RETURNS_ZERO(crypto_kem_mkem_dec(key_a, ct_shared, cts[0], sk));
+        if (memcmp(key_a, key_b, CRYPTO_BYTES) == 0) {
+            printf("ERROR mkem rejection key does not depend on the recipient component\n");
+            res = 1;
+            goto end;
+        }
+
+        // Recipients must share the matrix seed
+        RETURNS_ZERO(crypto_kem_keypair(pk, sk));
+        if (crypto_kem_mkem_enc(ct_shared, cts, key_a, pks, NBATCH) == 0) {
+            printf("ERROR crypto_kem_mkem_enc accepted keys with different matrix seeds\n");
+            res = 1;
+            goto end;
+        }
+    }
+
+end:
+    free(pk);
+    free(sk);
+    free(ct_shared);
+    free(ct);
+    free(key_a);
+    free(key_b);
+
+    return res;
+}
+#endif
+
 int main(void) {
     // Check if CRYPTO_ALGNAME is printable
     puts(CRYPTO_ALGNAME);
@@ -255,6 +799,28 @@ int main(void) {
     result += test_keys();
     result += test_invalid_sk_a();
     result += test_invalid_ciphertext();
+    result += test_derand();
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_expanded
+    result += test_expanded();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_expanded
+    result += test_expanded_sk();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_from_seed
+    result += test_from_seed();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_keypair_batch
+    result += test_keypair_batch();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_enc_batch
+    result += test_enc_batch();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_dec_batch
+    result += test_dec_batch();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_kem_mkem_enc
+    result += test_mkem();
+#endif
 
     if (result != 0) {
         puts("Errors occurred");
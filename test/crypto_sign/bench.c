@@ -0,0 +1,310 @@
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "api.h"
+#include "randombytes.h"
+#include "../common/bench.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 1000
+#endif
+
+inline static void* malloc_s(size_t size) {
+    void *ptr = malloc(size);
+    if (ptr == NULL) {
+        perror("Malloc failed!");
+        exit(1);
+    }
+    return ptr;
+}
+
+// https://stackoverflow.com/a/1489985/1711232
+#define PASTER(x, y) x##_##y
+#define EVALUATOR(x, y) PASTER(x, y)
+#define NAMESPACE(fun) EVALUATOR(PQCLEAN_NAMESPACE, fun)
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+#define CRYPTO_PUBLICKEYBYTES NAMESPACE(CRYPTO_PUBLICKEYBYTES)
+#define CRYPTO_SECRETKEYBYTES NAMESPACE(CRYPTO_SECRETKEYBYTES)
+#define CRYPTO_BYTES          NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_ALGNAME        NAMESPACE(CRYPTO_ALGNAME)
+
+#define crypto_sign_keypair NAMESPACE(crypto_sign_keypair)
+#define crypto_sign_signature NAMESPACE(crypto_sign_signature)
+#define crypto_sign_verify NAMESPACE(crypto_sign_verify)
+
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+#define CRYPTO_EXPANDEDSECRETKEYBYTES NAMESPACE(CRYPTO_EXPANDEDSECRETKEYBYTES)
+#define crypto_sign_sk_expand NAMESPACE(crypto_sign_sk_expand)
+#define crypto_sign_signature_expanded NAMESPACE(crypto_sign_signature_expanded)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+#define CRYPTO_EXPANDEDPUBLICKEYBYTES NAMESPACE(CRYPTO_EXPANDEDPUBLICKEYBYTES)
+#define crypto_sign_pk_expand NAMESPACE(crypto_sign_pk_expand)
+#define crypto_sign_verify_expanded NAMESPACE(crypto_sign_verify_expanded)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+#define crypto_sign_verify_batch NAMESPACE(crypto_sign_verify_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+#define CRYPTO_PRECOMPUTEDBYTES NAMESPACE(CRYPTO_PRECOMPUTEDBYTES)
+#define crypto_sign_precompute NAMESPACE(crypto_sign_precompute)
+#define crypto_sign_signature_precomputed NAMESPACE(crypto_sign_signature_precomputed)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+#define crypto_sign_signature_batch NAMESPACE(crypto_sign_signature_batch)
+#endif
+
+#define MLEN 32
+#define BENCH_BATCH 8
+#define BENCH_POOL 32
+
+/*
+ * Usage: bench [iterations]
+ *
+ * Times every operation separately and prints the median, 90th, 99th and
+ * 99.9th percentile and maximum as JSON on stdout.
+ */
+int main(int argc, char **argv) {
+    size_t iterations = BENCH_ITERATIONS;
+    size_t i;
+    uint64_t t0;
+    int res = 0;
+
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 10);
+    }
+    if (iterations == 0) {
+        fprintf(stderr, "ERROR iteration count must be positive\n");
+        return 1;
+    }
+
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *sig = malloc_s(CRYPTO_BYTES);
+    uint8_t m[MLEN];
+    size_t siglen;
+    uint64_t *t_keypair = bench_alloc(iterations);
+    uint64_t *t_sign = bench_alloc(iterations);
+    uint64_t *t_verify = bench_alloc(iterations);
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+    uint8_t *expanded_sk = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES);
+    uint64_t *t_sk_expand = bench_alloc(iterations);
+    uint64_t *t_sign_expanded = bench_alloc(iterations);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+    // Large enough that running dry is rarer than the 99th percentile
+    uint8_t *pool = malloc_s(BENCH_POOL * CRYPTO_PRECOMPUTEDBYTES);
+    size_t npool;
+    uint64_t *t_precompute = bench_alloc(iterations);
+    uint64_t *t_sign_precomputed = bench_alloc(iterations);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+    uint8_t *sig_sbatch = malloc_s(BENCH_BATCH * CRYPTO_BYTES);
+    uint8_t m_sbatch[BENCH_BATCH][MLEN];
+    uint8_t *sigs_out[BENCH_BATCH];
+    const uint8_t *ms_in[BENCH_BATCH];
+    size_t siglens_out[BENCH_BATCH], mlens_in[BENCH_BATCH];
+    uint64_t *t_sign_batch = bench_alloc(iterations);
+    for (i = 0; i < BENCH_BATCH; i++) {
+        sigs_out[i] = sig_sbatch + i * CRYPTO_BYTES;
+        ms_in[i] = m_sbatch[i];
+        mlens_in[i] = MLEN;
+    }
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+    uint8_t *expanded_pk = malloc_s(CRYPTO_EXPANDEDPUBLICKEYBYTES);
+    uint64_t *t_pk_expand = bench_alloc(iterations);
+    uint64_t *t_verify_expanded = bench_alloc(iterations);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+    // A batch of signatures under one key, as from a single signer
+    uint8_t *pk_batch = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk_batch = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *sig_batch = malloc_s(BENCH_BATCH * CRYPTO_BYTES);
+    uint8_t m_batch[BENCH_BATCH][MLEN];
+    const uint8_t *sigs[BENCH_BATCH], *ms[BENCH_BATCH], *pks[BENCH_BATCH];
+    size_t siglens[BENCH_BATCH], mlens[BENCH_BATCH];
+    int results[BENCH_BATCH];
+    uint64_t *t_verify_batch = bench_alloc(iterations);
+    res |= crypto_sign_keypair(pk_batch, sk_batch);
+    for (i = 0; i < BENCH_BATCH; i++) {
+        randombytes(m_batch[i], MLEN);
+        res |= crypto_sign_signature(sig_batch + i * CRYPTO_BYTES, &siglens[i], m_batch[i], MLEN, sk_batch);
+        sigs[i] = sig_batch + i * CRYPTO_BYTES;
+        ms[i] = m_batch[i];
+        mlens[i] = MLEN;
+        pks[i] = pk_batch;
+    }
+#endif
+
+    for (i = 0; i < iterations; i++) {
+        randombytes(m, MLEN);
+
+        t0 = bench_start();
+        res |= crypto_sign_keypair(pk, sk);
+        t_keypair[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_sign_signature(sig, &siglen, m, MLEN, sk);
+        t_sign[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_sign_verify(sig, siglen, m, MLEN, pk);
+        t_verify[i] = bench_stop() - t0;
+
+        if (res != 0) {
+            fprintf(stderr, "ERROR Signature did not verify correctly!\n");
+            res = 1;
+            goto end;
+        }
+
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+        t0 = bench_start();
+        res |= crypto_sign_sk_expand(expanded_sk, sk);
+        t_sk_expand[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_sign_signature_expanded(sig, &siglen, m, MLEN, expanded_sk);
+        t_sign_expanded[i] = bench_stop() - t0;
+
+        if (res != 0 || crypto_sign_verify(sig, siglen, m, MLEN, pk) != 0) {
+            fprintf(stderr, "ERROR expanded signature did not verify correctly!\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+        // The pool belongs to the fresh key; refilling it is the offline part
+        t0 = bench_start();
+        res |= crypto_sign_precompute(pool, BENCH_POOL, expanded_sk);
+        t_precompute[i] = (bench_stop() - t0) / BENCH_POOL;
+
+        npool = BENCH_POOL;
+        t0 = bench_start();
+        res |= crypto_sign_signature_precomputed(sig, &siglen, m, MLEN, expanded_sk, pool, &npool);
+        t_sign_precomputed[i] = bench_stop() - t0;
+
+        if (res != 0 || crypto_sign_verify(sig, siglen, m, MLEN, pk) != 0) {
+            fprintf(stderr, "ERROR precomputed signature did not verify correctly!\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+        randombytes(&m_sbatch[0][0], BENCH_BATCH * MLEN);
+        t0 = bench_start();
+        res |= crypto_sign_signature_batch(sigs_out, siglens_out, ms_in, mlens_in, sk, BENCH_BATCH);
+        t_sign_batch[i] = (bench_stop() - t0) / BENCH_BATCH;
+
+        if (res != 0 || crypto_sign_verify(sigs_out[BENCH_BATCH - 1], siglens_out[BENCH_BATCH - 1],
+                                           ms_in[BENCH_BATCH - 1], MLEN, pk) != 0) {
+            fprintf(stderr, "ERROR batch signature did not verify correctly!\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+        t0 = bench_start();
+        res |= crypto_sign_pk_expand(expanded_pk, pk);
+        t_pk_expand[i] = bench_stop() - t0;
+
+        t0 = bench_start();
+        res |= crypto_sign_verify_expanded(sig, siglen, m, MLEN, expanded_pk);
+        t_verify_expanded[i] = bench_stop() - t0;
+
+        if (res != 0) {
+            fprintf(stderr, "ERROR Signature did not verify against expanded public key!\n");
+            res = 1;
+            goto end;
+        }
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+        t0 = bench_start();
+        res |= crypto_sign_verify_batch(results, sigs, siglens, ms, mlens, pks, BENCH_BATCH);
+        t_verify_batch[i] = (bench_stop() - t0) / BENCH_BATCH;
+
+        if (res != 0) {
+            fprintf(stderr, "ERROR batch signatures did not verify correctly!\n");
+            res = 1;
+            goto end;
+        }
+#endif
+    }
+
+    printf("{\n");
+    printf("  \"scheme\": \"%s\",\n", CRYPTO_ALGNAME);
+    printf("  \"implementation\": \"%s\",\n", STR(PQCLEAN_NAMESPACE));
+    printf("  \"unit\": \"%s\",\n", BENCH_UNIT);
+    printf("  \"iterations\": %llu,\n", (unsigned long long)iterations);
+    printf("  \"operations\": {\n");
+    bench_report("keypair", t_keypair, iterations, 0);
+    bench_report("sign", t_sign, iterations, 0);
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+    bench_report("sk_expand", t_sk_expand, iterations, 0);
+    bench_report("sign_expanded", t_sign_expanded, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+    bench_report("precompute", t_precompute, iterations, 0);
+    bench_report("sign_precomputed", t_sign_precomputed, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+    bench_report("sign_batch", t_sign_batch, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+    bench_report("pk_expand", t_pk_expand, iterations, 0);
+    bench_report("verify_expanded", t_verify_expanded, iterations, 0);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+    bench_report("verify_batch", t_verify_batch, iterations, 0);
+#endif
+    bench_report("verify", t_verify, iterations, 1);
+    printf("  }\n");
+    printf("}\n");
+
+end:
+    free(pk);
+    free(sk);
+    free(sig);
+    free(t_keypair);
+    free(t_sign);
+    free(t_verify);
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+    free(expanded_sk);
+    free(t_sk_expand);
+    free(t_sign_expanded);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+    free(expanded_pk);
+    free(t_pk_expand);
+    free(t_verify_expanded);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+    free(pk_batch);
+    free(sk_batch);
+    free(sig_batch);
+    free(t_verify_batch);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+    free(pool);
+    free(t_precompute);
+    free(t_sign_precomputed);
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+    free(sig_sbatch);
+    free(t_sign_batch);
+#endif
+
+    return res;
+}
@@ -52,6 +52,7 @@ inline static void* malloc_s(size_t size) {
 #define CRYPTO_PUBLICKEYBYTES NAMESPACE(CRYPTO_PUBLICKEYBYTES)
 #define CRYPTO_SECRETKEYBYTES NAMESPACE(CRYPTO_SECRETKEYBYTES)
 #define CRYPTO_BYTES          NAMESPACE(CRYPTO_BYTES)
+#define CRYPTO_SIGNCOINBYTES  NAMESPACE(CRYPTO_SIGNCOINBYTES)
 #define CRYPTO_ALGNAME        NAMESPACE(CRYPTO_ALGNAME)
 
 #define crypto_sign_keypair NAMESPACE(crypto_sign_keypair)
@@ -59,6 +60,31 @@ inline static void* malloc_s(size_t size) {
 #define crypto_sign_open NAMESPACE(crypto_sign_open)
 #define crypto_sign_signature NAMESPACE(crypto_sign_signature)
 #define crypto_sign_verify NAMESPACE(crypto_sign_verify)
+#define crypto_sign_signature_derand NAMESPACE(crypto_sign_signature_derand)
+
+// Optional functions are announced by the Makefile as PQCLEAN_HAVE_<name>
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+#define CRYPTO_EXPANDEDSECRETKEYBYTES NAMESPACE(CRYPTO_EXPANDEDSECRETKEYBYTES)
+#define crypto_sign_sk_expand NAMESPACE(crypto_sign_sk_expand)
+#define crypto_sign_signature_expanded NAMESPACE(crypto_sign_signature_expanded)
+#define crypto_sign_signature_expanded_derand NAMESPACE(crypto_sign_signature_expanded_derand)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+#define CRYPTO_EXPANDEDPUBLICKEYBYTES NAMESPACE(CRYPTO_EXPANDEDPUBLICKEYBYTES)
+#define crypto_sign_pk_expand NAMESPACE(crypto_sign_pk_expand)
+#define crypto_sign_verify_expanded NAMESPACE(crypto_sign_verify_expanded)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+#define crypto_sign_verify_batch NAMESPACE(crypto_sign_verify_batch)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+#define CRYPTO_PRECOMPUTEDBYTES NAMESPACE(CRYPTO_PRECOMPUTEDBYTES)
+#define crypto_sign_precompute NAMESPACE(crypto_sign_precompute)
+#define crypto_sign_signature_precomputed NAMESPACE(crypto_sign_signature_precomputed)
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+#define crypto_sign_signature_batch NAMESPACE(crypto_sign_signature_batch)
+#endif
 
 #define RETURNS_ZERO(f)                           \
     if ((f) != 0) {                               \
@@ -277,6 +303,392 @@ end:
     return res;
 }
 
+static int test_sign_derand(void) {
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *sig_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *sig_b = malloc_s(CRYPTO_BYTES);
+    uint8_t *m = malloc_s(MLEN);
+    // One spare byte so that the array never has length zero
+    uint8_t coins[CRYPTO_SIGNCOINBYTES + 1];
+
+    size_t siglen_a, siglen_b;
+    int res = 0;
+
+    int i;
+
+    for (i = 0; i < NTESTS; i++) {
+        RETURNS_ZERO(crypto_sign_keypair(pk, sk));
+
+        randombytes(m, MLEN);
+        randombytes(coins, sizeof(coins));
+
+        // The same coins must give the same signature
+        RETURNS_ZERO(crypto_sign_signature_derand(sig_a, &siglen_a, m, MLEN, sk, coins));
+        RETURNS_ZERO(crypto_sign_signature_derand(sig_b, &siglen_b, m, MLEN, sk, coins));
+        if (siglen_a != siglen_b || memcmp(sig_a, sig_b, siglen_a) != 0) {
+            fprintf(stderr, "ERROR crypto_sign_signature_derand is not deterministic!\n");
+            res = 1;
+            goto end;
+        }
+
+        if (crypto_sign_verify(sig_a, siglen_a, m, MLEN, pk) != 0) {
+            fprintf(stderr, "ERROR derand signature did not verify correctly!\n");
+            res = 1;
+            goto end;
+        }
+    }
+end:
+    free(pk);
+    free(sk);
+    free(sig_a);
+    free(sig_b);
+    free(m);
+    return res;
+}
+
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+static int test_sign_expanded(void) {
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *expanded = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES + 16);
+    uint8_t *sig_a = malloc_s(CRYPTO_BYTES);
+    uint8_t *sig_b = malloc_s(CRYPTO_BYTES);
+    uint8_t *m = malloc_s(MLEN);
+    // One spare byte so that the array never has length zero
+    uint8_t coins[CRYPTO_SIGNCOINBYTES + 1];
+
+    size_t siglen_a, siglen_b;
+    int res = 0;
+
+    int i;
+
+    for (i = 0; i < NTESTS; i++) {
+        RETURNS_ZERO(crypto_sign_keypair(pk, sk));
+
+        write_canary(expanded);
+        write_canary(expanded + CRYPTO_EXPANDEDSECRETKEYBYTES + 8);
+        RETURNS_ZERO(crypto_sign_sk_expand(expanded + 8, sk));
+        if (check_canary(expanded) || check_canary(expanded + CRYPTO_EXPANDEDSECRETKEYBYTES + 8)) {
+            fprintf(stderr, "ERROR canary overwritten by crypto_sign_sk_expand\n");
+            res = 1;
+            goto end;
+        }
+
+        randombytes(m, MLEN);
+        randombytes(coins, sizeof(coins));
+
+        // Signing with the expanded key must match signing with the plain one
+        RETURNS_ZERO(crypto_sign_signature_derand(sig_a, &siglen_a, m, MLEN, sk, coins));
+        RETURNS_ZERO(crypto_sign_signature_expanded_derand(sig_b, &siglen_b, m, MLEN, expanded + 8, coins));
+        if (siglen_a != siglen_b || memcmp(sig_a, sig_b, siglen_a) != 0) {
+            fprintf(stderr, "ERROR crypto_sign_signature_expanded_derand differs from crypto_sign_signature_derand\n");
+            res = 1;
+            goto end;
+        }
+
+        RETURNS_ZERO(crypto_sign_signature_expanded(sig_a, &siglen_a, m, MLEN, expanded + 8));
+        if (crypto_sign_verify(sig_a, siglen_a, m, MLEN, pk) != 0) {
+            fprintf(stderr, "ERROR expanded signature did not verify correctly!\n");
+            res = 1;
+            goto end;
+        }
+    }
+end:
+    free(pk);
+    free(sk);
+    free(expanded);
+    free(sig_a);
+    free(sig_b);
+    free(m);
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+static int test_verify_expanded(void) {
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *expanded = malloc_s(CRYPTO_EXPANDEDPUBLICKEYBYTES + 16);
+    uint8_t *sig = malloc_s(CRYPTO_BYTES);
+    uint8_t *m = malloc_s(MLEN);
+
+    size_t siglen;
+    int res = 0;
+
+    int i;
+
+    for (i = 0; i < NTESTS; i++) {
+        RETURNS_ZERO(crypto_sign_keypair(pk, sk));
+
+        write_canary(expanded);
+        write_canary(expanded + CRYPTO_EXPANDEDPUBLICKEYBYTES + 8);
+        RETURNS_ZERO(crypto_sign_pk_expand(expanded + 8, pk));
+        if (check_canary(expanded) || check_canary(expanded + CRYPTO_EXPANDEDPUBLICKEYBYTES + 8)) {
+            fprintf(stderr, "ERROR canary overwritten by crypto_sign_pk_expand\n");
+            res = 1;
+            goto end;
+        }
+
+        randombytes(m, MLEN);
+        RETURNS_ZERO(crypto_sign_signature(sig, &siglen, m, MLEN, sk));
+
+        if (crypto_sign_verify_expanded(sig, siglen, m, MLEN, expanded + 8) != 0) {
+            fprintf(stderr, "ERROR signature did not verify against expanded public key!\n");
+            res = 1;
+            goto end;
+        }
+
+        // The expanded key must reject what the plain key rejects
+        m[i % MLEN] ^= 1;
+        if (crypto_sign_verify_expanded(sig, siglen, m, MLEN, expanded + 8) == 0 ||
+                crypto_sign_verify(sig, siglen, m, MLEN, pk) == 0) {
+            fprintf(stderr, "ERROR modified message verified against expanded public key!\n");
+            res = 1;
+            goto end;
+        }
+    }
+end:
+    free(pk);
+    free(sk);
+    free(expanded);
+    free(sig);
+    free(m);
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+#define NBATCH 19
+#define NBATCHKEYS 3
+
+static int test_verify_batch(void) {
+    uint8_t *pk = malloc_s(NBATCHKEYS * CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(NBATCHKEYS * CRYPTO_SECRETKEYBYTES);
+    uint8_t *pk_copy = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sig = malloc_s(NBATCH * CRYPTO_BYTES);
+    uint8_t *m = malloc_s(NBATCH * MLEN);
+    const uint8_t *sigs[NBATCH], *ms[NBATCH], *pks[NBATCH];
+    size_t siglens[NBATCH], mlens[NBATCH];
+    int results[NBATCH];
+    int ret, expected;
+    int res = 0;
+    int i;
+
+    for (i = 0; i < NBATCHKEYS; i++) {
+        RETURNS_ZERO(crypto_sign_keypair(pk + i * CRYPTO_PUBLICKEYBYTES, sk + i * CRYPTO_SECRETKEYBYTES));
+    }
+    // The same key at another address must be recognized as well
+    memcpy(pk_copy, pk, CRYPTO_PUBLICKEYBYTES);
+
+    randombytes(m, NBATCH * MLEN);
+    for (i = 0; i < NBATCH; i++) {
+        int k = i % NBATCHKEYS;
+        sigs[i] = sig + i * CRYPTO_BYTES;
+        ms[i] = m + i * MLEN;
+        mlens[i] = (size_t)((i * 131) % (MLEN + 1));
+        pks[i] = (i % 5 == 3 && k == 0) ? pk_copy : pk + k * CRYPTO_PUBLICKEYBYTES;
+        RETURNS_ZERO(crypto_sign_signature(sig + i * CRYPTO_BYTES, &siglens[i], ms[i], mlens[i],
+                                           sk + k * CRYPTO_SECRETKEYBYTES));
+    }
+
+    ret = crypto_sign_verify_batch(results, sigs, siglens, ms, mlens, pks, NBATCH);
+    for (i = 0; i < NBATCH; i++) {
+        if (ret != 0 || results[i] != 0) {
+            fprintf(stderr, "ERROR crypto_sign_verify_batch rejected valid signature %d!\n", i);
+            res = 1;
+            goto end;
+        }
+    }
+
+    // Break some items in different ways; the others must still verify
+    m[2 * MLEN] ^= 1;
+    mlens[2] = mlens[2] == 0 ? 1 : mlens[2];
+    sig[5 * CRYPTO_BYTES + CRYPTO_BYTES - 1] ^= 1;
+    sig[9 * CRYPTO_BYTES] ^= 1;
+    siglens[12] -= 1;
+    pks[16] = pk + ((16 + 1) % NBATCHKEYS) * CRYPTO_PUBLICKEYBYTES;
+
+    ret = crypto_sign_verify_batch(results, sigs, siglens, ms, mlens, pks, NBATCH);
+    if (ret == 0) {
+        fprintf(stderr, "ERROR crypto_sign_verify_batch accepted a batch with invalid signatures!\n");
+        res = 1;
+        goto end;
+    }
+    for (i = 0; i < NBATCH; i++) {
+        expected = crypto_sign_verify(sigs[i], siglens[i], ms[i], mlens[i], pks[i]) == 0 ? 0 : -1;
+        if (results[i] != expected) {
+            fprintf(stderr, "ERROR crypto_sign_verify_batch differs from crypto_sign_verify for signature %d!\n", i);
+            res = 1;
+            goto end;
+        }
+    }
+    if (results[2] == 0 || results[5] == 0 || results[9] == 0 || results[12] == 0 || results[16] == 0) {
+        fprintf(stderr, "ERROR crypto_sign_verify_batch accepted an invalid signature!\n");
+        res = 1;
+        goto end;
+    }
+
+end:
+    free(pk);
+    free(sk);
+    free(pk_copy);
+    free(sig);
+    free(m);
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+#define NPOOL 6
+
+static int test_sign_precomputed(void) {
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *expanded = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES);
+    uint8_t *pk2 = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk2 = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *expanded2 = malloc_s(CRYPTO_EXPANDEDSECRETKEYBYTES);
+    uint8_t *pool = malloc_s(NPOOL * CRYPTO_PRECOMPUTEDBYTES + 16);
+    uint8_t *sig = malloc_s(CRYPTO_BYTES);
+    uint8_t *m = malloc_s(MLEN);
+
+    size_t siglen, npool, before, j;
+    int res = 0;
+
+    int i;
+
+    for (i = 0; i < NTESTS; i++) {
+        RETURNS_ZERO(crypto_sign_keypair(pk, sk));
+        RETURNS_ZERO(crypto_sign_sk_expand(expanded, sk));
+
+        write_canary(pool);
+        write_canary(pool + NPOOL * CRYPTO_PRECOMPUTEDBYTES + 8);
+        RETURNS_ZERO(crypto_sign_precompute(pool + 8, NPOOL, expanded));
+        if (check_canary(pool) || check_canary(pool + NPOOL * CRYPTO_PRECOMPUTEDBYTES + 8)) {
+            fprintf(stderr, "ERROR canary overwritten by crypto_sign_precompute\n");
+            res = 1;
+            goto end;
+        }
+
+        // A pool made under another key must be refused and left untouched
+        RETURNS_ZERO(crypto_sign_keypair(pk2, sk2));
+        RETURNS_ZERO(crypto_sign_sk_expand(expanded2, sk2));
+        npool = NPOOL;
+        randombytes(m, MLEN);
+        if (crypto_sign_signature_precomputed(sig, &siglen, m, MLEN, expanded2, pool + 8, &npool) == 0 || npool != NPOOL) {
+            fprintf(stderr, "ERROR crypto_sign_signature_precomputed used a pool from a different key\n");
+            res = 1;
+            goto end;
+        }
+
+        // Drain the pool, then sign once more with it empty
+        npool = NPOOL;
+        do {
+            before = npool;
+            randombytes(m, MLEN);
+            RETURNS_ZERO(crypto_sign_signature_precomputed(sig, &siglen, m, MLEN, expanded, pool + 8, &npool));
+            if (crypto_sign_verify(sig, siglen, m, MLEN, pk) != 0) {
+                fprintf(stderr, "ERROR precomputed signature did not verify correctly!\n");
+                res = 1;
+                goto end;
+            }
+            if (before > 0 && npool >= before) {
+                fprintf(stderr, "ERROR crypto_sign_signature_precomputed did not consume the pool\n");
+                res = 1;
+                goto end;
+            }
+        } while (before > 0);
+
+        // Every consumed entry must have been erased
+        for (j = 0; j < NPOOL * CRYPTO_PRECOMPUTEDBYTES; j++) {
+            if (pool[8 + j] != 0) {
+                fprintf(stderr, "ERROR consumed pool entry was not erased\n");
+                res = 1;
+                goto end;
+            }
+        }
+        if (check_canary(pool) || check_canary(pool + NPOOL * CRYPTO_PRECOMPUTEDBYTES + 8)) {
+            fprintf(stderr, "ERROR canary overwritten by crypto_sign_signature_precomputed\n");
+            res = 1;
+            goto end;
+        }
+    }
+end:
+    free(pk);
+    free(sk);
+    free(expanded);
+    free(pk2);
+    free(sk2);
+    free(expanded2);
+    free(pool);
+    free(sig);
+    free(m);
+    return res;
+}
+#endif
+
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+#define NSIGNBATCH 11
+
+static int test_sign_batch(void) {
+    uint8_t *pk = malloc_s(CRYPTO_PUBLICKEYBYTES);
+    uint8_t *sk = malloc_s(CRYPTO_SECRETKEYBYTES);
+    uint8_t *sig = malloc_s(NSIGNBATCH * CRYPTO_BYTES + 16);
+    uint8_t *sig_ref = malloc_s(CRYPTO_BYTES);
+    uint8_t *m = malloc_s(NSIGNBATCH * MLEN);
+    uint8_t *sigs[NSIGNBATCH];
+    const uint8_t *ms[NSIGNBATCH];
+    size_t siglens[NSIGNBATCH], mlens[NSIGNBATCH];
+    size_t siglen_ref;
+    int res = 0;
+
+    int i, j;
+
+    for (i = 0; i < NTESTS; i++) {
+        RETURNS_ZERO(crypto_sign_keypair(pk, sk));
+
+        randombytes(m, NSIGNBATCH * MLEN);
+        for (j = 0; j < NSIGNBATCH; j++) {
+            sigs[j] = sig + 8 + j * CRYPTO_BYTES;
+            ms[j] = m + j * MLEN;
+            mlens[j] = (size_t)((j * 131 + i) % (MLEN + 1));
+        }
+
+        write_canary(sig);
+        write_canary(sig + NSIGNBATCH * CRYPTO_BYTES + 8);
+        RETURNS_ZERO(crypto_sign_signature_batch(sigs, siglens, ms, mlens, sk, NSIGNBATCH));
+        if (check_canary(sig) || check_canary(sig + NSIGNBATCH * CRYPTO_BYTES + 8)) {
+            fprintf(stderr, "ERROR canary overwritten by crypto_sign_signature_batch\n");
+            res = 1;
+            goto end;
+        }
+
+        // Every signature must equal the one from the sequential API
+        for (j = 0; j < NSIGNBATCH; j++) {
+            RETURNS_ZERO(crypto_sign_signature(sig_ref, &siglen_ref, ms[j], mlens[j], sk));
+            if (siglens[j] != siglen_ref || memcmp(sigs[j], sig_ref, siglen_ref) != 0) {
+                fprintf(stderr, "ERROR crypto_sign_signature_batch differs from crypto_sign_signature for message %d!\n", j);
+                res = 1;
+                goto end;
+            }
+            if (crypto_sign_verify(sigs[j], siglens[j], ms[j], mlens[j], pk) != 0) {
+                fprintf(stderr, "ERROR batch signature did not verify correctly!\n");
+                res = 1;
+                goto end;
+            }
+        }
+    }
+end:
+    free(pk);
+    free(sk);
+    free(sig);
+    free(sig_ref);
+    free(m);
+    return res;
+}
+#endif
+
 int main(void) {
     // check if CRYPTO_ALGNAME is printable
     puts(CRYPTO_ALGNAME);
@@ -284,6 +696,22 @@ int main(void) {
     result += test_sign();
     result += test_sign_detached();
     result += test_wrong_pk();
+    result += test_sign_derand();
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_expanded
+    result += test_sign_expanded();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_expanded
+    result += test_verify_expanded();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_verify_batch
+    result += test_verify_batch();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_precomputed
+    result += test_sign_precomputed();
+#endif
+#ifdef PQCLEAN_HAVE_crypto_sign_signature_batch
+    result += test_sign_batch();
+#endif
 
     return result;
 }
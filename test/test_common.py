@@ -5,8 +5,11 @@ Doesn't currently need isolation for parallelisation
 """
 
 import os
+import platform
 import re
 
+import pytest
+
 import helpers
 
 
@@ -21,6 +24,8 @@ def pytest_generate_tests(metafunc):
 @helpers.skip_windows()
 @helpers.filtered_test
 def test_common(primitive):
+    if primitive == 'keccak8x' and platform.machine() not in ('x86_64', 'AMD64'):
+        pytest.skip('keccak8x requires x86_64')
     binname = os.path.join('..', 'bin', 'test_common_'+primitive)
     helpers.make(binname)
     helpers.run_subprocess([binname])
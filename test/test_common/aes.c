@@ -47,13 +47,23 @@ const unsigned char key[AES256_KEYBYTES] = {
 const unsigned char nonce[AESCTR_NONCEBYTES] = {
   0x9d, 0x2d, 0x3e, 0x6e, 0x48, 0x5c, 0xf6, 0x6b, 0xb2, 0xb9, 0x25, 0xf4};
 
+// Long enough to go through the widest batched code paths and a tail
+#define LONGBLOCKS 37
+
 int main(void)
 {
   unsigned char ct[67];
+  unsigned char ctrblocks[LONGBLOCKS * AES_BLOCKBYTES];
+  unsigned char stream[LONGBLOCKS * AES_BLOCKBYTES];
+  unsigned char ecbstream[LONGBLOCKS * AES_BLOCKBYTES];
+  size_t i;
   int r = 0;
   aes128ctx ctx128_ecb, ctx128_ctr;
   aes192ctx ctx192_ecb, ctx192_ctr;
   aes256ctx ctx256_ecb, ctx256_ctr;
+  aes128ctx_inline ctx128_inline;
+  aes192ctx_inline ctx192_inline;
+  aes256ctx_inline ctx256_inline;
 
   aes128_ecb_keyexp(&ctx128_ecb, key);
   aes192_ecb_keyexp(&ctx192_ecb, key);
@@ -99,6 +109,50 @@ int main(void)
     r = 1;
   }
 
+  aes128_ctr_keyexp_inline(&ctx128_inline, key);
+  aes128_ctr_inline(ct, 67, nonce, &ctx128_inline);
+  if(memcmp(ct, stream128, 67)) {
+    printf("ERROR AES128CTR inline output does not match test vector.\n");
+    r = 1;
+  }
+
+  aes192_ecb_keyexp_inline(&ctx192_inline, key);
+  aes192_ecb_inline(ct, msg, sizeof(msg) / AES_BLOCKBYTES, &ctx192_inline);
+  if(memcmp(ct, ct192, 48)) {
+    printf("ERROR AES192ECB inline output does not match test vector.\n");
+    r = 1;
+  }
+
+  aes256_ctr_keyexp_inline(&ctx256_inline, key);
+  aes256_ctr_inline(ct, 67, nonce, &ctx256_inline);
+  if(memcmp(ct, stream256, 67)) {
+    printf("ERROR AES256CTR inline output does not match test vector.\n");
+    r = 1;
+  }
+  aes256_ecb_inline(ct, msg, sizeof(msg) / AES_BLOCKBYTES, &ctx256_inline);
+  if(memcmp(ct, ct256, 48)) {
+    printf("ERROR AES256ECB inline output does not match test vector.\n");
+    r = 1;
+  }
+
+  for (i = 0; i < LONGBLOCKS; i++) {
+    memcpy(ctrblocks + i * AES_BLOCKBYTES, nonce, AESCTR_NONCEBYTES);
+    ctrblocks[i * AES_BLOCKBYTES + 12] = (unsigned char)(i >> 24);
+    ctrblocks[i * AES_BLOCKBYTES + 13] = (unsigned char)(i >> 16);
+    ctrblocks[i * AES_BLOCKBYTES + 14] = (unsigned char)(i >> 8);
+    ctrblocks[i * AES_BLOCKBYTES + 15] = (unsigned char)i;
+  }
+  aes256_ecb(ecbstream, ctrblocks, LONGBLOCKS, &ctx256_ecb);
+  aes256_ctr(stream, sizeof(stream) - 5, nonce, &ctx256_ctr);
+  if(memcmp(stream, ecbstream, sizeof(stream) - 5)) {
+    printf("ERROR AES256CTR long output does not match AES256ECB on the counter blocks.\n");
+    r = 1;
+  }
+  if(memcmp(stream, stream256, 67)) {
+    printf("ERROR AES256CTR long output does not match test vector.\n");
+    r = 1;
+  }
+
   aes128_ctx_release(&ctx128_ecb);
   aes192_ctx_release(&ctx192_ecb);
   aes256_ctx_release(&ctx256_ecb);
@@ -260,11 +260,155 @@ static int test_shake128(void) {
     return 0;
 }
 
+static int test_inline(void) {
+    unsigned char input[512];
+    unsigned char check[512];
+    unsigned char output[512];
+    shake128incctx_inline state128;
+    shake128incctx_inline state128_clone;
+    shake256incctx_inline state256;
+    shake256ctx_inline state256_blocks;
+    sha3_512incctx_inline state_sha3;
+    int i;
+    int returncode = 0;
+
+    for (i = 0; i < 512; i++) {
+        input[i] = i;
+    }
+
+    shake128(check, 512, input, 512);
+    shake128_inc_init_inline(&state128);
+    shake128_inc_absorb_inline(&state128, input, 100);
+    shake128_inc_absorb_inline(&state128, input + 100, 412);
+    shake128_inc_finalize_inline(&state128);
+    shake128_inc_ctx_clone_inline(&state128_clone, &state128);
+    shake128_inc_squeeze_inline(output, 17, &state128);
+    shake128_inc_squeeze_inline(output + 17, 512 - 17, &state128);
+    if (memcmp(check, output, 512) != 0) {
+        printf("ERROR shake128 inline incremental did not match shake128.\n");
+        returncode = 1;
+    }
+    shake128_inc_squeeze_inline(output, 512, &state128_clone);
+    if (memcmp(check, output, 512) != 0) {
+        printf("ERROR shake128 inline clone did not match shake128.\n");
+        returncode = 1;
+    }
+
+    shake256(check, 512, input, 512);
+    shake256_inc_init_inline(&state256);
+    shake256_inc_absorb_inline(&state256, input, 512);
+    shake256_inc_finalize_inline(&state256);
+    shake256_inc_squeeze_inline(output, 512, &state256);
+    if (memcmp(check, output, 512) != 0) {
+        printf("ERROR shake256 inline incremental did not match shake256.\n");
+        returncode = 1;
+    }
+    shake256_absorb_inline(&state256_blocks, input, 512);
+    shake256_squeezeblocks_inline(output, 3, &state256_blocks);
+    if (memcmp(check, output, 3 * SHAKE256_RATE) != 0) {
+        printf("ERROR shake256 inline squeezeblocks did not match shake256.\n");
+        returncode = 1;
+    }
+
+    sha3_512(check, input, 512);
+    sha3_512_inc_init_inline(&state_sha3);
+    sha3_512_inc_absorb_inline(&state_sha3, input, 200);
+    sha3_512_inc_absorb_inline(&state_sha3, input + 200, 312);
+    sha3_512_inc_finalize_inline(output, &state_sha3);
+    if (memcmp(check, output, 64) != 0) {
+        printf("ERROR sha3_512 inline incremental did not match sha3_512.\n");
+        returncode = 1;
+    }
+
+    return returncode;
+}
+
+#define BATCH_N 19
+#define BATCH_OUTLEN 400
+#define PREFIX_LEN 150
+
+static int test_batch(void) {
+    unsigned char input[1024];
+    unsigned char check[BATCH_OUTLEN];
+    unsigned char output[BATCH_N][BATCH_OUTLEN];
+    uint8_t *out[BATCH_N];
+    const uint8_t *in[BATCH_N];
+    const uint8_t *pre[BATCH_N];
+    size_t inlen[BATCH_N];
+    shake256incctx state;
+    int i;
+    int returncode = 0;
+
+    for (i = 0; i < 1024; i++) {
+        input[i] = (unsigned char)(i * 7 + 3);
+    }
+    for (i = 0; i < BATCH_N; i++) {
+        // ragged lengths around the rate boundaries, including empty
+        inlen[i] = (size_t)((i * 53) % 600);
+        in[i] = input + i;
+        out[i] = output[i];
+    }
+
+    shake128_batch(out, BATCH_OUTLEN, in, inlen, BATCH_N);
+    for (i = 0; i < BATCH_N; i++) {
+        shake128(check, BATCH_OUTLEN, in[i], inlen[i]);
+        if (memcmp(check, output[i], BATCH_OUTLEN) != 0) {
+            printf("ERROR shake128_batch did not match shake128 for message %d.\n", i);
+            returncode = 1;
+        }
+    }
+    shake256_batch(out, BATCH_OUTLEN, in, inlen, BATCH_N);
+    for (i = 0; i < BATCH_N; i++) {
+        shake256(check, BATCH_OUTLEN, in[i], inlen[i]);
+        if (memcmp(check, output[i], BATCH_OUTLEN) != 0) {
+            printf("ERROR shake256_batch did not match shake256 for message %d.\n", i);
+            returncode = 1;
+        }
+    }
+    for (i = 0; i < BATCH_N; i++) {
+        // prefixes of one rate and a bit, so blocks straddle both parts
+        pre[i] = input + 1024 - PREFIX_LEN - i;
+    }
+    shake256_batch_prefixed(out, BATCH_OUTLEN, pre, PREFIX_LEN, in, inlen, BATCH_N);
+    for (i = 0; i < BATCH_N; i++) {
+        shake256_inc_init(&state);
+        shake256_inc_absorb(&state, pre[i], PREFIX_LEN);
+        shake256_inc_absorb(&state, in[i], inlen[i]);
+        shake256_inc_finalize(&state);
+        shake256_inc_squeeze(check, BATCH_OUTLEN, &state);
+        shake256_inc_ctx_release(&state);
+        if (memcmp(check, output[i], BATCH_OUTLEN) != 0) {
+            printf("ERROR shake256_batch_prefixed did not match shake256 for message %d.\n", i);
+            returncode = 1;
+        }
+    }
+    sha3_256_batch(out, in, inlen, BATCH_N);
+    for (i = 0; i < BATCH_N; i++) {
+        sha3_256(check, in[i], inlen[i]);
+        if (memcmp(check, output[i], 32) != 0) {
+            printf("ERROR sha3_256_batch did not match sha3_256 for message %d.\n", i);
+            returncode = 1;
+        }
+    }
+    sha3_512_batch(out, in, inlen, BATCH_N);
+    for (i = 0; i < BATCH_N; i++) {
+        sha3_512(check, in[i], inlen[i]);
+        if (memcmp(check, output[i], 64) != 0) {
+            printf("ERROR sha3_512_batch did not match sha3_512 for message %d.\n", i);
+            returncode = 1;
+        }
+    }
+
+    return returncode;
+}
+
 int main(void) {
     int result = 0;
     result += test_shake128();
     result += test_shake128_incremental();
     result += test_sha3_256_incremental();
+    result += test_inline();
+    result += test_batch();
 
     if (result != 0) {
         puts("Errors occurred");
@@ -0,0 +1,80 @@
+#include "fips202.h"
+#include "KeccakP-1600-times8-SnP.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define RATE SHAKE128_RATE
+#define NBLOCKS 3
+#define STRIDE (NBLOCKS * RATE)
+
+/*
+ * Runs eight SHAKE128 instances through the 8-way SnP and compares them
+ * with shake128() from fips202.c, which this test builds without CPU
+ * dispatch, i.e. with the scalar permutation.
+ */
+static int test_shake128x8(void) {
+    uint64_t states[25 * 8] __attribute__((aligned(64)));
+    uint8_t in[8 * STRIDE];
+    uint8_t out[8 * STRIDE];
+    uint8_t check[2 * RATE];
+    size_t inlen[8];
+    size_t i;
+    unsigned int j;
+    int res = 0;
+
+    for (i = 0; i < sizeof in; i++) {
+        in[i] = (uint8_t)(i * 251 + 17);
+    }
+
+    // Different lengths, all padded into three blocks
+    for (j = 0; j < 8; j++) {
+        inlen[j] = 2 * RATE + 20 * j;
+        shake128(check, 2 * RATE, in + j * STRIDE, inlen[j]);
+        memcpy(out + j * STRIDE, check, 2 * RATE);
+        memset(in + j * STRIDE + inlen[j], 0, STRIDE - inlen[j]);
+        in[j * STRIDE + inlen[j]] ^= 0x1F;
+        in[j * STRIDE + STRIDE - 1] ^= 0x80;
+    }
+
+    KeccakP1600times8_InitializeAll(states);
+    KeccakP1600times8_AddLanesAll(states, in, RATE / 8, STRIDE / 8);
+    KeccakP1600times8_PermuteAll_24rounds(states);
+    KeccakP1600times8_AddLanesAll(states, in + RATE, RATE / 8, STRIDE / 8);
+    KeccakP1600times8_PermuteAll_24rounds(states);
+    for (j = 0; j < 8; j++) {
+        KeccakP1600times8_AddBytes(states, j, in + j * STRIDE + 2 * RATE, 0, RATE);
+    }
+    KeccakP1600times8_PermuteAll_24rounds(states);
+
+    // in is no longer needed; squeeze into it
+    KeccakP1600times8_ExtractLanesAll(states, in, RATE / 8, STRIDE / 8);
+    KeccakP1600times8_PermuteAll_24rounds(states);
+    for (j = 0; j < 8; j++) {
+        KeccakP1600times8_ExtractBytes(states, j, in + j * STRIDE + RATE, 0, RATE);
+    }
+
+    for (j = 0; j < 8; j++) {
+        if (memcmp(in + j * STRIDE, out + j * STRIDE, 2 * RATE) != 0) {
+            printf("ERROR 8-way SHAKE128 instance %u did not match shake128.\n", j);
+            res = 1;
+        }
+    }
+    return res;
+}
+
+int main(void) {
+    int result = 0;
+
+    if (!__builtin_cpu_supports("avx512f")) {
+        puts("AVX-512F not available, skipping");
+        return 0;
+    }
+    result += test_shake128x8();
+
+    if (result != 0) {
+        puts("Errors occurred");
+    }
+    return result;
+}
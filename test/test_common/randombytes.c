@@ -0,0 +1,110 @@
+// Built with -DPQCLEAN_RANDOMBYTES_BUFFERED; checks that the buffered
+// generator rarely goes to the system RNG, that a forked child does not
+// repeat its parent's output and that an installed provider is used.
+#if defined(__linux__)
+# define _GNU_SOURCE
+#endif
+
+#include "randombytes.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ > 24))
+#include <sys/random.h>
+#include <sys/syscall.h>
+
+// Counts the calls that randombytes.c makes to getrandom()
+static unsigned long syscalls;
+
+ssize_t getrandom(void *buf, size_t buflen, unsigned int flags) {
+  syscalls++;
+  return syscall(SYS_getrandom, buf, buflen, flags);
+}
+#else
+static unsigned long syscalls;
+#endif
+
+// Provider returning ctx[0], ctx[0] + 1, ...
+static int counting_provider(void *ctx, uint8_t *output, size_t n) {
+  uint8_t *next = (uint8_t *)ctx;
+  size_t i;
+
+  for (i = 0; i < n; i++) {
+    output[i] = (*next)++;
+  }
+  return 0;
+}
+
+#define NCALLS 100000
+#define CALLBYTES 64
+
+// One reseed per MiB of output, plus the initial seed
+#define MAXSYSCALLS ((NCALLS * CALLBYTES >> 20) + 1)
+
+int main(void)
+{
+  unsigned char buf[CALLBYTES];
+  unsigned char child[32], parent[32];
+  uint8_t next = 0;
+  int fds[2];
+  pid_t pid;
+  int status;
+  int i;
+  int r = 0;
+
+  for (i = 0; i < NCALLS; i++) {
+    if (randombytes(buf, sizeof(buf)) != 0) {
+      printf("ERROR randombytes failed.\n");
+      return 1;
+    }
+  }
+  if (syscalls > MAXSYSCALLS) {
+    printf("ERROR %lu getrandom calls for %d requests.\n", syscalls, NCALLS);
+    r = 1;
+  }
+
+  randombytes_set_provider(counting_provider, &next);
+  randombytes(buf, 16);
+  randombytes(buf + 16, 16);
+  randombytes_set_provider(NULL, NULL);
+  for (i = 0; i < 32; i++) {
+    if (buf[i] != i) {
+      printf("ERROR randombytes did not use the installed provider.\n");
+      r = 1;
+      break;
+    }
+  }
+
+  if (pipe(fds) != 0) {
+    printf("ERROR pipe failed.\n");
+    return 1;
+  }
+  pid = fork();
+  if (pid < 0) {
+    printf("ERROR fork failed.\n");
+    return 1;
+  }
+  if (pid == 0) {
+    randombytes(child, sizeof(child));
+    if (write(fds[1], child, sizeof(child)) != (ssize_t)sizeof(child)) {
+      _exit(1);
+    }
+    _exit(0);
+  }
+  randombytes(parent, sizeof(parent));
+  if (read(fds[0], child, sizeof(child)) != (ssize_t)sizeof(child) ||
+      waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    printf("ERROR child process failed.\n");
+    return 1;
+  }
+  if (memcmp(child, parent, sizeof(child)) == 0) {
+    printf("ERROR child and parent produced the same random bytes.\n");
+    r = 1;
+  }
+
+  return r;
+}
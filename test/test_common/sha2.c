@@ -205,14 +205,110 @@ static int test_sha512(void) {
     return 0;
 }
 
+static int test_inline(void) {
+    unsigned char output[64];
+    sha256ctx_inline state256;
+    sha256ctx_inline state256_clone;
+    sha512ctx_inline state512;
+    int returncode = 0;
+
+    sha256_inc_init_inline(&state256);
+    sha256_inc_blocks_inline(&state256, plaintext, 1);
+    sha256_inc_ctx_clone_inline(&state256_clone, &state256);
+    sha256_inc_finalize_inline(output, &state256, plaintext + 64, 112 - 64);
+    if (memcmp(expected_256, output, 32) != 0) {
+        printf("ERROR sha256 inline incremental did not match test vector.\n");
+        returncode = 1;
+    }
+    sha256_inc_finalize_inline(output, &state256_clone, plaintext + 64, 112 - 64);
+    if (memcmp(expected_256, output, 32) != 0) {
+        printf("ERROR sha256 inline clone did not match test vector.\n");
+        returncode = 1;
+    }
+
+    sha512_inc_init_inline(&state512);
+    sha512_inc_blocks_inline(&state512, plaintext2, 1);
+    sha512_inc_finalize_inline(output, &state512, NULL, 0);
+    if (memcmp(expected_512_2, output, 64) != 0) {
+        printf("ERROR sha512 inline incremental did not match test vector.\n");
+        returncode = 1;
+    }
+
+    return returncode;
+}
+
+/* One million repetitions of 'a', fed one block at a time */
+static int test_sha256_million_a(void) {
+    const unsigned char expected[32] = {
+        0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2,
+        0x84, 0xd7, 0x3e, 0x67, 0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+        0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0
+    };
+    unsigned char block[64];
+    unsigned char output[32];
+    sha256ctx_inline state;
+    int i;
+
+    memset(block, 'a', sizeof(block));
+    sha256_inc_init_inline(&state);
+    for (i = 0; i < 1000000 / 64; i++) {
+        sha256_inc_blocks_inline(&state, block, 1);
+    }
+    sha256_inc_finalize_inline(output, &state, block, 0);
+
+    if (memcmp(expected, output, 32) != 0) {
+        printf("ERROR sha256 of one million 'a' did not match test vector.\n");
+        return 1;
+    }
+    return 0;
+}
+
+static int test_batch(void) {
+    unsigned char check[64];
+    unsigned char output[4][64];
+    uint8_t *out[4];
+    const uint8_t *in[4];
+    size_t inlen[4];
+    int i;
+    int returncode = 0;
+
+    for (i = 0; i < 4; i++) {
+        in[i] = plaintext2 + i;
+        inlen[i] = (size_t)(i * 37);
+        out[i] = output[i];
+    }
+
+    sha256_batch(out, in, inlen, 4);
+    for (i = 0; i < 4; i++) {
+        sha256(check, in[i], inlen[i]);
+        if (memcmp(check, output[i], 32) != 0) {
+            printf("ERROR sha256_batch did not match sha256 for message %d.\n", i);
+            returncode = 1;
+        }
+    }
+    sha512_batch(out, in, inlen, 4);
+    for (i = 0; i < 4; i++) {
+        sha512(check, in[i], inlen[i]);
+        if (memcmp(check, output[i], 64) != 0) {
+            printf("ERROR sha512_batch did not match sha512 for message %d.\n", i);
+            returncode = 1;
+        }
+    }
+
+    return returncode;
+}
+
 int main(void) {
     int result = 0;
     result += test_sha224();
     result += test_sha256();
+    result += test_sha256_million_a();
     result += test_sha256_incremental();
     result += test_sha384();
     result += test_sha512();
     result += test_sha512_incremental();
+    result += test_inline();
+    result += test_batch();
 
     if (result != 0) {
         puts("Errors occurred");
@@ -1,13 +1,30 @@
 """
 Checks that no dynamic memory functions are used
+
+This includes the heap-backed context API in common/ (fips202.h, sha2.h,
+aes.h, sp800-185.h): schemes must use the allocation-free *_inline variants,
+so that no operation goes through the allocator.
 """
 
+import re
+
 import pytest
 
 import helpers
 import pqclean
 
 
+# Functions in common/ that allocate their context on the heap
+ALLOCATING_COMMON_FUNCTIONS = re.compile(
+    r'^(c?shake(128|256)_inc_init'
+    r'|shake(128|256)_absorb'
+    r'|sha3_(256|384|512)_inc_init'
+    r'|sha(224|256|384|512)_inc_init'
+    r'|(c?shake(128|256)|sha3_(256|384|512)|sha(224|256|384|512))'
+    r'_(inc_)?ctx_clone'
+    r'|aes(128|192|256)_(ecb|ctr)_keyexp)$')
+
+
 @pytest.mark.parametrize(
     'implementation,test_dir,impl_path, init, destr',
     [(impl, *helpers.isolate_test_files(impl.path(), 'test_functest_'))
@@ -34,6 +51,12 @@ def test_dynamic_memory(implementation, test_dir, impl_path, init, destr):
                 raise AssertionError(
                     "Illegal use of dynamic memory function "
                     "'{function}'".format(function=function))
+        fields = line.split()
+        if (len(fields) == 2 and fields[0] == 'U'
+                and ALLOCATING_COMMON_FUNCTIONS.match(fields[1])):
+            raise AssertionError(
+                "Use of heap-allocating common function '{function}'; "
+                "use '{function}_inline' instead".format(function=fields[1]))
 
     destr()
 
@@ -72,6 +72,7 @@ def check_makefile_dependencies(implementation, impl_path, file):
     hfiles += glob.glob(os.path.join(commondir, '*.h'))
     hfiles += glob.glob(os.path.join(commondir, '**', '*.h'))
     incfiles.append(os.path.join(commondir, 'keccak4x', 'KeccakP-1600-unrolling.macros'))
+    incfiles.append(os.path.join(commondir, 'keccak8x', 'KeccakP-1600-unrolling.macros'))
     ofiles += glob.glob(os.path.join(commondir, o_ext))
     ofiles += glob.glob(os.path.join(commondir, '**', o_ext))
 
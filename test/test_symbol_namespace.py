@@ -48,6 +48,11 @@ def test_symbol_namespaces(implementation, impl_path, test_dir, init, destr):
                     symbol.startswith('_KeccakF1600times4') or  # MacOS
                     symbol.startswith('KeccakP1600times4') or
                     symbol.startswith('_KeccakP1600times4') or  # MacOS
+                    # KeccakP-1600 for AVX-512
+                    symbol.startswith('KeccakF1600times8') or
+                    symbol.startswith('_KeccakF1600times8') or  # MacOS
+                    symbol.startswith('KeccakP1600times8') or
+                    symbol.startswith('_KeccakP1600times8') or  # MacOS
                     # weird things on i386
                     symbol.startswith('__x86.get_pc_thunk.')):
                 non_namespaced.append(symbol)